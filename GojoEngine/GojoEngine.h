@@ -1,5 +1,33 @@
 #include "Core/Engine.h"
 
+// Flight recorder
+#include "Managers/FlightRecorder/FlightRecorder.h"
+
+// Profiler
+#include "Core/Profiler/Profiler.h"
+
+// Metrics
+#include "Core/Metrics/Metrics.h"
+#include "Managers/MetricsExporter/MetricsExporter.h"
+
+// Job system
+#include "Managers/JobSystem/JobSystem.h"
+
+// Memory
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Memory/FixedSizePool.h"
+#include "Core/Memory/FrameAllocator.h"
+
+// ECS
+#include "ECS/World.h"
+#include "ECS/Query.h"
+#include "ECS/CommandBuffer.h"
+#include "ECS/SystemScheduler.h"
+
+// Coroutines
+#include "Core/Coroutines/Task.h"
+#include "Core/Coroutines/TaskScheduler.h"
+
 // Log manager
 #include "Managers/LogManager/LogManager.h"
 
@@ -9,6 +37,7 @@
 
 // Event manager
 #include "Managers/EventManager/EventManager.h"
+#include "Managers/EventManager/EventRecorder.h"
 #include "Managers/EventManager/Events/Event.h"
 #include "Managers/EventManager/Events/KeyboardEvents.h"
 #include "Managers/EventManager/Events/MouseEvents.h"
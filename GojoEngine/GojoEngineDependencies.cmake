@@ -60,6 +60,16 @@ target_link_libraries(GojoEngine PUBLIC
 )
 
 
+# ------------------------------------
+# Winsock (metrics socket)
+# ------------------------------------
+if(WIN32)
+	target_link_libraries(GojoEngine PRIVATE
+		ws2_32
+	)
+endif()
+
+
 # ------------------------------------
 # Finish
 # ------------------------------------
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Bounded Queue
+	// ====================================================================================================
+
+	/**
+	 * @brief Fixed-capacity lock-free ring buffer (Vyukov bounded MPMC queue).
+	 *
+	 * Cells are allocated once at construction and reused forever, so pushing and popping never
+	 * touch the heap. Values are written and read in place through callbacks, which lets callers
+	 * placement-construct variable payloads inside the cell without an intermediate copy.
+	 * Capacity is rounded up to the next power of two.
+	 */
+	template<typename T>
+	class BoundedQueue final : public NonCopyable
+	{
+	public:
+		explicit BoundedQueue(size_t capacity)
+			: mCapacity(std::bit_ceil(capacity < 2 ? size_t{ 2 } : capacity))
+			, mMask(mCapacity - 1)
+			, mCells(std::make_unique<Cell[]>(mCapacity))
+		{
+			for (size_t i = 0; i < mCapacity; ++i)
+			{
+				mCells[i].mSequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		// @brief Claims a free cell and lets "writer(T&)" fill it. Safe from any thread.
+		// @return False if the queue is full (writer is not called).
+		template<typename WriterT>
+		bool TryPush(WriterT&& writer)
+		{
+			Cell* cell = nullptr;
+			size_t position = mEnqueuePos.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				cell = &mCells[position & mMask];
+				const size_t sequence = cell->mSequence.load(std::memory_order_acquire);
+				const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+				if (difference == 0)
+				{
+					if (mEnqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = mEnqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			writer(cell->mValue);
+			cell->mSequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		// @brief Claims the oldest published cell and lets "reader(T&)" consume it. Safe from any thread.
+		// @return False if the queue is empty (reader is not called).
+		template<typename ReaderT>
+		bool TryPop(ReaderT&& reader)
+		{
+			Cell* cell = nullptr;
+			size_t position = mDequeuePos.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				cell = &mCells[position & mMask];
+				const size_t sequence = cell->mSequence.load(std::memory_order_acquire);
+				const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+				if (difference == 0)
+				{
+					if (mDequeuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = mDequeuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			reader(cell->mValue);
+			cell->mSequence.store(position + mCapacity, std::memory_order_release);
+			return true;
+		}
+
+		// @brief Inspects the oldest published cell without consuming it.
+		//        Only valid while this thread is the sole consumer.
+		template<typename ReaderT>
+		bool TryPeek(ReaderT&& reader)
+		{
+			const size_t position = mDequeuePos.load(std::memory_order_relaxed);
+			Cell& cell = mCells[position & mMask];
+			if (cell.mSequence.load(std::memory_order_acquire) != position + 1)
+			{
+				return false;
+			}
+
+			reader(cell.mValue);
+			return true;
+		}
+
+		// @brief Approximate number of claimed cells (exact when producers and consumers are idle).
+		[[nodiscard]] size_t GetSize() const
+		{
+			const size_t enqueuePos = mEnqueuePos.load(std::memory_order_relaxed);
+			const size_t dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+			return enqueuePos >= dequeuePos ? enqueuePos - dequeuePos : 0;
+		}
+
+		[[nodiscard]] size_t GetCapacity() const { return mCapacity; }
+
+	private:
+		struct Cell
+		{
+			std::atomic<size_t> mSequence{ 0 };
+			T mValue{};
+		};
+
+	private:
+		const size_t mCapacity;
+		const size_t mMask;
+		std::unique_ptr<Cell[]> mCells;
+
+		alignas(cCacheLineSize) std::atomic<size_t> mEnqueuePos{ 0 };
+		alignas(cCacheLineSize) std::atomic<size_t> mDequeuePos{ 0 };
+	};
+}
\ No newline at end of file
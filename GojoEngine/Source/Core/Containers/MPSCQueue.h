@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// MPSC Queue
+	// ====================================================================================================
+
+	/**
+	 * @brief Unbounded lock-free multi-producer/single-consumer queue (Vyukov intrusive node queue).
+	 *
+	 * Any thread may call Push(). Only one thread at a time may call TryPop() / IsEmpty().
+	 * Push() is wait-free (one atomic exchange); TryPop() never blocks producers.
+	 * A pop may briefly report "empty" while a producer is between its exchange and its link,
+	 * the element simply becomes visible on the next pop.
+	 */
+	template<typename T>
+	class MPSCQueue final : public NonCopyable
+	{
+	public:
+		MPSCQueue()
+			: mHead(&mStub), mTail(&mStub)
+		{
+		}
+
+		~MPSCQueue() override
+		{
+			while (Node* next = mTail->mNext.load(std::memory_order_acquire))
+			{
+				std::launder(reinterpret_cast<T*>(next->mStorage))->~T();
+				ReleaseTail(next);
+			}
+
+			if (mTail != &mStub)
+			{
+				delete mTail;
+			}
+		}
+
+		// @brief Pushes a value. Safe to call from any thread.
+		void Push(T value)
+		{
+			Node* node = new Node();
+			::new (node->mStorage) T(std::move(value));
+			node->mNext.store(nullptr, std::memory_order_relaxed);
+
+			// Count before publishing so the consumer never observes a negative size
+			mSize.fetch_add(1, std::memory_order_relaxed);
+
+			Node* previous = mHead.exchange(node, std::memory_order_acq_rel);
+			previous->mNext.store(node, std::memory_order_release);
+		}
+
+		// @brief Pops the oldest value. Consumer thread only.
+		// @return False if no fully published element is available.
+		bool TryPop(T& outValue)
+		{
+			Node* next = mTail->mNext.load(std::memory_order_acquire);
+			if (!next)
+			{
+				return false;
+			}
+
+			// "next" becomes the new stub, its payload is moved out and destroyed
+			T* payload = std::launder(reinterpret_cast<T*>(next->mStorage));
+			outValue = std::move(*payload);
+			payload->~T();
+
+			ReleaseTail(next);
+
+			mSize.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		// @brief Approximate number of queued elements (exact when producers are idle).
+		[[nodiscard]] size_t GetSize() const { return mSize.load(std::memory_order_relaxed); }
+
+		// @brief Consumer thread only.
+		[[nodiscard]] bool IsEmpty() const { return mTail->mNext.load(std::memory_order_acquire) == nullptr; }
+
+	private:
+		struct Node
+		{
+			std::atomic<Node*> mNext{ nullptr };
+			alignas(T) std::byte mStorage[sizeof(T)];
+		};
+
+		// @brief Advances the tail to "next" and frees the previous (already consumed) node.
+		void ReleaseTail(Node* next)
+		{
+			Node* previous = mTail;
+			mTail = next;
+			if (previous != &mStub)
+			{
+				delete previous;
+			}
+		}
+
+	private:
+		alignas(cCacheLineSize) std::atomic<Node*> mHead;	// Producers
+		alignas(cCacheLineSize) Node* mTail;				// Consumer
+		std::atomic<size_t> mSize{ 0 };
+		Node mStub;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Slot Handle
+	// ====================================================================================================
+
+	/**
+	 * @brief Index and generation of a SlotMap element. "TagT" only keeps handles of different maps apart.
+	 *        Generation 0 is never handed out, so a default handle is always invalid.
+	 */
+	template<typename TagT>
+	struct SlotHandle
+	{
+		uint32_t Index{ 0 };
+		uint32_t Generation{ 0 };
+
+		[[nodiscard]] constexpr bool IsValid() const { return Generation != 0; }
+		constexpr auto operator<=>(const SlotHandle&) const = default;
+	};
+
+	// ====================================================================================================
+	// Slot Map
+	// ====================================================================================================
+
+	/**
+	 * @brief Generational slot map: stable handles over densely stored values.
+	 *
+	 * Handles index a slot table, each slot points into the dense value array and counts how often it was
+	 * reused. Lookup is one bounds check and one generation compare; a handle whose element was removed
+	 * stays stale even once its slot is reused. Removal moves the last value into the hole, so values
+	 * must be movable and their addresses change (store pointers for objects that hand out "this").
+	 * Iteration walks the dense array. Not thread-safe.
+	 */
+	template<typename T, typename TagT = T>
+	class SlotMap final : public NonCopyable
+	{
+	public:
+		using Handle = SlotHandle<TagT>;
+
+		template<typename... ArgsT>
+		Handle Emplace(ArgsT&&... args)
+		{
+			const Handle handle = AllocateSlot();
+			mValues.emplace_back(std::forward<ArgsT>(args)...);
+			return handle;
+		}
+
+		// @brief Stores "factory(handle)", for values that need to know their own handle.
+		template<typename FactoryT>
+		Handle EmplaceWithHandle(FactoryT&& factory)
+		{
+			const Handle handle = AllocateSlot();
+			mValues.push_back(std::forward<FactoryT>(factory)(handle));
+			return handle;
+		}
+
+		// @return False if the handle is stale.
+		bool Remove(Handle handle)
+		{
+			if (!Contains(handle))
+				return false;
+
+			RemoveDense(mSlots[handle.Index].DenseIndex);
+			return true;
+		}
+
+		// @brief Removes every element "predicate(handle, value)" returns true for.
+		// @return The number of removed elements.
+		template<typename PredicateT>
+		size_t RemoveIf(PredicateT&& predicate)
+		{
+			size_t removedCount = 0;
+			for (size_t denseIndex = 0; denseIndex < mValues.size();)
+			{
+				if (predicate(GetHandle(denseIndex), mValues[denseIndex]))
+				{
+					// The last value moved into "denseIndex" is visited next
+					RemoveDense(static_cast<uint32_t>(denseIndex));
+					++removedCount;
+				}
+				else
+				{
+					++denseIndex;
+				}
+			}
+			return removedCount;
+		}
+
+		void Clear()
+		{
+			while (!mValues.empty())
+			{
+				RemoveDense(static_cast<uint32_t>(mValues.size() - 1));
+			}
+		}
+
+		void Reserve(size_t capacity)
+		{
+			mSlots.reserve(capacity);
+			mValues.reserve(capacity);
+			mDenseToSlot.reserve(capacity);
+		}
+
+		// @return nullptr if the handle is stale.
+		[[nodiscard]] T* Get(Handle handle)
+		{
+			return Contains(handle) ? &mValues[mSlots[handle.Index].DenseIndex] : nullptr;
+		}
+
+		[[nodiscard]] const T* Get(Handle handle) const
+		{
+			return Contains(handle) ? &mValues[mSlots[handle.Index].DenseIndex] : nullptr;
+		}
+
+		[[nodiscard]] bool Contains(Handle handle) const
+		{
+			return handle.Index < mSlots.size() && handle.IsValid() && mSlots[handle.Index].Generation == handle.Generation;
+		}
+
+		// @brief Handle of the value at "denseIndex" (0 .. GetSize() - 1).
+		[[nodiscard]] Handle GetHandle(size_t denseIndex) const
+		{
+			const uint32_t slotIndex = mDenseToSlot[denseIndex];
+			return Handle{ slotIndex, mSlots[slotIndex].Generation };
+		}
+
+		[[nodiscard]] size_t GetSize() const { return mValues.size(); }
+		[[nodiscard]] bool IsEmpty() const { return mValues.empty(); }
+
+		// @brief Dense values in no particular order, invalidated by any insertion or removal.
+		[[nodiscard]] std::span<T> GetValues() { return mValues; }
+		[[nodiscard]] std::span<const T> GetValues() const { return mValues; }
+
+		auto begin() { return mValues.begin(); }
+		auto end() { return mValues.end(); }
+		auto begin() const { return mValues.begin(); }
+		auto end() const { return mValues.end(); }
+
+	private:
+		static constexpr uint32_t cNil = std::numeric_limits<uint32_t>::max();
+
+		struct Slot
+		{
+			uint32_t DenseIndex{ cNil };						// Next free slot while the slot is free
+			uint32_t Generation{ 1 };
+		};
+
+		Handle AllocateSlot()
+		{
+			uint32_t slotIndex = mFreeHead;
+			if (slotIndex != cNil)
+			{
+				mFreeHead = mSlots[slotIndex].DenseIndex;
+			}
+			else
+			{
+				slotIndex = static_cast<uint32_t>(mSlots.size());
+				mSlots.emplace_back();
+			}
+
+			Slot& slot = mSlots[slotIndex];
+			slot.DenseIndex = static_cast<uint32_t>(mValues.size());
+			mDenseToSlot.push_back(slotIndex);
+			return Handle{ slotIndex, slot.Generation };
+		}
+
+		void RemoveDense(uint32_t denseIndex)
+		{
+			const uint32_t slotIndex = mDenseToSlot[denseIndex];
+			const uint32_t lastIndex = static_cast<uint32_t>(mValues.size() - 1);
+
+			if (denseIndex != lastIndex)
+			{
+				mValues[denseIndex] = std::move(mValues[lastIndex]);
+				mDenseToSlot[denseIndex] = mDenseToSlot[lastIndex];
+				mSlots[mDenseToSlot[denseIndex]].DenseIndex = denseIndex;
+			}
+			mValues.pop_back();
+			mDenseToSlot.pop_back();
+
+			// Every handle of this slot goes stale; 0 is skipped when the counter wraps around
+			Slot& slot = mSlots[slotIndex];
+			slot.Generation = slot.Generation + 1 != 0 ? slot.Generation + 1 : 1;
+			slot.DenseIndex = mFreeHead;
+			mFreeHead = slotIndex;
+		}
+
+	private:
+		std::vector<Slot> mSlots;
+		std::vector<T> mValues;
+		std::vector<uint32_t> mDenseToSlot;						// Slot of every dense value, for removal and GetHandle()
+		uint32_t mFreeHead{ cNil };
+	};
+}
+
+// ====================================================================================================
+// Standard Library Specializations
+// ====================================================================================================
+
+namespace std
+{
+	template<typename TagT>
+	struct hash<GojoEngine::SlotHandle<TagT>>
+	{
+		size_t operator()(const GojoEngine::SlotHandle<TagT>& handle) const noexcept
+		{
+			return std::hash<uint64_t>{}((static_cast<uint64_t>(handle.Generation) << 32) | handle.Index);
+		}
+	};
+}
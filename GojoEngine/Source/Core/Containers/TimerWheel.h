@@ -0,0 +1,346 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Timer Handle
+	// ====================================================================================================
+
+	/**
+	 * @brief Identifies a scheduled timer. Becomes stale once a one-shot timer fired or any timer was cancelled.
+	 */
+	struct TimerHandle
+	{
+		uint32_t Index{ std::numeric_limits<uint32_t>::max() };
+		uint32_t Generation{ 0 };
+
+		[[nodiscard]] constexpr bool IsValid() const { return Index != std::numeric_limits<uint32_t>::max(); }
+		constexpr auto operator<=>(const TimerHandle&) const = default;
+	};
+
+	// ====================================================================================================
+	// Timer Wheel
+	// ====================================================================================================
+
+	/**
+	 * @brief Hierarchical timer wheel (4 levels x 256 slots, 2^32 ticks of range).
+	 *
+	 * Schedule() and Cancel() are O(1): timers are intrusive doubly-linked list nodes stored in a
+	 * recycled node pool. Advance() only visits the slot of each elapsed tick and cascades a higher
+	 * level slot once every 256^level ticks, so the cost does not depend on the number of pending timers.
+	 * Not thread-safe, owned by a single thread.
+	 */
+	template<typename PayloadT>
+	class TimerWheel final : public NonCopyable
+	{
+	public:
+		TimerWheel()
+		{
+			mSlotHeads.fill(cNil);
+		}
+
+		// @brief Schedules a payload "delayTicks" from now (at least one tick).
+		// @param periodTicks If non-zero, the timer re-arms itself with this period after each expiration.
+		TimerHandle Schedule(uint64_t delayTicks, uint64_t periodTicks, PayloadT payload)
+		{
+			return ScheduleAt(mCurrentTick + delayTicks, periodTicks, std::move(payload));
+		}
+
+		// @brief Schedules a payload at an absolute tick, for owners whose clock ran ahead of the wheel.
+		//        Ticks that already passed expire on the next Advance().
+		TimerHandle ScheduleAt(uint64_t expiryTick, uint64_t periodTicks, PayloadT payload)
+		{
+			const uint32_t index = AllocateNode();
+			Node& node = mNodes[index];
+			node.Payload = std::move(payload);
+			node.Expiry = expiryTick > mCurrentTick ? expiryTick : mCurrentTick + 1;
+			node.Period = periodTicks;
+			node.State = NodeState::Linked;
+
+			Link(index);
+			++mActiveCount;
+
+			return TimerHandle{ index, node.Generation };
+		}
+
+		// @brief Cancels a pending timer (also valid from inside an expiration callback).
+		// @return False if the handle is stale.
+		bool Cancel(TimerHandle handle)
+		{
+			if (!IsScheduled(handle))
+			{
+				return false;
+			}
+
+			Node& node = mNodes[handle.Index];
+			if (node.State == NodeState::Linked)
+			{
+				Unlink(handle.Index);
+				FreeNode(handle.Index);
+			}
+			else
+			{
+				// Expiring right now, Advance() releases the node once the callback returns
+				node.State = NodeState::Cancelled;
+				++node.Generation;
+			}
+
+			--mActiveCount;
+			return true;
+		}
+
+		[[nodiscard]] bool IsScheduled(TimerHandle handle) const
+		{
+			return handle.Index < mNodes.size()
+				&& mNodes[handle.Index].Generation == handle.Generation
+				&& (mNodes[handle.Index].State == NodeState::Linked || mNodes[handle.Index].State == NodeState::Expiring);
+		}
+
+		// @brief Moves time forward and calls "onExpired(TimerHandle, PayloadT&)" for every due timer, in tick order.
+		template<typename CallbackT>
+		void Advance(uint64_t elapsedTicks, CallbackT&& onExpired)
+		{
+			GOJO_RUNTIME_ASSERT(!mAdvancing, "TimerWheel::Advance is not re-entrant!");
+			mAdvancing = true;
+
+			const uint64_t targetTick = mCurrentTick + elapsedTicks;
+			while (mCurrentTick < targetTick)
+			{
+				// Ticks before the next cascade of the lowest non-empty level cannot expire anything
+				const uint64_t idleUntil = GetLastIdleTick();
+				if (idleUntil > mCurrentTick)
+				{
+					mCurrentTick = idleUntil < targetTick ? idleUntil : targetTick;
+					continue;
+				}
+
+				++mCurrentTick;
+				Cascade();
+				ExpireCurrentSlot(onExpired);
+			}
+
+			mAdvancing = false;
+		}
+
+		[[nodiscard]] uint64_t GetCurrentTick() const { return mCurrentTick; }
+		[[nodiscard]] size_t GetSize() const { return mActiveCount; }
+
+	private:
+		static constexpr uint32_t cNil = std::numeric_limits<uint32_t>::max();
+		static constexpr uint32_t cSlotBits = 8;
+		static constexpr uint32_t cSlotsPerLevel = 1u << cSlotBits;
+		static constexpr uint32_t cSlotMask = cSlotsPerLevel - 1;
+		static constexpr uint32_t cLevelCount = 4;
+		static constexpr uint64_t cMaxDelta = (uint64_t{ 1 } << (cSlotBits * cLevelCount)) - 1;
+
+		enum class NodeState : uint8_t { Free, Linked, Expiring, Cancelled };
+
+		struct Node
+		{
+			PayloadT Payload{};
+			uint64_t Expiry{ 0 };
+			uint64_t Period{ 0 };
+			uint32_t Prev{ cNil };
+			uint32_t Next{ cNil };
+			uint32_t Slot{ cNil };
+			uint32_t Generation{ 0 };
+			NodeState State{ NodeState::Free };
+		};
+
+		// @brief Last tick that can be skipped without visiting slots (mCurrentTick if none).
+		[[nodiscard]] uint64_t GetLastIdleTick() const
+		{
+			for (uint32_t level = 0; level < cLevelCount; ++level)
+			{
+				if (mLevelCounts[level] > 0)
+				{
+					if (level == 0)
+						return mCurrentTick;
+
+					const uint64_t levelSpan = uint64_t{ 1 } << (cSlotBits * level);
+					return (mCurrentTick | (levelSpan - 1));
+				}
+			}
+			return std::numeric_limits<uint64_t>::max();
+		}
+
+		uint32_t AllocateNode()
+		{
+			if (!mFreeNodes.empty())
+			{
+				const uint32_t index = mFreeNodes.back();
+				mFreeNodes.pop_back();
+				return index;
+			}
+
+			mNodes.emplace_back();
+			return static_cast<uint32_t>(mNodes.size() - 1);
+		}
+
+		void FreeNode(uint32_t index)
+		{
+			Node& node = mNodes[index];
+			if (node.State != NodeState::Cancelled)
+			{
+				++node.Generation;
+			}
+			node.Payload = PayloadT{};
+			node.State = NodeState::Free;
+			mFreeNodes.push_back(index);
+		}
+
+		// @brief Picks the slot from the distance to the expiry: level N covers deltas below 256^(N+1).
+		void Link(uint32_t index)
+		{
+			Node& node = mNodes[index];
+			const uint64_t delta = node.Expiry > mCurrentTick ? node.Expiry - mCurrentTick : 0;
+			const uint64_t expiry = delta > cMaxDelta ? mCurrentTick + cMaxDelta : node.Expiry;	// Re-cascaded later
+
+			uint32_t level = 0;
+			while (level + 1 < cLevelCount && delta >= (uint64_t{ 1 } << (cSlotBits * (level + 1))))
+			{
+				++level;
+			}
+
+			const uint32_t slot = level * cSlotsPerLevel + static_cast<uint32_t>((expiry >> (cSlotBits * level)) & cSlotMask);
+
+			node.Slot = slot;
+			node.Prev = cNil;
+			node.Next = mSlotHeads[slot];
+			++mLevelCounts[level];
+			if (node.Next != cNil)
+			{
+				mNodes[node.Next].Prev = index;
+			}
+			mSlotHeads[slot] = index;
+		}
+
+		void Unlink(uint32_t index)
+		{
+			Node& node = mNodes[index];
+			if (node.Prev != cNil)
+			{
+				mNodes[node.Prev].Next = node.Next;
+			}
+			else
+			{
+				mSlotHeads[node.Slot] = node.Next;
+			}
+
+			if (node.Next != cNil)
+			{
+				mNodes[node.Next].Prev = node.Prev;
+			}
+
+			--mLevelCounts[node.Slot / cSlotsPerLevel];
+			node.Prev = cNil;
+			node.Next = cNil;
+			node.Slot = cNil;
+		}
+
+		// @brief Re-distributes the higher level slots that start at the current tick into lower levels.
+		void Cascade()
+		{
+			for (uint32_t level = 1; level < cLevelCount; ++level)
+			{
+				const uint32_t shift = cSlotBits * level;
+				if ((mCurrentTick & ((uint64_t{ 1 } << shift) - 1)) != 0)
+				{
+					break;
+				}
+
+				const uint32_t slot = level * cSlotsPerLevel + static_cast<uint32_t>((mCurrentTick >> shift) & cSlotMask);
+				uint32_t index = mSlotHeads[slot];
+				mSlotHeads[slot] = cNil;
+
+				while (index != cNil)
+				{
+					const uint32_t next = mNodes[index].Next;
+					--mLevelCounts[level];
+					Link(index);
+					index = next;
+				}
+			}
+		}
+
+		template<typename CallbackT>
+		void ExpireCurrentSlot(CallbackT& onExpired)
+		{
+			const uint32_t slot = static_cast<uint32_t>(mCurrentTick & cSlotMask);
+
+			// Detach the slot first: callbacks may schedule or cancel timers freely
+			mExpiring.clear();
+			for (uint32_t index = mSlotHeads[slot]; index != cNil; index = mNodes[index].Next)
+			{
+				mExpiring.push_back(index);
+			}
+			mLevelCounts[0] -= static_cast<uint32_t>(mExpiring.size());
+			for (uint32_t index : mExpiring)
+			{
+				Node& node = mNodes[index];
+				node.Prev = cNil;
+				node.Slot = cNil;
+				node.State = NodeState::Expiring;
+			}
+			mSlotHeads[slot] = cNil;
+
+			for (uint32_t index : mExpiring)
+			{
+				mNodes[index].Next = cNil;
+			}
+
+			for (uint32_t index : mExpiring)
+			{
+				if (mNodes[index].State == NodeState::Cancelled)
+				{
+					FreeNode(index);
+					continue;
+				}
+
+				// The pool may grow during the callback, so the payload is moved out of the node
+				const TimerHandle handle{ index, mNodes[index].Generation };
+				PayloadT payload = std::move(mNodes[index].Payload);
+				onExpired(handle, payload);
+
+				Node& node = mNodes[index];
+				if (node.State == NodeState::Cancelled)
+				{
+					FreeNode(index);
+				}
+				else if (node.Period > 0)
+				{
+					node.Payload = std::move(payload);
+					node.Expiry = mCurrentTick + node.Period;
+					node.State = NodeState::Linked;
+					Link(index);
+				}
+				else
+				{
+					FreeNode(index);
+					--mActiveCount;
+				}
+			}
+		}
+
+	private:
+		std::vector<Node> mNodes;
+		std::vector<uint32_t> mFreeNodes;
+		std::vector<uint32_t> mExpiring;							// Scratch list reused every tick
+		std::array<uint32_t, cLevelCount * cSlotsPerLevel> mSlotHeads;
+		std::array<uint32_t, cLevelCount> mLevelCounts{};			// Linked timers per level
+		uint64_t mCurrentTick{ 0 };
+		size_t mActiveCount{ 0 };
+		bool mAdvancing{ false };
+	};
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Work Stealing Deque
+	// ====================================================================================================
+
+	/**
+	 * @brief Lock-free Chase-Lev work-stealing deque of pointers (Le et al., "Correct and Efficient
+	 *        Work-Stealing for Weak Memory Models", 2013).
+	 *
+	 * The owner thread pushes and pops at the bottom (LIFO, cache-warm), any thread steals from the
+	 * top (FIFO, the oldest and usually largest work). The owner only races with thieves for the last
+	 * element. The ring grows on demand; retired rings are kept until destruction because a thief may
+	 * still read from them.
+	 */
+	template<typename T>
+	class WorkStealingDeque final : public NonCopyable
+	{
+		GOJO_STATIC_ASSERT(std::is_pointer_v<T>, "WorkStealingDeque stores pointers!");
+
+	public:
+		explicit WorkStealingDeque(size_t capacity = 1024)
+		{
+			mRings.push_back(std::make_unique<Ring>(std::bit_ceil(std::max<size_t>(capacity, 2))));
+			mRing.store(mRings.back().get(), std::memory_order_relaxed);
+		}
+
+		// @brief Owner thread only.
+		void Push(T value)
+		{
+			const int64_t bottom = mBottom.load(std::memory_order_relaxed);
+			const int64_t top = mTop.load(std::memory_order_acquire);
+			Ring* ring = mRing.load(std::memory_order_relaxed);
+
+			if (bottom - top > static_cast<int64_t>(ring->Mask))
+			{
+				ring = Grow(ring, top, bottom);
+			}
+
+			// Publishes the value (and what it points to) to the thieves
+			ring->Store(bottom, value);
+			mBottom.store(bottom + 1, std::memory_order_release);
+		}
+
+		// @brief Owner thread only. Takes the most recently pushed value.
+		// @return nullptr if the deque is empty.
+		T Pop()
+		{
+			const int64_t bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			Ring* ring = mRing.load(std::memory_order_relaxed);
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = mTop.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T value = ring->Load(bottom);
+			if (top == bottom)
+			{
+				// Last element, a thief may be taking it concurrently
+				if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					value = nullptr;
+				}
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return value;
+		}
+
+		// @brief Any thread. Takes the oldest value.
+		// @return nullptr if the deque is empty or another thread won the race for the value.
+		T Steal()
+		{
+			int64_t top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t bottom = mBottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return nullptr;
+
+			T value = mRing.load(std::memory_order_acquire)->Load(top);
+			if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				return nullptr;
+			}
+			return value;
+		}
+
+		// @brief Approximate, exact when no thread is pushing or taking.
+		[[nodiscard]] size_t GetSize() const
+		{
+			const int64_t size = mBottom.load(std::memory_order_relaxed) - mTop.load(std::memory_order_relaxed);
+			return size > 0 ? static_cast<size_t>(size) : 0;
+		}
+
+		[[nodiscard]] bool IsEmpty() const { return GetSize() == 0; }
+
+	private:
+		struct Ring
+		{
+			explicit Ring(size_t capacity)
+				: Mask(capacity - 1), Values(std::make_unique<std::atomic<T>[]>(capacity))
+			{
+			}
+
+			T Load(int64_t index) const { return Values[static_cast<size_t>(index) & Mask].load(std::memory_order_relaxed); }
+			void Store(int64_t index, T value) { Values[static_cast<size_t>(index) & Mask].store(value, std::memory_order_relaxed); }
+
+			size_t Mask;
+			std::unique_ptr<std::atomic<T>[]> Values;
+		};
+
+		Ring* Grow(Ring* ring, int64_t top, int64_t bottom)
+		{
+			auto grown = std::make_unique<Ring>((ring->Mask + 1) * 2);
+			for (int64_t index = top; index < bottom; ++index)
+			{
+				grown->Store(index, ring->Load(index));
+			}
+
+			Ring* result = grown.get();
+			mRings.push_back(std::move(grown));
+			mRing.store(result, std::memory_order_release);
+			return result;
+		}
+
+	private:
+		alignas(cCacheLineSize) std::atomic<int64_t> mTop{ 0 };		// Thieves
+		alignas(cCacheLineSize) std::atomic<int64_t> mBottom{ 0 };	// Owner
+		std::atomic<Ring*> mRing{ nullptr };
+		std::vector<std::unique_ptr<Ring>> mRings;													// Owner, current ring is the last
+	};
+}
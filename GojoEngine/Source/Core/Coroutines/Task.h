@@ -0,0 +1,185 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Memory/MemoryTracker.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace GojoEngine
+{
+	template<typename T = void>
+	class Task;
+
+	// ====================================================================================================
+	// Task Promise
+	// ====================================================================================================
+
+	/**
+	 * @brief Shared part of the task promises: tasks start suspended and resume their awaiter on completion.
+	 */
+	class TaskPromiseBase
+	{
+	public:
+		std::suspend_always initial_suspend() noexcept { return {}; }
+
+		auto final_suspend() noexcept { return FinalAwaiter{}; }
+
+		// The engine is built without exception handling in mind, an escaping exception is fatal
+		void unhandled_exception() noexcept { std::terminate(); }
+
+		void SetContinuation(std::coroutine_handle<> continuation) { mContinuation = continuation; }
+
+		// Coroutine frames are accounted to MemoryTag::Tasks
+		static void* operator new(size_t size) { return MemoryTracker::Allocate(size, alignof(std::max_align_t), GOJO_MEMORY_SITE(MemoryTag::Tasks)); }
+		static void operator delete(void* memory) noexcept { MemoryTracker::Free(memory); }
+
+	private:
+		struct FinalAwaiter
+		{
+			bool await_ready() noexcept { return false; }
+
+			// Symmetric transfer: resuming the awaiter does not grow the stack, however long the chain
+			template<typename PromiseT>
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> handle) noexcept
+			{
+				return static_cast<TaskPromiseBase&>(handle.promise()).mContinuation;
+			}
+
+			void await_resume() noexcept {}
+		};
+
+	private:
+		std::coroutine_handle<> mContinuation{ std::noop_coroutine() };
+	};
+
+	template<typename T>
+	class TaskPromise final : public TaskPromiseBase
+	{
+	public:
+		Task<T> get_return_object() noexcept;
+
+		template<typename ValueT>
+			requires std::is_convertible_v<ValueT&&, T>
+		void return_value(ValueT&& value) { mValue.emplace(std::forward<ValueT>(value)); }
+
+		T TakeResult() { return std::move(*mValue); }
+
+	private:
+		std::optional<T> mValue;
+	};
+
+	template<>
+	class TaskPromise<void> final : public TaskPromiseBase
+	{
+	public:
+		Task<void> get_return_object() noexcept;
+
+		void return_void() noexcept {}
+		void TakeResult() {}
+	};
+
+	// ====================================================================================================
+	// Task
+	// ====================================================================================================
+
+	/**
+	 * @brief Lazily started, move-only coroutine returning T.
+	 *
+	 * The body does not run until the task is awaited: "co_await std::move(task)" starts it and resumes the
+	 * awaiting coroutine, on whatever thread the task finished, with its result. A task destroyed
+	 * unawaited destroys its frame. Top-level tasks are started with TaskScheduler::Spawn().
+	 */
+	template<typename T>
+	class [[nodiscard]] Task final
+	{
+		GOJO_STATIC_ASSERT(!std::is_reference_v<T>, "Tasks return values, not references!");
+
+	public:
+		using promise_type = TaskPromise<T>;
+
+		Task() = default;
+
+		explicit Task(std::coroutine_handle<promise_type> handle)
+			: mHandle(handle)
+		{
+		}
+
+		Task(Task&& other) noexcept
+			: mHandle(std::exchange(other.mHandle, nullptr))
+		{
+		}
+
+		Task& operator=(Task&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Destroy();
+				mHandle = std::exchange(other.mHandle, nullptr);
+			}
+			return *this;
+		}
+
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+
+		~Task()
+		{
+			Destroy();
+		}
+
+		auto operator co_await() && noexcept
+		{
+			struct Awaiter
+			{
+				bool await_ready() noexcept { return !Handle || Handle.done(); }
+
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+				{
+					Handle.promise().SetContinuation(awaiting);
+					return Handle;
+				}
+
+				T await_resume()
+				{
+					GOJO_RUNTIME_ASSERT(Handle, "Awaiting an empty task!");
+					return Handle.promise().TakeResult();
+				}
+
+				std::coroutine_handle<promise_type> Handle;
+			};
+			return Awaiter{ mHandle };
+		}
+
+		[[nodiscard]] bool IsValid() const { return static_cast<bool>(mHandle); }
+		[[nodiscard]] bool IsDone() const { return mHandle && mHandle.done(); }
+
+	private:
+		void Destroy()
+		{
+			if (mHandle)
+			{
+				mHandle.destroy();
+				mHandle = nullptr;
+			}
+		}
+
+	private:
+		std::coroutine_handle<promise_type> mHandle;
+	};
+
+	template<typename T>
+	Task<T> TaskPromise<T>::get_return_object() noexcept
+	{
+		return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+	}
+
+	inline Task<void> TaskPromise<void>::get_return_object() noexcept
+	{
+		return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+	}
+}
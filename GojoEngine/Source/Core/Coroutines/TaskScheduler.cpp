@@ -0,0 +1,274 @@
+#include "Core/Coroutines/TaskScheduler.h"
+#include "Core/Containers/MPSCQueue.h"
+#include "Core/Memory/FrameAllocator.h"
+#include "Core/Profiler/Profiler.h"
+#include "Managers/JobSystem/JobSystem.h"
+#include "Managers/LogManager/LogManager.h"
+#include "Managers/WindowManager/WindowManager.h"
+
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		struct ScheduledResume
+		{
+			std::coroutine_handle<> Handle;
+			Delegate<bool()> Condition;					// Empty: resume at the next frame boundary
+		};
+
+		// @brief Spawned tasks that did not finish yet, by coroutine frame address.
+		struct RootRegistry
+		{
+			void Add(std::coroutine_handle<> root)
+			{
+				std::lock_guard lock(Mutex);
+				Roots.insert(root.address());
+			}
+
+			void Release(std::coroutine_handle<> root)
+			{
+				std::lock_guard lock(Mutex);
+				Roots.erase(root.address());
+			}
+
+			mutable std::mutex Mutex;
+			std::unordered_set<void*> Roots;
+		};
+
+		/**
+		 * @brief Coroutine that owns a spawned task. It starts suspended so it can be registered first and
+		 * unregisters and destroys itself when the task finished.
+		 */
+		class RootTask final
+		{
+		public:
+			class promise_type
+			{
+			public:
+				RootTask get_return_object() noexcept { return RootTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+				std::suspend_always initial_suspend() noexcept { return {}; }
+
+				auto final_suspend() noexcept
+				{
+					struct FinalAwaiter
+					{
+						bool await_ready() noexcept { return false; }
+						void await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+						{
+							handle.promise().Registry->Release(handle);
+							handle.destroy();
+						}
+						void await_resume() noexcept {}
+					};
+					return FinalAwaiter{};
+				}
+
+				void return_void() noexcept {}
+				void unhandled_exception() noexcept { std::terminate(); }
+
+				RootRegistry* Registry{ nullptr };
+			};
+
+			explicit RootTask(std::coroutine_handle<promise_type> handle) : Handle(handle) {}
+
+			std::coroutine_handle<promise_type> Handle;
+		};
+
+		RootTask RunRoot(Task<void> task)
+		{
+			co_await std::move(task);
+		}
+	}
+
+	// ====================================================================================================
+	// TaskScheduler Implementation (PIMPL)
+	// ====================================================================================================
+
+	class TaskScheduler::Impl
+	{
+	public:
+		Impl()
+			: mMainThreadId(std::this_thread::get_id())
+		{
+		}
+
+		void Spawn(Task<void>&& task)
+		{
+			RootTask root = RunRoot(std::move(task));
+			root.Handle.promise().Registry = &mRoots;
+			mRoots.Add(root.Handle);
+			root.Handle.resume();
+		}
+
+		void ResumeFrameTasks()
+		{
+			GOJO_PROFILE_SCOPE("TaskScheduler::ResumeFrameTasks");
+
+			// Collect first: coroutines suspending again during this pass wait for the next frame
+			std::pmr::vector<std::coroutine_handle<>> resumes(FrameAllocator::GetInstance().GetResource());
+			ScheduledResume scheduled;
+			while (mMainThreadQueue.TryPop(scheduled))
+			{
+				if (scheduled.Condition)
+				{
+					mPolledResumes.push_back(std::move(scheduled));
+				}
+				else
+				{
+					resumes.push_back(scheduled.Handle);
+				}
+			}
+
+			std::erase_if(mPolledResumes, [&resumes](const ScheduledResume& polled)
+				{
+					if (!polled.Condition())
+						return false;
+
+					resumes.push_back(polled.Handle);
+					return true;
+				});
+
+			for (std::coroutine_handle<> handle : resumes)
+			{
+				handle.resume();
+			}
+		}
+
+		void ScheduleOnWorker(std::coroutine_handle<> handle)
+		{
+			JobSystem::GetInstance().Run([handle]() { handle.resume(); }, &mWorkerResumes);
+		}
+
+		void ScheduleOnMainThread(std::coroutine_handle<> handle, Delegate<bool()>&& condition)
+		{
+			mMainThreadQueue.Push(ScheduledResume{ handle, std::move(condition) });
+
+			// The main loop may block on OS events while no window is active
+			if (!IsMainThread())
+			{
+				if (WindowManager* windowManager = WindowManager::GetPtr())
+				{
+					windowManager->WakeUp();
+				}
+			}
+		}
+
+		void ShutDown()
+		{
+			// Coroutines may hop between workers for a while, they stop once they wait for the main thread
+			JobSystem::GetInstance().Wait(mWorkerResumes);
+
+			std::lock_guard lock(mRoots.Mutex);
+			if (!mRoots.Roots.empty())
+			{
+				GOJO_LOG_INFO("TaskScheduler", "Destroying {} unfinished tasks", mRoots.Roots.size());
+			}
+
+			// Destroying a root destroys the frames of the tasks it awaits, the queued handles die with them
+			for (void* root : mRoots.Roots)
+			{
+				std::coroutine_handle<>::from_address(root).destroy();
+			}
+			mRoots.Roots.clear();
+		}
+
+		[[nodiscard]] bool IsMainThread() const { return std::this_thread::get_id() == mMainThreadId; }
+
+		[[nodiscard]] size_t GetPendingTaskCount() const
+		{
+			std::lock_guard lock(mRoots.Mutex);
+			return mRoots.Roots.size();
+		}
+
+	private:
+		std::thread::id mMainThreadId;
+
+		MPSCQueue<ScheduledResume> mMainThreadQueue;
+		std::vector<ScheduledResume> mPolledResumes;		// Main thread only
+
+		JobCounter mWorkerResumes;
+
+		RootRegistry mRoots;
+	};
+
+	// ====================================================================================================
+	// TaskScheduler
+	// ====================================================================================================
+
+	TaskScheduler::TaskScheduler()
+		: pImpl(std::make_unique<Impl>())
+	{
+	}
+
+	TaskScheduler::~TaskScheduler()
+	{
+		pImpl->ShutDown();
+	}
+
+	void TaskScheduler::Spawn(Task<void> task)
+	{
+		pImpl->Spawn(std::move(task));
+	}
+
+	void TaskScheduler::ResumeFrameTasks()
+	{
+		pImpl->ResumeFrameTasks();
+	}
+
+	void TaskScheduler::ScheduleOnWorker(std::coroutine_handle<> handle)
+	{
+		pImpl->ScheduleOnWorker(handle);
+	}
+
+	void TaskScheduler::ScheduleOnMainThread(std::coroutine_handle<> handle)
+	{
+		pImpl->ScheduleOnMainThread(handle, {});
+	}
+
+	void TaskScheduler::ScheduleWhen(std::coroutine_handle<> handle, Delegate<bool()> condition)
+	{
+		pImpl->ScheduleOnMainThread(handle, std::move(condition));
+	}
+
+	bool TaskScheduler::IsMainThread() const
+	{
+		return pImpl->IsMainThread();
+	}
+
+	size_t TaskScheduler::GetPendingTaskCount() const
+	{
+		return pImpl->GetPendingTaskCount();
+	}
+
+	// ====================================================================================================
+	// Asynchronous File Reading
+	// ====================================================================================================
+
+	Task<std::expected<std::vector<std::byte>, FileReadError>> ReadFileAsync(std::filesystem::path path)
+	{
+		co_await ResumeOnWorker();
+
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			co_return std::unexpected(FileReadError::OpenFailed);
+		}
+
+		std::vector<std::byte> data(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		if (!file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size())))
+		{
+			co_return std::unexpected(FileReadError::ReadFailed);
+		}
+
+		co_return data;
+	}
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Delegate.h"
+#include "Core/Coroutines/Task.h"
+#include "Managers/Manager.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Task Scheduler
+	// ====================================================================================================
+
+	/**
+	 * @brief Runs coroutine tasks on the job system workers and at the frame boundaries of the engine loop.
+	 *
+	 * Started and ticked by the engine (ResumeFrameTasks() once per frame on the main thread). Coroutines
+	 * move between threads with the awaitables below: ResumeOnWorker() continues on a job system worker,
+	 * ResumeOnMainThread() and NextFrame() at the next frame boundary, WaitUntil() polls a condition
+	 * there (GPU fences, streaming state). At ShutDown() the tasks running on workers are waited for and
+	 * the suspended ones are destroyed.
+	 */
+	class GOJO_API TaskScheduler final : public Manager<TaskScheduler>
+	{
+		friend class Manager<TaskScheduler>;
+
+	public:
+		// @brief Starts a top-level task on the calling thread, the task owns itself until it finished.
+		void Spawn(Task<void> task);
+
+		// @brief Resumes the coroutines waiting for the frame boundary. Main thread, once per frame.
+		void ResumeFrameTasks();
+
+		void ScheduleOnWorker(std::coroutine_handle<> handle);
+		void ScheduleOnMainThread(std::coroutine_handle<> handle);
+		void ScheduleWhen(std::coroutine_handle<> handle, Delegate<bool()> condition);
+
+		[[nodiscard]] bool IsMainThread() const;
+
+		// @brief Spawned tasks that did not finish yet.
+		[[nodiscard]] size_t GetPendingTaskCount() const;
+
+	private:
+		TaskScheduler();
+		~TaskScheduler();
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+	};
+
+	// ====================================================================================================
+	// Awaitables
+	// ====================================================================================================
+
+	// @brief Continues the coroutine on a job system worker.
+	[[nodiscard]] inline auto ResumeOnWorker()
+	{
+		struct Awaiter
+		{
+			bool await_ready() const noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) const { TaskScheduler::GetInstance().ScheduleOnWorker(handle); }
+			void await_resume() const noexcept {}
+		};
+		return Awaiter{};
+	}
+
+	// @brief Continues the coroutine on the main thread, immediately if it already runs there.
+	[[nodiscard]] inline auto ResumeOnMainThread()
+	{
+		struct Awaiter
+		{
+			bool await_ready() const { return TaskScheduler::GetInstance().IsMainThread(); }
+			void await_suspend(std::coroutine_handle<> handle) const { TaskScheduler::GetInstance().ScheduleOnMainThread(handle); }
+			void await_resume() const noexcept {}
+		};
+		return Awaiter{};
+	}
+
+	// @brief Continues the coroutine on the main thread at the next frame boundary.
+	[[nodiscard]] inline auto NextFrame()
+	{
+		struct Awaiter
+		{
+			bool await_ready() const noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) const { TaskScheduler::GetInstance().ScheduleOnMainThread(handle); }
+			void await_resume() const noexcept {}
+		};
+		return Awaiter{};
+	}
+
+	// @brief Continues the coroutine on the main thread at the first frame boundary where condition() is true.
+	//        The condition is only evaluated on the main thread, once per frame.
+	[[nodiscard]] inline auto WaitUntil(Delegate<bool()> condition)
+	{
+		struct Awaiter
+		{
+			bool await_ready() const noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) { TaskScheduler::GetInstance().ScheduleWhen(handle, std::move(Condition)); }
+			void await_resume() const noexcept {}
+
+			Delegate<bool()> Condition;
+		};
+		return Awaiter{ std::move(condition) };
+	}
+
+	// ====================================================================================================
+	// Asynchronous File Reading
+	// ====================================================================================================
+
+	enum class FileReadError
+	{
+		OpenFailed,
+		ReadFailed
+	};
+
+	// @brief Reads a whole file on a job system worker, the awaiting coroutine continues on that worker.
+	GOJO_API Task<std::expected<std::vector<std::byte>, FileReadError>> ReadFileAsync(std::filesystem::path path);
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Core/Macros.h"
+
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace GojoEngine
+{
+	// @brief Inline storage size used by delegates unless specified otherwise.
+	constexpr size_t cDefaultDelegateCapacity = 48;
+
+	template<typename SignatureT, size_t CapacityT = cDefaultDelegateCapacity>
+	class Delegate;
+
+	/**
+	 * @brief Small-buffer-only replacement for std::function.
+	 *
+	 * The callable is always stored inline (never on the heap), invoking it costs a single
+	 * indirect call. Callables that do not fit into CapacityT bytes are rejected at compile time,
+	 * capture by pointer/reference or raise the capacity in that case.
+	 */
+	template<typename ReturnT, typename... ArgsT, size_t CapacityT>
+	class Delegate<ReturnT(ArgsT...), CapacityT> final
+	{
+	public:
+		Delegate() = default;
+		Delegate(std::nullptr_t) {}
+
+		template<typename CallableT>
+			requires (!std::same_as<std::remove_cvref_t<CallableT>, Delegate>)
+				  && std::copy_constructible<std::decay_t<CallableT>>
+				  && std::is_invocable_r_v<ReturnT, std::decay_t<CallableT>&, ArgsT...>
+		Delegate(CallableT&& callable)
+		{
+			using StoredT = std::decay_t<CallableT>;
+
+			GOJO_STATIC_ASSERT(sizeof(StoredT) <= CapacityT, "Callable does not fit into the delegate inline storage!");
+			GOJO_STATIC_ASSERT(alignof(StoredT) <= alignof(std::max_align_t), "Callable is over-aligned for the delegate storage!");
+			GOJO_STATIC_ASSERT(std::is_nothrow_move_constructible_v<StoredT>, "Callable must be nothrow move constructible!");
+
+			::new (static_cast<void*>(mStorage)) StoredT(std::forward<CallableT>(callable));
+			mInvoke = &Invoke<StoredT>;
+			mManage = &Manage<StoredT>;
+		}
+
+		Delegate(const Delegate& other)
+		{
+			CopyFrom(other);
+		}
+
+		Delegate(Delegate&& other) noexcept
+		{
+			MoveFrom(other);
+		}
+
+		Delegate& operator=(const Delegate& other)
+		{
+			if (this != &other)
+			{
+				Reset();
+				CopyFrom(other);
+			}
+			return *this;
+		}
+
+		Delegate& operator=(Delegate&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Reset();
+				MoveFrom(other);
+			}
+			return *this;
+		}
+
+		~Delegate()
+		{
+			Reset();
+		}
+
+		ReturnT operator()(ArgsT... args) const
+		{
+			GOJO_RUNTIME_ASSERT(mInvoke, "Invoking an empty delegate!");
+			return mInvoke(mStorage, std::forward<ArgsT>(args)...);
+		}
+
+		void Reset()
+		{
+			if (mManage)
+			{
+				mManage(Operation::Destroy, mStorage, nullptr);
+			}
+			mInvoke = nullptr;
+			mManage = nullptr;
+		}
+
+		[[nodiscard]] explicit operator bool() const { return mInvoke != nullptr; }
+
+	private:
+		enum class Operation { Copy, Move, Destroy };
+
+		using InvokeFn = ReturnT(*)(void*, ArgsT...);
+		using ManageFn = void(*)(Operation, void*, void*);
+
+		template<typename StoredT>
+		static ReturnT Invoke(void* storage, ArgsT... args)
+		{
+			return (*std::launder(static_cast<StoredT*>(storage)))(std::forward<ArgsT>(args)...);
+		}
+
+		template<typename StoredT>
+		static void Manage(Operation operation, void* destination, void* source)
+		{
+			switch (operation)
+			{
+			case Operation::Copy:
+				::new (destination) StoredT(*std::launder(static_cast<const StoredT*>(source)));
+				break;
+			case Operation::Move:
+				::new (destination) StoredT(std::move(*std::launder(static_cast<StoredT*>(source))));
+				std::launder(static_cast<StoredT*>(source))->~StoredT();
+				break;
+			case Operation::Destroy:
+				std::launder(static_cast<StoredT*>(destination))->~StoredT();
+				break;
+			}
+		}
+
+		void CopyFrom(const Delegate& other)
+		{
+			if (other.mManage)
+			{
+				other.mManage(Operation::Copy, mStorage, other.mStorage);
+				mInvoke = other.mInvoke;
+				mManage = other.mManage;
+			}
+		}
+
+		void MoveFrom(Delegate& other)
+		{
+			if (other.mManage)
+			{
+				other.mManage(Operation::Move, mStorage, other.mStorage);
+				mInvoke = other.mInvoke;
+				mManage = other.mManage;
+				other.mInvoke = nullptr;
+				other.mManage = nullptr;
+			}
+		}
+
+	private:
+		alignas(std::max_align_t) mutable std::byte mStorage[CapacityT];
+		InvokeFn mInvoke{ nullptr };
+		ManageFn mManage{ nullptr };
+	};
+}
\ No newline at end of file
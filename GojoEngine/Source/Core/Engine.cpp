@@ -1,15 +1,136 @@
 #include "Core/Engine.h"
+#include "Core/Coroutines/TaskScheduler.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiler/Profiler.h"
+#include "Core/StartupGraph.h"
+#include "Managers/FlightRecorder/FlightRecorder.h"
 #include "Managers/LogManager/LogManager.h"
+#include "Managers/MetricsExporter/MetricsExporter.h"
 #include "Managers/WindowManager/WindowManager.h"	   
 #include "Managers/EventManager/EventManager.h"
 #include "Managers/EventManager/Events/WindowEvents.h"
 
 #include "Platform/Vulkan/VulkanGraphicsContext.h"
 
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
 namespace GojoEngine
 {
 
 	std::shared_ptr<VulkanGraphicsContext> mContext;
+	std::unique_ptr<FramePacer> mFramePacer;
+	std::unique_ptr<FrameLoop> mFrameLoop;
+	std::filesystem::path mTracePath;
+	std::unique_ptr<StartupGraph> mStartupGraph;
+	EngineRunLimits mRunLimits;
+	bool mHeadless{ false };
+	std::atomic<bool> mExitRequested{ false };
+
+	namespace
+	{
+		// @brief Lets a build farm run any engine application headless without rebuilding it.
+		constexpr const char* cHeadlessVariable = "GOJO_HEADLESS";
+
+		bool IsHeadlessForcedByEnvironment()
+		{
+			const char* value = std::getenv(cHeadlessVariable);
+			return value && *value && std::strcmp(value, "0") != 0;
+		}
+
+		bool ShouldKeepRunning(const WindowManager& windowManager, uint64_t frameCount, std::chrono::steady_clock::time_point runStart)
+		{
+			if (mExitRequested.load(std::memory_order_relaxed))
+				return false;
+
+			// A headless run may have no window at all, it ends on a limit or RequestExit()
+			if (!mHeadless && windowManager.AreAllWindowsClosed())
+				return false;
+
+			return !mRunLimits.IsReached(frameCount, std::chrono::steady_clock::now() - runStart);
+		}
+
+		/**
+		 * @brief Written once the workers are gone, right before the logger stops: the profiler capture
+		 * and the memory report, where everything but the logger is released.
+		 */
+		void ReportBeforeLoggerShutDown()
+		{
+			if (Profiler::IsCapturing() && !mTracePath.empty())
+			{
+				Profiler::StopCapture();
+				if (Profiler::ExportChromeTrace(mTracePath))
+				{
+					GOJO_LOG_INFO("Engine", "Profiler capture written to '{}'", mTracePath.string());
+				}
+				else
+				{
+					GOJO_LOG_ERROR("Engine", "Failed to write the profiler capture to '{}'", mTracePath.string());
+				}
+			}
+			Profiler::StopCapture();
+			Profiler::ReleaseMemory();
+
+			MemoryTracker::LogReport();
+		}
+
+		/**
+		 * @brief The engine managers and what they need. GLFW, the JobSystem (its starting thread becomes
+		 * context 0) and the TaskScheduler (it remembers the main thread) are bound to the main thread;
+		 * the Vulkan instance does not depend on any of them and is created on a worker meanwhile (it lists
+		 * the JobSystem so it is not started inline before the workers exist).
+		 */
+		void AddEngineStages(StartupGraph& graph, const EngineSettings& settings)
+		{
+			graph.Add({ "FlightRecorder", {}, StartupThread::Main,
+				[]() { FlightRecorder::StartUp(); },
+				[]() { FlightRecorder::ShutDown(); } });
+
+			graph.Add({ "LogManager", { "FlightRecorder" }, StartupThread::Main,
+				[]() { LogManager::StartUp(); },
+				[]() { ReportBeforeLoggerShutDown(); LogManager::ShutDown(); } });
+
+			graph.Add({ "MetricsExporter", { "LogManager" }, StartupThread::Any,
+				[&settings]() { MetricsExporter::StartUp(settings.Metrics); },
+				[]() { MetricsExporter::ShutDown(); } });
+
+			graph.Add({ "JobSystem", { "LogManager" }, StartupThread::Main,
+				[&settings]() { JobSystem::StartUp(settings.Jobs); },
+				[]() { JobSystem::ShutDown(); } });
+
+			graph.Add({ "FrameAllocator", { "LogManager" }, StartupThread::Any,
+				[&settings]() { FrameAllocator::StartUp(settings.FrameMemory); },
+				[]() { FrameAllocator::ShutDown(); } });
+
+			graph.Add({ "TaskScheduler", { "JobSystem", "FrameAllocator" }, StartupThread::Main,
+				[]() { TaskScheduler::StartUp(); },
+				[]() { TaskScheduler::ShutDown(); } });
+
+			graph.Add({ "WindowManager", { "LogManager" }, StartupThread::Main,
+				[]() { WindowManager::StartUp(WindowManagerSettings{ mHeadless }); },
+				[]() { WindowManager::ShutDown(); } });
+
+			graph.Add({ "EventManager", { "LogManager", "WindowManager" }, StartupThread::Any,
+				[]() { EventManager::StartUp(); },
+				[]() { EventManager::ShutDown(); } });
+
+			graph.Add({ "VulkanGraphicsContext", { "LogManager", "JobSystem" }, StartupThread::Any,
+				[]() { mContext = std::make_shared<VulkanGraphicsContext>(VulkanContextSettings{ mHeadless }); mContext->StartUp(); },
+				[]() { mContext->ShutDown(); mContext.reset(); } });
+		}
+
+		size_t GetTrackedMemoryBytes()
+		{
+			size_t bytes = 0;
+			for (size_t tag = 0; tag < static_cast<size_t>(MemoryTag::Count); ++tag)
+			{
+				bytes += MemoryTracker::GetTagStats(static_cast<MemoryTag>(tag)).CurrentBytes;
+			}
+			return bytes;
+		}
+	}
 
 	Engine& Engine::GetInstance()
 	{
@@ -17,38 +138,180 @@ namespace GojoEngine
 		return engine;
 	}
 
-	void Engine::StartUp()
+	std::expected<void, StartupError> Engine::StartUp(const EngineSettings& settings)
 	{
-		LogManager::StartUp();		GOJO_LOG_INFO("Engine", "LogManager StartUp complete!");
-		WindowManager::StartUp();	GOJO_LOG_INFO("Engine", "WindowManager StartUp complete!");
-		EventManager::StartUp();	GOJO_LOG_INFO("Engine", "EventManager StartUp complete!");
+		mTracePath = settings.Profiling.TracePath;
+		mRunLimits = settings.RunLimits;
+		mHeadless = settings.Headless || IsHeadlessForcedByEnvironment();
+		mExitRequested.store(false, std::memory_order_relaxed);
+		if (settings.Profiling.CaptureOnStartUp)
+		{
+			Profiler::StartCapture();
+		}
+		Profiler::SetThreadName("Main Thread");
+
+		GOJO_PROFILE_SCOPE("Engine::StartUp");
+
+		mStartupGraph = std::make_unique<StartupGraph>();
+		AddEngineStages(*mStartupGraph, settings);
+		for (const StartupStage& stage : settings.AdditionalStages)
+		{
+			mStartupGraph->Add(stage);
+		}
 
-		mContext = std::make_shared<VulkanGraphicsContext>();
-		mContext->StartUp();
+		// Validated before anything runs, not even the logger is up on failure
+		if (const auto result = mStartupGraph->StartUp(); !result)
+		{
+			std::fprintf(stderr, "Engine startup graph is invalid (error %d), nothing was started\n", static_cast<int>(result.error()));
+			mStartupGraph.reset();
+			return std::unexpected(result.error());
+		}
+		mStartupGraph->LogReport();
+
+		mFramePacer = std::make_unique<FramePacer>(settings.FramePacing);
+		mFrameLoop = std::make_unique<FrameLoop>(settings.FixedTimestep);
 
 		GOJO_LOG_INFO("Engine", "Engine StartUp complete!");
+		return {};
 	}
 
 	void Engine::Run()
 	{
+		// StartUp() failed, none of the managers exist
+		if (!mStartupGraph)
+			return;
+
 		auto& windowManager = WindowManager::GetInstance();
+		auto& eventManager = EventManager::GetInstance();
+		auto& flightRecorder = FlightRecorder::GetInstance();
+		auto& taskScheduler = TaskScheduler::GetInstance();
+		auto& frameAllocator = FrameAllocator::GetInstance();
+
+		if (mHeadless && mRunLimits.MaxFrames == 0 && mRunLimits.MaxDuration.count() == 0)
+		{
+			GOJO_LOG_INFO("Engine", "Headless run without a frame or time limit, only Engine::RequestExit() ends it");
+		}
+
+		const auto runStart = std::chrono::steady_clock::now();
+		uint64_t frameCount = 0;
 
 		GOJO_LOG_INFO("Engine", "Entering Main Loop...");
-		while (!windowManager.AreAllWindowsClosed())
+		while (ShouldKeepRunning(windowManager, frameCount, runStart))
+		{
+			mFramePacer->BeginFrame();
+			frameAllocator.BeginFrame();
+			flightRecorder.MarkFrame();
+			GOJO_PROFILE_FRAME(frameAllocator.GetFrameIndex());
+			GOJO_PROFILE_SCOPE("Engine::Frame");
+
+			// Nothing to present without an active window: sleep until the OS has something for us.
+			// Headless windows are never focused, those runs always go at the paced rate
+			if (!mHeadless && windowManager.AreAllWindowsInactive())
+			{
+				windowManager.WaitEvents(mFramePacer->GetIdleWaitTimeout());
+				mFramePacer->MarkIdleFrame();
+				flightRecorder.MarkIdleFrame();
+			}
+			else
+			{
+				windowManager.PollEvents();
+			}
+
+			// Queued (and coalesced) events are delivered before closed windows are cleaned up,
+			// so window listeners still receive their final events
+			eventManager.DispatchEventsInQueue();
+			windowManager.CleanupClosedWindows();
+
+			// Coroutines waiting for the frame boundary see this frame's events
+			taskScheduler.ResumeFrameTasks();
+
+			// Fixed steps, then Update and Render with the interpolation alpha
+			mFrameLoop->Tick();
+
+			if (Profiler::IsCapturing())
+			{
+				GOJO_PROFILE_COUNTER("Pending tasks", taskScheduler.GetPendingTaskCount());
+				GOJO_PROFILE_COUNTER("Tracked memory (KiB)", GetTrackedMemoryBytes() / 1024);
+			}
+
+			mFramePacer->EndFrame();
+			++frameCount;
+		}
+
+		GOJO_LOG_INFO("Engine", "Main loop ran {} frames in {:.2f} s", frameCount,
+			std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count());
+
+		const FrameStats stats = mFramePacer->GetFrameStats();
+		GOJO_LOG_INFO("Engine", "Frame times over the last {} frames: average {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms",
+			stats.SampleCount, stats.AverageMs, stats.P99Ms, stats.MaxMs);
+
+		const FrameAllocatorStats memoryStats = frameAllocator.GetStats();
+		GOJO_LOG_INFO("Engine", "Frame memory high-water marks over {} threads: {} / {} bytes per frame, {} / {} bytes double-buffered, {} overflows",
+			memoryStats.ThreadCount, memoryStats.FrameHighWaterMark, memoryStats.FrameArenaSize,
+			memoryStats.DoubleBufferedHighWaterMark, memoryStats.DoubleBufferedArenaSize, memoryStats.OverflowCount);
+
+		if (const uint64_t droppedSteps = mFrameLoop->GetDroppedStepCount(); droppedSteps > 0)
 		{
-			windowManager.OnUpdate();
+			GOJO_LOG_INFO("Engine", "{} fixed steps were dropped to keep the simulation from falling behind", droppedSteps);
 		}
 	}
 
 	void Engine::ShutDown()
 	{
+		if (!mStartupGraph)
+			return;
+
 		GOJO_LOG_INFO("Engine", "Engine ShutDown...");
 
-		mContext->ShutDown();
+		// The logger stage shuts down last but one and reports on everything else on its way out
+		mStartupGraph->ShutDown();
+		mStartupGraph.reset();
+
+		mFrameLoop.reset();
+		mFramePacer.reset();
+	}
+
+	void Engine::RequestExit()
+	{
+		mExitRequested.store(true, std::memory_order_relaxed);
+	}
+
+	bool Engine::IsHeadless()
+	{
+		return mHeadless;
+	}
+
+	void Engine::SetTargetFrameRate(uint32_t framesPerSecond)
+	{
+		GOJO_ASSERT_MESSAGE(mFramePacer, "Engine::SetTargetFrameRate called before StartUp()!");
+		mFramePacer->SetTargetFrameRate(framesPerSecond);
+	}
+
+	std::span<const StartupTiming> Engine::GetStartupTimings()
+	{
+		return mStartupGraph ? mStartupGraph->GetTimings() : std::span<const StartupTiming>();
+	}
+
+	FrameStats Engine::GetFrameStats()
+	{
+		return mFramePacer ? mFramePacer->GetFrameStats() : FrameStats{};
+	}
+
+	PhaseCallbackId Engine::AddPhaseCallback(EnginePhase phase, PhaseCallback callback)
+	{
+		GOJO_ASSERT_MESSAGE(mFrameLoop, "Engine::AddPhaseCallback called before StartUp()!");
+		return mFrameLoop->AddCallback(phase, std::move(callback));
+	}
+
+	bool Engine::RemovePhaseCallback(PhaseCallbackId id)
+	{
+		return mFrameLoop ? mFrameLoop->RemoveCallback(id) : false;
+	}
 
-		EventManager::ShutDown();
-		WindowManager::ShutDown();
-		LogManager::ShutDown();
+	const FrameTime& Engine::GetFrameTime()
+	{
+		static const FrameTime cEmptyFrameTime;
+		return mFrameLoop ? mFrameLoop->GetFrameTime() : cEmptyFrameTime;
 	}
 
 }
\ No newline at end of file
@@ -2,22 +2,79 @@
 
 #include "Utility.h"
 #include "Core/Macros.h"
+#include "Core/FramePacer.h"
+#include "Core/FrameLoop.h"
+#include "Core/Memory/FrameAllocator.h"
+#include "Core/Profiler/Profiler.h"
+#include "Core/StartupGraph.h"
+#include "Managers/JobSystem/JobSystem.h"
+#include "Managers/MetricsExporter/MetricsExporter.h"
 #include "Platform/Vulkan/VulkanGraphicsContext.h"
 
+#include <chrono>
+#include <expected>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace GojoEngine
 {
 
+	// @brief Run() returns after whichever limit is reached first. 0 disables a limit.
+	struct EngineRunLimits
+	{
+		uint64_t MaxFrames{ 0 };
+		std::chrono::milliseconds MaxDuration{ 0 };
+
+		// @brief True once "frameCount" frames ran or "elapsed" reached the duration limit.
+		[[nodiscard]] bool IsReached(uint64_t frameCount, std::chrono::steady_clock::duration elapsed) const
+		{
+			return (MaxFrames > 0 && frameCount >= MaxFrames) || (MaxDuration.count() > 0 && elapsed >= MaxDuration);
+		}
+	};
+
+	struct EngineSettings
+	{
+		// GLFW null platform and a software Vulkan device (lavapipe) when available, for benchmarks and CI.
+		// Run() does not stop when no window is open. Forced by a GOJO_HEADLESS environment variable other than "0".
+		bool Headless{ false };
+		EngineRunLimits RunLimits;
+		FramePacerSettings FramePacing;
+		FixedTimestepSettings FixedTimestep;
+		JobSystemSettings Jobs;
+		FrameAllocatorSettings FrameMemory;
+		ProfilerSettings Profiling;
+		MetricsExporterSettings Metrics;
+		std::vector<StartupStage> AdditionalStages;		// Client subsystems, may depend on the engine stages by name
+	};
+
 	class GOJO_API Engine final : public NonCopyable
 	{
 	public:
 		static Engine& GetInstance();
 
-		static void StartUp();
+		// @brief Fails without starting anything when the startup graph is invalid, Run() and ShutDown() are no-ops then.
+		[[nodiscard]] static std::expected<void, StartupError> StartUp(const EngineSettings& settings = {});
 		static void Run();
 		static void ShutDown();
 
+		// @brief Makes Run() return after the current frame. Any thread.
+		static void RequestExit();
+		[[nodiscard]] static bool IsHeadless();
+
+		// @brief 0 runs uncapped. Idle frames (no active window) always block on events instead.
+		static void SetTargetFrameRate(uint32_t framesPerSecond);
+		[[nodiscard]] static FrameStats GetFrameStats();
+
+		// @brief How long every startup stage took (cold-start regressions show up here). Valid until ShutDown().
+		[[nodiscard]] static std::span<const StartupTiming> GetStartupTimings();
+
+		// @brief Game code hooks into the frame here: FixedUpdate at the fixed rate, Update and Render
+		//        once per frame after the events were dispatched. Valid between StartUp() and ShutDown().
+		static PhaseCallbackId AddPhaseCallback(EnginePhase phase, PhaseCallback callback);
+		static bool RemovePhaseCallback(PhaseCallbackId id);
+		[[nodiscard]] static const FrameTime& GetFrameTime();
+
 	private:
 		Engine() = default;
 		~Engine() = default;
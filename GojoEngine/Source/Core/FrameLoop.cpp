@@ -0,0 +1,153 @@
+#include "Core/FrameLoop.h"
+#include "Managers/LogManager/LogManager.h"
+#include "Core/Profiler/Profiler.h"
+
+#include <algorithm>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// FrameLoop
+	// ====================================================================================================
+
+	FrameLoop::FrameLoop(const FixedTimestepSettings& settings)
+		: mSettings(settings)
+	{
+		mSettings.UpdateRate = std::max(mSettings.UpdateRate, 1u);
+		mSettings.MaxStepsPerFrame = std::max(mSettings.MaxStepsPerFrame, 1u);
+
+		mFixedDelta = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds(1)) / mSettings.UpdateRate;
+		mFrameTime.FixedDeltaSeconds = std::chrono::duration<double>(mFixedDelta).count();
+	}
+
+	PhaseCallbackId FrameLoop::AddCallback(EnginePhase phase, PhaseCallback callback)
+	{
+		GOJO_ASSERT_MESSAGE(phase < EnginePhase::Count, "Invalid engine phase!");
+
+		const PhaseCallbackId id = mNextCallbackId++;
+		CallbackEntry entry{ id, std::move(callback) };
+
+		// Growing a vector that is being iterated would move the running callback
+		if (mRunningDepth > 0)
+		{
+			mPendingCallbacks.emplace_back(phase, std::move(entry));
+		}
+		else
+		{
+			mCallbacks[static_cast<size_t>(phase)].push_back(std::move(entry));
+		}
+
+		return id;
+	}
+
+	bool FrameLoop::RemoveCallback(PhaseCallbackId id)
+	{
+		if (id == cInvalidPhaseCallbackId)
+			return false;
+
+		if (auto it = std::ranges::find(mPendingCallbacks, id, [](const auto& pending) { return pending.second.Id; }); it != mPendingCallbacks.end())
+		{
+			mPendingCallbacks.erase(it);
+			return true;
+		}
+
+		for (auto& callbacks : mCallbacks)
+		{
+			if (auto it = std::ranges::find(callbacks, id, &CallbackEntry::Id); it != callbacks.end())
+			{
+				// Only unlinked here, the slot is compacted once no phase is running
+				it->Id = cInvalidPhaseCallbackId;
+				mHasRemovedCallbacks = true;
+				if (mRunningDepth == 0)
+				{
+					FlushPendingChanges();
+				}
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void FrameLoop::Tick()
+	{
+		const auto now = std::chrono::steady_clock::now();
+		const auto elapsed = mHasTicked ? now - mLastTick : std::chrono::steady_clock::duration::zero();
+		mLastTick = now;
+		mHasTicked = true;
+
+		Tick(elapsed);
+	}
+
+	void FrameLoop::Tick(std::chrono::steady_clock::duration elapsed)
+	{
+		mFrameTime.DeltaSeconds = std::chrono::duration<double>(elapsed).count();
+		mAccumulator += elapsed;
+
+		uint32_t stepCount = 0;
+		while (mAccumulator >= mFixedDelta && stepCount < mSettings.MaxStepsPerFrame)
+		{
+			RunPhase(EnginePhase::FixedUpdate);
+
+			mAccumulator -= mFixedDelta;
+			mFrameTime.SimulationSeconds += mFrameTime.FixedDeltaSeconds;
+			++mFrameTime.FixedStepIndex;
+			++stepCount;
+		}
+
+		// Spiral of death guard: keep the fractional part for interpolation, drop the backlog
+		if (mAccumulator >= mFixedDelta)
+		{
+			mDroppedStepCount += static_cast<uint64_t>(mAccumulator / mFixedDelta);
+			mAccumulator %= mFixedDelta;
+		}
+
+		mFrameTime.Alpha = std::chrono::duration<double>(mAccumulator) / std::chrono::duration<double>(mFixedDelta);
+
+		RunPhase(EnginePhase::Update);
+		RunPhase(EnginePhase::Render);
+
+		++mFrameTime.FrameIndex;
+	}
+
+	void FrameLoop::RunPhase(EnginePhase phase)
+	{
+		static constexpr const char* cPhaseZoneNames[] = { "FixedUpdate", "Update", "Render" };
+		GOJO_PROFILE_SCOPE(cPhaseZoneNames[static_cast<size_t>(phase)]);
+
+		const std::vector<CallbackEntry>& callbacks = mCallbacks[static_cast<size_t>(phase)];
+
+		++mRunningDepth;
+		for (const CallbackEntry& entry : callbacks)
+		{
+			if (entry.Id != cInvalidPhaseCallbackId)
+			{
+				entry.Callback(mFrameTime);
+			}
+		}
+		--mRunningDepth;
+
+		if (mRunningDepth == 0)
+		{
+			FlushPendingChanges();
+		}
+	}
+
+	void FrameLoop::FlushPendingChanges()
+	{
+		if (mHasRemovedCallbacks)
+		{
+			for (auto& callbacks : mCallbacks)
+			{
+				std::erase_if(callbacks, [](const CallbackEntry& entry) { return entry.Id == cInvalidPhaseCallbackId; });
+			}
+			mHasRemovedCallbacks = false;
+		}
+
+		for (auto& [phase, entry] : mPendingCallbacks)
+		{
+			mCallbacks[static_cast<size_t>(phase)].push_back(std::move(entry));
+		}
+		mPendingCallbacks.clear();
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+#include "Core/Delegate.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Frame Loop Types
+	// ====================================================================================================
+
+	/**
+	 * @brief Phases of one engine frame, in execution order.
+	 * FixedUpdate runs zero or more times per frame at the fixed rate, Update and Render once per frame.
+	 */
+	enum class EnginePhase : uint8_t
+	{
+		FixedUpdate,
+		Update,
+		Render,
+		Count
+	};
+
+	struct FixedTimestepSettings
+	{
+		uint32_t UpdateRate{ 60 };						// Fixed simulation steps per second
+		uint32_t MaxStepsPerFrame{ 5 };					// Guard against the spiral of death, late steps are dropped
+	};
+
+	/**
+	 * @brief Timing passed to phase callbacks.
+	 */
+	struct FrameTime
+	{
+		double DeltaSeconds{ 0.0 };						// Wall time since the previous frame
+		double FixedDeltaSeconds{ 0.0 };				// Duration of one fixed step
+		double Alpha{ 0.0 };							// [0, 1) progress towards the next fixed step, to interpolate rendered state
+		double SimulationSeconds{ 0.0 };				// Simulated time, advances by FixedDeltaSeconds per step
+		uint64_t FrameIndex{ 0 };
+		uint64_t FixedStepIndex{ 0 };					// Index of the running (FixedUpdate) or last step
+	};
+
+	using PhaseCallback = Delegate<void(const FrameTime&)>;
+
+	using PhaseCallbackId = uint32_t;
+	constexpr PhaseCallbackId cInvalidPhaseCallbackId = 0;
+
+	// ====================================================================================================
+	// Frame Loop
+	// ====================================================================================================
+
+	/**
+	 * @brief Fixed-timestep simulation with variable-rate rendering.
+	 *
+	 * Every Tick() adds the elapsed wall time to an accumulator and consumes it in fixed steps
+	 * (FixedUpdate), then runs Update and Render once with the interpolation alpha of the remaining time.
+	 * The accumulator is an integer duration, so the number of steps for a given amount of time is exact.
+	 * If a frame needs more than MaxStepsPerFrame steps the backlog is dropped: the simulation slows down
+	 * instead of spending ever more time catching up.
+	 * Owned by the engine, main thread only.
+	 */
+	class GOJO_API FrameLoop final : public NonCopyable
+	{
+	public:
+		explicit FrameLoop(const FixedTimestepSettings& settings = {});
+
+		// @brief Registers a callback for a phase. Callbacks of a phase run in registration order.
+		//        Safe from inside a callback, the new callback runs from the next phase run on.
+		PhaseCallbackId AddCallback(EnginePhase phase, PhaseCallback callback);
+
+		// @brief Safe from inside a callback (including the callback itself).
+		bool RemoveCallback(PhaseCallbackId id);
+
+		// @brief Runs one frame: the due fixed steps, then Update and Render.
+		void Tick();
+
+		// @brief Runs one frame for "elapsed" time instead of the wall time since the previous Tick (tests, headless runs).
+		void Tick(std::chrono::steady_clock::duration elapsed);
+
+		[[nodiscard]] const FrameTime& GetFrameTime() const { return mFrameTime; }
+		[[nodiscard]] uint64_t GetDroppedStepCount() const { return mDroppedStepCount; }
+
+	private:
+		struct CallbackEntry
+		{
+			PhaseCallbackId Id{ cInvalidPhaseCallbackId };
+			PhaseCallback Callback;
+		};
+
+		void RunPhase(EnginePhase phase);
+		void FlushPendingChanges();
+
+	private:
+		FixedTimestepSettings mSettings;
+		std::chrono::steady_clock::duration mFixedDelta;
+		std::chrono::steady_clock::duration mAccumulator{};
+		std::chrono::steady_clock::time_point mLastTick;
+		bool mHasTicked{ false };
+
+		FrameTime mFrameTime;
+		uint64_t mDroppedStepCount{ 0 };
+
+		std::array<std::vector<CallbackEntry>, static_cast<size_t>(EnginePhase::Count)> mCallbacks;
+		std::vector<std::pair<EnginePhase, CallbackEntry>> mPendingCallbacks;	// Added while a phase was running
+		PhaseCallbackId mNextCallbackId{ 1 };
+		uint32_t mRunningDepth{ 0 };
+		bool mHasRemovedCallbacks{ false };
+	};
+}
@@ -0,0 +1,159 @@
+#include "Core/FramePacer.h"
+#include "Core/Metrics/Metrics.h"
+#include "Core/Profiler/Profiler.h"
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#endif
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// FramePacer Implementation (PIMPL)
+	// ====================================================================================================
+
+	class FramePacer::Impl
+	{
+	public:
+		Impl()
+		{
+#ifdef _WIN32
+			// Windows 10 1803+, the regular Sleep() granularity (up to 15.6 ms) is useless for pacing
+			mTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif
+		}
+
+		~Impl()
+		{
+#ifdef _WIN32
+			if (mTimer)
+			{
+				CloseHandle(mTimer);
+			}
+#endif
+		}
+
+		void Sleep(std::chrono::steady_clock::duration duration)
+		{
+#ifdef _WIN32
+			if (mTimer)
+			{
+				// Negative due time is relative, in 100 ns units
+				LARGE_INTEGER dueTime;
+				dueTime.QuadPart = -std::max<LONGLONG>(1, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / 100);
+				if (SetWaitableTimerEx(mTimer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+				{
+					WaitForSingleObject(mTimer, INFINITE);
+					return;
+				}
+			}
+#endif
+			std::this_thread::sleep_for(duration);
+		}
+
+	private:
+#ifdef _WIN32
+		HANDLE mTimer{ nullptr };
+#endif
+	};
+
+	// ====================================================================================================
+	// FramePacer
+	// ====================================================================================================
+
+	FramePacer::FramePacer(const FramePacerSettings& settings)
+		: pImpl(std::make_unique<Impl>())
+		, mSettings(settings)
+		, mFrameTimes(std::max(settings.StatisticsWindow, 1u), 0.0f)
+		, mFrameTimeMetric(MetricsRegistry::GetHistogram("gojo_frame_time_microseconds", "Duration of the paced (non-idle) frames"))
+	{
+		SetTargetFrameRate(settings.TargetFrameRate);
+	}
+
+	FramePacer::~FramePacer() = default;
+
+	void FramePacer::BeginFrame()
+	{
+		const auto now = std::chrono::steady_clock::now();
+		if (mHasStarted && !mIsIdleFrame)
+		{
+			mFrameTimes[mNextFrameTime] = std::chrono::duration<float, std::milli>(now - mFrameStart).count();
+			mFrameTimeMetric.Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - mFrameStart).count()));
+			mNextFrameTime = (mNextFrameTime + 1) % mFrameTimes.size();
+			++mFrameCount;
+		}
+
+		mFrameStart = now;
+		mHasStarted = true;
+		mIsIdleFrame = false;
+	}
+
+	void FramePacer::EndFrame()
+	{
+		if (mFramePeriod.count() > 0 && !mIsIdleFrame)
+		{
+			GOJO_PROFILE_SCOPE("FramePacer::Wait");
+			WaitUntil(mFrameStart + mFramePeriod);
+		}
+	}
+
+	void FramePacer::SetTargetFrameRate(uint32_t framesPerSecond)
+	{
+		mSettings.TargetFrameRate = framesPerSecond;
+		mFramePeriod = framesPerSecond > 0
+			? std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / framesPerSecond))
+			: std::chrono::steady_clock::duration::zero();
+	}
+
+	FrameStats FramePacer::GetFrameStats() const
+	{
+		FrameStats stats;
+		stats.FrameCount = mFrameCount;
+
+		const size_t count = static_cast<size_t>(std::min<uint64_t>(mFrameCount, mFrameTimes.size()));
+		stats.SampleCount = static_cast<uint32_t>(count);
+		if (count == 0)
+			return stats;
+
+		std::vector<float> frameTimes(mFrameTimes.begin(), mFrameTimes.begin() + count);
+		const double total = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.0);
+
+		// Nearest-rank percentile
+		const size_t p99Index = std::min(count - 1, (count * 99 + 99) / 100 - 1);
+		std::ranges::nth_element(frameTimes, frameTimes.begin() + p99Index);
+
+		stats.AverageMs = total / static_cast<double>(count);
+		stats.P99Ms = frameTimes[p99Index];
+		stats.MaxMs = *std::max_element(frameTimes.begin() + p99Index, frameTimes.end());
+		stats.FramesPerSecond = stats.AverageMs > 0.0 ? 1000.0 / stats.AverageMs : 0.0;
+		return stats;
+	}
+
+	void FramePacer::WaitUntil(std::chrono::steady_clock::time_point deadline)
+	{
+		// Sleep while the remaining time exceeds the timer inaccuracy, spin for the rest
+		for (auto remaining = deadline - std::chrono::steady_clock::now(); remaining > mSettings.SpinThreshold; remaining = deadline - std::chrono::steady_clock::now())
+		{
+			pImpl->Sleep(remaining - mSettings.SpinThreshold);
+		}
+
+		while (std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::yield();
+		}
+	}
+}
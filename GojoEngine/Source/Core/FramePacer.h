@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace GojoEngine
+{
+	class Histogram;
+
+	// ====================================================================================================
+	// Frame Pacing Settings
+	// ====================================================================================================
+
+	struct FramePacerSettings
+	{
+		uint32_t TargetFrameRate{ 60 };										// 0 runs uncapped
+		std::chrono::microseconds SpinThreshold{ 1000 };					// The last part of a wait is spun instead of slept
+		std::chrono::milliseconds IdleWaitTimeout{ 100 };					// Longest block on events while no window is active
+		uint32_t StatisticsWindow{ 240 };									// Frames kept for GetFrameStats
+	};
+
+	/**
+	 * @brief Frame time statistics over the last StatisticsWindow active frames (idle frames are excluded).
+	 */
+	struct FrameStats
+	{
+		double AverageMs{ 0.0 };
+		double P99Ms{ 0.0 };
+		double MaxMs{ 0.0 };
+		double FramesPerSecond{ 0.0 };
+		uint64_t FrameCount{ 0 };											// Frames recorded since StartUp
+		uint32_t SampleCount{ 0 };											// Frames the statistics above cover
+	};
+
+	// ====================================================================================================
+	// Frame Pacer
+	// ====================================================================================================
+
+	/**
+	 * @brief Caps the frame rate of the main loop and measures frame times.
+	 *
+	 * EndFrame() sleeps until the frame period is almost over and spins for the remaining
+	 * SpinThreshold, which keeps the pacing accurate without burning a core. On Windows the sleep
+	 * uses a high-resolution waitable timer when the OS supports it.
+	 * Owned by the engine, main thread only.
+	 */
+	class GOJO_API FramePacer final : public NonCopyable
+	{
+	public:
+		explicit FramePacer(const FramePacerSettings& settings = {});
+		~FramePacer() override;
+
+		// @brief Starts a frame and records the duration of the previous one.
+		void BeginFrame();
+
+		// @brief Waits until the target frame period elapsed since BeginFrame().
+		void EndFrame();
+
+		// @brief Excludes the current frame from the statistics (the loop blocked on events instead of pacing).
+		void MarkIdleFrame() { mIsIdleFrame = true; }
+
+		void SetTargetFrameRate(uint32_t framesPerSecond);
+		[[nodiscard]] uint32_t GetTargetFrameRate() const { return mSettings.TargetFrameRate; }
+		[[nodiscard]] std::chrono::milliseconds GetIdleWaitTimeout() const { return mSettings.IdleWaitTimeout; }
+
+		[[nodiscard]] FrameStats GetFrameStats() const;
+
+	private:
+		void WaitUntil(std::chrono::steady_clock::time_point deadline);
+
+	private:
+		// PIMPL idiom to keep the OS timer out of the public interface
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+
+		FramePacerSettings mSettings;
+		std::chrono::steady_clock::duration mFramePeriod{};
+		std::chrono::steady_clock::time_point mFrameStart;
+		bool mHasStarted{ false };
+		bool mIsIdleFrame{ false };
+
+		std::vector<float> mFrameTimes;										// Milliseconds, ring buffer
+		size_t mNextFrameTime{ 0 };
+		uint64_t mFrameCount{ 0 };
+
+		Histogram& mFrameTimeMetric;										// Whole session, exported with the metrics
+	};
+}
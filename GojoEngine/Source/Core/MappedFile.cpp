@@ -0,0 +1,150 @@
+#include "Core/MappedFile.h"
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// MappedFile Implementation (PIMPL)
+	// ====================================================================================================
+
+	class MappedFile::Impl
+	{
+	public:
+		~Impl()
+		{
+			Close();
+		}
+
+		std::byte* Open(const std::filesystem::path& path, Access access, size_t& size)
+		{
+			const bool isWritable = access == Access::ReadWrite;
+
+			mFile = CreateFileW(
+				path.c_str(),
+				isWritable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+				FILE_SHARE_READ,
+				nullptr,
+				isWritable ? OPEN_ALWAYS : OPEN_EXISTING,
+				FILE_ATTRIBUTE_NORMAL,
+				nullptr
+			);
+			if (mFile == INVALID_HANDLE_VALUE)
+			{
+				return nullptr;
+			}
+
+			if (!isWritable)
+			{
+				LARGE_INTEGER fileSize{};
+				if (!GetFileSizeEx(mFile, &fileSize))
+				{
+					Close();
+					return nullptr;
+				}
+				size = static_cast<size_t>(fileSize.QuadPart);
+			}
+
+			if (size == 0)
+			{
+				Close();
+				return nullptr;
+			}
+
+			// For read-write mappings the maximum size also extends the file
+			const auto mappingSize = static_cast<uint64_t>(size);
+			mMapping = CreateFileMappingW(
+				mFile,
+				nullptr,
+				isWritable ? PAGE_READWRITE : PAGE_READONLY,
+				isWritable ? static_cast<DWORD>(mappingSize >> 32) : 0,
+				isWritable ? static_cast<DWORD>(mappingSize & 0xFFFFFFFFu) : 0,
+				nullptr
+			);
+			if (mMapping == nullptr)
+			{
+				Close();
+				return nullptr;
+			}
+
+			mView = MapViewOfFile(mMapping, isWritable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+			if (mView == nullptr)
+			{
+				Close();
+				return nullptr;
+			}
+
+			return static_cast<std::byte*>(mView);
+		}
+
+		void Close()
+		{
+			if (mView)
+			{
+				UnmapViewOfFile(mView);
+				mView = nullptr;
+			}
+			if (mMapping)
+			{
+				CloseHandle(mMapping);
+				mMapping = nullptr;
+			}
+			if (mFile != INVALID_HANDLE_VALUE)
+			{
+				CloseHandle(mFile);
+				mFile = INVALID_HANDLE_VALUE;
+			}
+		}
+
+		void Flush()
+		{
+			if (mView)
+			{
+				FlushViewOfFile(mView, 0);
+			}
+		}
+
+	private:
+		HANDLE mFile{ INVALID_HANDLE_VALUE };
+		HANDLE mMapping{ nullptr };
+		void* mView{ nullptr };
+	};
+
+	// ====================================================================================================
+	// MappedFile Public API
+	// ====================================================================================================
+
+	MappedFile::MappedFile()
+		: pImpl(std::make_unique<Impl>())
+	{
+	}
+
+	MappedFile::~MappedFile() = default;
+
+	bool MappedFile::Open(const std::filesystem::path& path, Access access, size_t size)
+	{
+		Close();
+
+		mData = pImpl->Open(path, access, size);
+		mSize = mData ? size : 0;
+		return mData != nullptr;
+	}
+
+	void MappedFile::Close()
+	{
+		pImpl->Close();
+		mData = nullptr;
+		mSize = 0;
+	}
+
+	void MappedFile::Flush()
+	{
+		pImpl->Flush();
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Mapped File
+	// ====================================================================================================
+
+	/**
+	 * @brief Maps a whole file into the address space.
+	 *
+	 * Reading through the mapping avoids copying the file into a user buffer, the OS pages it in on demand.
+	 * Read-write mappings are created (or resized) to the requested size, changes reach the file on Flush()
+	 * or when the mapping is closed.
+	 */
+	class GOJO_API MappedFile final : public NonCopyable
+	{
+	public:
+		enum class Access
+		{
+			ReadOnly,
+			ReadWrite
+		};
+
+		MappedFile();
+		~MappedFile() override;
+
+		// @brief Maps "path". Closes the previously mapped file, if any.
+		// @param size Size of a read-write mapping (the file is created/resized). Ignored for read-only mappings.
+		// @return False if the file could not be opened or mapped (empty files cannot be mapped).
+		//         Nothing is logged here: the log sinks themselves map files, callers report failures.
+		bool Open(const std::filesystem::path& path, Access access, size_t size = 0);
+		void Close();
+
+		// @brief Writes the dirty pages of a read-write mapping back to the file.
+		void Flush();
+
+		[[nodiscard]] std::byte* GetData() const { return mData; }
+		[[nodiscard]] size_t GetSize() const { return mSize; }
+		[[nodiscard]] bool IsOpen() const { return mData != nullptr; }
+
+	private:
+		// PIMPL idiom to keep the OS headers out of the public interface
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+
+		std::byte* mData{ nullptr };
+		size_t mSize{ 0 };
+	};
+}
@@ -0,0 +1,95 @@
+#include "Core/Memory/FixedSizePool.h"
+#include "Managers/LogManager/LogManager.h"
+
+#include <algorithm>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// FixedSizePool
+	// ====================================================================================================
+
+	FixedSizePool::FixedSizePool(size_t blockSize, size_t blocksPerChunk, MemorySite& site)
+		: mBlockSize((std::max(blockSize, sizeof(FreeBlock)) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1))
+		, mBlocksPerChunk(std::max<size_t>(blocksPerChunk, 1))
+		, mSite(site)
+	{
+	}
+
+	FixedSizePool::~FixedSizePool()
+	{
+		GOJO_ASSERT_MESSAGE(mLiveBlockCount == 0, "FixedSizePool destroyed while blocks are still in use!");
+		ReleaseChunks();
+	}
+
+	void* FixedSizePool::Allocate()
+	{
+		std::lock_guard lock(mMutex);
+		if (!mFreeList)
+		{
+			AddChunk();
+		}
+
+		FreeBlock* block = mFreeList;
+		mFreeList = block->Next;
+		++mLiveBlockCount;
+		return block;
+	}
+
+	void FixedSizePool::Free(void* block)
+	{
+		if (!block)
+			return;
+
+		std::lock_guard lock(mMutex);
+		auto* freeBlock = static_cast<FreeBlock*>(block);
+		freeBlock->Next = mFreeList;
+		mFreeList = freeBlock;
+		--mLiveBlockCount;
+	}
+
+	void FixedSizePool::Trim()
+	{
+		std::lock_guard lock(mMutex);
+		if (mLiveBlockCount == 0)
+		{
+			ReleaseChunks();
+		}
+	}
+
+	size_t FixedSizePool::GetLiveBlockCount() const
+	{
+		std::lock_guard lock(mMutex);
+		return mLiveBlockCount;
+	}
+
+	size_t FixedSizePool::GetChunkCount() const
+	{
+		std::lock_guard lock(mMutex);
+		return mChunks.size();
+	}
+
+	void FixedSizePool::AddChunk()
+	{
+		auto* chunk = static_cast<std::byte*>(MemoryTracker::Allocate(mBlockSize * mBlocksPerChunk, alignof(std::max_align_t), mSite));
+		mChunks.push_back(chunk);
+
+		// Threaded back to front so blocks are handed out in address order
+		for (size_t index = mBlocksPerChunk; index-- > 0;)
+		{
+			auto* block = reinterpret_cast<FreeBlock*>(chunk + index * mBlockSize);
+			block->Next = mFreeList;
+			mFreeList = block;
+		}
+	}
+
+	void FixedSizePool::ReleaseChunks()
+	{
+		for (void* chunk : mChunks)
+		{
+			MemoryTracker::Free(chunk);
+		}
+		mChunks.clear();
+		mFreeList = nullptr;
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+#include "Core/Memory/MemoryTracker.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Fixed Size Pool
+	// ====================================================================================================
+
+	/**
+	 * @brief Free list of equally sized blocks carved from tracked chunks.
+	 *
+	 * Allocating and freeing pop and push one block under a short lock, the heap is only touched when
+	 * every chunk is in use. Chunks are kept until Trim() finds the pool empty or the pool dies, so a
+	 * steady churn of small objects (events, callbacks, ...) costs no malloc at all. Thread-safe.
+	 */
+	class GOJO_API FixedSizePool final : public NonCopyable
+	{
+	public:
+		FixedSizePool(size_t blockSize, size_t blocksPerChunk, MemorySite& site);
+		~FixedSizePool() override;
+
+		[[nodiscard]] void* Allocate();
+		void Free(void* block);
+
+		// @brief Returns every chunk to the heap if no block is in use.
+		void Trim();
+
+		[[nodiscard]] size_t GetBlockSize() const { return mBlockSize; }
+		[[nodiscard]] size_t GetLiveBlockCount() const;
+		[[nodiscard]] size_t GetChunkCount() const;
+
+	private:
+		struct FreeBlock
+		{
+			FreeBlock* Next;
+		};
+
+		void AddChunk();
+		void ReleaseChunks();
+
+	private:
+		size_t mBlockSize;
+		size_t mBlocksPerChunk;
+		MemorySite& mSite;
+
+		mutable std::mutex mMutex;
+		FreeBlock* mFreeList{ nullptr };
+		std::vector<void*> mChunks;
+		size_t mLiveBlockCount{ 0 };
+	};
+}
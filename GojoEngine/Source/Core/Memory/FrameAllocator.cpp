@@ -0,0 +1,218 @@
+#include "Core/Memory/FrameAllocator.h"
+#include "Core/Memory/LinearArena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		// @brief Arenas of one thread, only touched by that thread (statistics aside).
+		struct ThreadFrameArenas
+		{
+			ThreadFrameArenas(const FrameAllocatorSettings& settings, uint64_t frameIndex)
+				: Frame(settings.FrameArenaSize, GOJO_MEMORY_SITE(MemoryTag::FrameMemory))
+				, DoubleBuffered{ LinearArena(settings.DoubleBufferedArenaSize, GOJO_MEMORY_SITE(MemoryTag::FrameMemory)), LinearArena(settings.DoubleBufferedArenaSize, GOJO_MEMORY_SITE(MemoryTag::FrameMemory)) }
+				, FrameIndex(frameIndex)
+				, DoubleBufferedFrameIndex{ frameIndex, frameIndex }
+			{
+			}
+
+			LinearArena Frame;
+			LinearArena DoubleBuffered[2];					// Indexed by frame parity
+			uint64_t FrameIndex;							// Frame "Frame" was last reset for
+			uint64_t DoubleBufferedFrameIndex[2];
+		};
+
+		struct ThreadArenasSlot
+		{
+			uint64_t Generation{ 0 };						// Allocator instance the arenas belong to
+			ThreadFrameArenas* Arenas{ nullptr };
+		};
+
+		// Survives a restart of the allocator, 0 is never handed out
+		std::atomic<uint64_t> sNextGeneration{ 1 };
+
+		thread_local ThreadArenasSlot tThreadArenas;
+
+		class FrameMemoryResource final : public std::pmr::memory_resource
+		{
+		public:
+			FrameMemoryResource(FrameAllocator& allocator, FrameLifetime lifetime)
+				: mAllocator(allocator), mLifetime(lifetime)
+			{
+			}
+
+		private:
+			void* do_allocate(size_t bytes, size_t alignment) override
+			{
+				return mAllocator.Allocate(bytes, alignment, mLifetime);
+			}
+
+			void do_deallocate(void*, size_t, size_t) override
+			{
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+			{
+				return this == &other;
+			}
+
+		private:
+			FrameAllocator& mAllocator;
+			FrameLifetime mLifetime;
+		};
+	}
+
+	// ====================================================================================================
+	// FrameAllocator Implementation (PIMPL)
+	// ====================================================================================================
+
+	class FrameAllocator::Impl
+	{
+	public:
+		Impl(FrameAllocator& allocator, const FrameAllocatorSettings& settings)
+			: mSettings(settings)
+			, mGeneration(sNextGeneration.fetch_add(1, std::memory_order_relaxed))
+			, mFrameResource(allocator, FrameLifetime::CurrentFrame)
+			, mNextFrameResource(allocator, FrameLifetime::NextFrame)
+		{
+		}
+
+		~Impl()
+		{
+			if (tThreadArenas.Generation == mGeneration)
+			{
+				tThreadArenas = {};
+			}
+		}
+
+		void BeginFrame()
+		{
+			mFrameIndex.fetch_add(1, std::memory_order_release);
+		}
+
+		void* Allocate(size_t size, size_t alignment, FrameLifetime lifetime)
+		{
+			ThreadFrameArenas& arenas = GetThreadArenas();
+			const uint64_t frameIndex = mFrameIndex.load(std::memory_order_acquire);
+
+			if (lifetime == FrameLifetime::CurrentFrame)
+			{
+				if (arenas.FrameIndex != frameIndex)
+				{
+					arenas.Frame.Reset();
+					arenas.FrameIndex = frameIndex;
+				}
+				return arenas.Frame.Allocate(size, alignment);
+			}
+
+			// The buffer of this parity was last used two (or more) frames ago, its data is no longer read
+			const size_t buffer = static_cast<size_t>(frameIndex & 1);
+			if (arenas.DoubleBufferedFrameIndex[buffer] != frameIndex)
+			{
+				arenas.DoubleBuffered[buffer].Reset();
+				arenas.DoubleBufferedFrameIndex[buffer] = frameIndex;
+			}
+			return arenas.DoubleBuffered[buffer].Allocate(size, alignment);
+		}
+
+		std::pmr::memory_resource* GetResource(FrameLifetime lifetime)
+		{
+			return lifetime == FrameLifetime::CurrentFrame ? &mFrameResource : &mNextFrameResource;
+		}
+
+		[[nodiscard]] uint64_t GetFrameIndex() const { return mFrameIndex.load(std::memory_order_acquire); }
+
+		[[nodiscard]] FrameAllocatorStats GetStats() const
+		{
+			FrameAllocatorStats stats;
+			stats.FrameArenaSize = mSettings.FrameArenaSize;
+			stats.DoubleBufferedArenaSize = mSettings.DoubleBufferedArenaSize;
+
+			std::lock_guard lock(mThreadArenasMutex);
+			stats.ThreadCount = static_cast<uint32_t>(mThreadArenas.size());
+			for (const auto& arenas : mThreadArenas)
+			{
+				stats.FrameHighWaterMark = std::max(stats.FrameHighWaterMark, arenas->Frame.GetHighWaterMark());
+				stats.OverflowCount += arenas->Frame.GetOverflowCount();
+
+				for (const LinearArena& arena : arenas->DoubleBuffered)
+				{
+					stats.DoubleBufferedHighWaterMark = std::max(stats.DoubleBufferedHighWaterMark, arena.GetHighWaterMark());
+					stats.OverflowCount += arena.GetOverflowCount();
+				}
+			}
+			return stats;
+		}
+
+	private:
+		ThreadFrameArenas& GetThreadArenas()
+		{
+			if (tThreadArenas.Generation != mGeneration)
+			{
+				// First allocation of this thread: the arenas stay registered (and reusable by the
+				// thread) until shutdown
+				auto arenas = std::make_unique<ThreadFrameArenas>(mSettings, mFrameIndex.load(std::memory_order_acquire));
+				tThreadArenas = { mGeneration, arenas.get() };
+
+				std::lock_guard lock(mThreadArenasMutex);
+				mThreadArenas.push_back(std::move(arenas));
+			}
+			return *tThreadArenas.Arenas;
+		}
+
+	private:
+		FrameAllocatorSettings mSettings;
+		uint64_t mGeneration;
+		std::atomic<uint64_t> mFrameIndex{ 0 };
+
+		mutable std::mutex mThreadArenasMutex;
+		std::vector<std::unique_ptr<ThreadFrameArenas>> mThreadArenas;
+
+		FrameMemoryResource mFrameResource;
+		FrameMemoryResource mNextFrameResource;
+	};
+
+	// ====================================================================================================
+	// FrameAllocator
+	// ====================================================================================================
+
+	FrameAllocator::FrameAllocator(const FrameAllocatorSettings& settings)
+		: pImpl(std::make_unique<Impl>(*this, settings))
+	{
+	}
+
+	FrameAllocator::~FrameAllocator() = default;
+
+	void FrameAllocator::BeginFrame()
+	{
+		pImpl->BeginFrame();
+	}
+
+	void* FrameAllocator::Allocate(size_t size, size_t alignment, FrameLifetime lifetime)
+	{
+		return pImpl->Allocate(size, alignment, lifetime);
+	}
+
+	std::pmr::memory_resource* FrameAllocator::GetResource(FrameLifetime lifetime)
+	{
+		return pImpl->GetResource(lifetime);
+	}
+
+	uint64_t FrameAllocator::GetFrameIndex() const
+	{
+		return pImpl->GetFrameIndex();
+	}
+
+	FrameAllocatorStats FrameAllocator::GetStats() const
+	{
+		return pImpl->GetStats();
+	}
+}
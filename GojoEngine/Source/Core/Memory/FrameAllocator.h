@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Managers/Manager.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Frame Allocator Types
+	// ====================================================================================================
+
+	struct FrameAllocatorSettings
+	{
+		size_t FrameArenaSize{ 1u << 20 };					// Per thread, released every frame
+		size_t DoubleBufferedArenaSize{ 1u << 20 };			// Per thread and per buffer, released every other frame
+	};
+
+	enum class FrameLifetime : uint8_t
+	{
+		CurrentFrame,										// Valid until the next BeginFrame()
+		NextFrame											// Valid until the BeginFrame() after the next one
+	};
+
+	/**
+	 * @brief Usage over every thread that allocated frame memory. High-water marks are the most bytes one
+	 * thread used in one frame (one buffer for the double-buffered memory), overflows included.
+	 */
+	struct FrameAllocatorStats
+	{
+		size_t FrameArenaSize{ 0 };
+		size_t FrameHighWaterMark{ 0 };
+		size_t DoubleBufferedArenaSize{ 0 };
+		size_t DoubleBufferedHighWaterMark{ 0 };
+		uint64_t OverflowCount{ 0 };						// Allocations that did not fit and went to the heap
+		uint32_t ThreadCount{ 0 };
+	};
+
+	// ====================================================================================================
+	// Frame Allocator
+	// ====================================================================================================
+
+	/**
+	 * @brief Transient memory released at frame boundaries.
+	 *
+	 * Every thread bumps in its own arenas, so allocating is a few instructions without any
+	 * synchronization and deallocating is free. A thread resets its arena itself on its first allocation
+	 * after BeginFrame(), workers never race with the main thread. NextFrame memory lives in two arenas
+	 * used on alternate frames: data produced in frame N stays valid while frame N+1 consumes it.
+	 *
+	 * GetResource() plugs the arenas into std::pmr containers. Nothing is destroyed on reset, only use it
+	 * for objects whose destructor does not matter (or that are destroyed before the frame ends).
+	 */
+	class GOJO_API FrameAllocator final : public Manager<FrameAllocator>
+	{
+		friend class Manager<FrameAllocator>;
+
+	public:
+		// @brief Starts a new frame. Main thread, once per frame.
+		void BeginFrame();
+
+		[[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t), FrameLifetime lifetime = FrameLifetime::CurrentFrame);
+
+		// @brief Constructs a T in frame memory, its destructor never runs.
+		template<typename T, typename... ArgsT>
+		[[nodiscard]] T* New(FrameLifetime lifetime, ArgsT&&... args)
+		{
+			GOJO_STATIC_ASSERT(std::is_trivially_destructible_v<T>, "Frame memory is released without running destructors!");
+			return ::new (Allocate(sizeof(T), alignof(T), lifetime)) T(std::forward<ArgsT>(args)...);
+		}
+
+		// @brief Memory resource for std::pmr containers, deallocation is a no-op.
+		[[nodiscard]] std::pmr::memory_resource* GetResource(FrameLifetime lifetime = FrameLifetime::CurrentFrame);
+
+		[[nodiscard]] uint64_t GetFrameIndex() const;
+		[[nodiscard]] FrameAllocatorStats GetStats() const;
+
+	private:
+		explicit FrameAllocator(const FrameAllocatorSettings& settings = {});
+		~FrameAllocator();
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+	};
+}
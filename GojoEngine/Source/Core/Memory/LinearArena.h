@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+#include "Core/Memory/MemoryTracker.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Linear Arena
+	// ====================================================================================================
+
+	/**
+	 * @brief Bump allocator over one fixed block, everything is released at once by Reset().
+	 *
+	 * Allocations that do not fit go to the heap (released on Reset() as well) and are counted as
+	 * overflows, so an undersized arena degrades instead of failing. Single owner thread; the statistics
+	 * are updated on Reset() and may be read from any thread.
+	 */
+	class LinearArena final : public NonCopyable
+	{
+	public:
+		// @brief The block and the overflows are accounted to "site".
+		LinearArena(size_t capacity, MemorySite& site)
+			: mCapacity(capacity), mSite(site)
+		{
+			if (mCapacity > 0)
+			{
+				mBuffer = static_cast<std::byte*>(MemoryTracker::Allocate(mCapacity, cBlockAlignment, mSite));
+			}
+		}
+
+		~LinearArena() override
+		{
+			ReleaseOverflowBlocks();
+			MemoryTracker::Free(mBuffer);
+		}
+
+		[[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+		{
+			const uintptr_t base = reinterpret_cast<uintptr_t>(mBuffer);
+			const uintptr_t aligned = (base + mOffset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+			const size_t end = static_cast<size_t>(aligned - base) + size;
+
+			if (mBuffer && end <= mCapacity)
+			{
+				mOffset = end;
+				return reinterpret_cast<void*>(aligned);
+			}
+
+			// Overflow: served by the heap until the next reset
+			void* block = MemoryTracker::Allocate(size, alignment, mSite);
+			mOverflowBlocks.push_back(block);
+			mOverflowBytes += size;
+			mOverflowCount.fetch_add(1, std::memory_order_relaxed);
+			return block;
+		}
+
+		// @brief Releases every allocation and records the usage of the finished period.
+		void Reset()
+		{
+			const size_t usedBytes = mOffset + mOverflowBytes;
+			if (usedBytes > mHighWaterMark.load(std::memory_order_relaxed))
+			{
+				mHighWaterMark.store(usedBytes, std::memory_order_relaxed);
+			}
+
+			ReleaseOverflowBlocks();
+			mOffset = 0;
+		}
+
+		[[nodiscard]] size_t GetCapacity() const { return mCapacity; }
+
+		// @brief Owner thread only.
+		[[nodiscard]] size_t GetUsedBytes() const { return mOffset + mOverflowBytes; }
+
+		// @brief Most bytes used between two resets (overflows included).
+		[[nodiscard]] size_t GetHighWaterMark() const { return mHighWaterMark.load(std::memory_order_relaxed); }
+
+		[[nodiscard]] uint64_t GetOverflowCount() const { return mOverflowCount.load(std::memory_order_relaxed); }
+
+	private:
+		static constexpr size_t cBlockAlignment = 64;
+
+		void ReleaseOverflowBlocks()
+		{
+			for (void* block : mOverflowBlocks)
+			{
+				MemoryTracker::Free(block);
+			}
+			mOverflowBlocks.clear();
+			mOverflowBytes = 0;
+		}
+
+	private:
+		std::byte* mBuffer{ nullptr };
+		size_t mCapacity{ 0 };
+		size_t mOffset{ 0 };
+		MemorySite& mSite;
+
+		std::vector<void*> mOverflowBlocks;
+		size_t mOverflowBytes{ 0 };
+
+		std::atomic<size_t> mHighWaterMark{ 0 };
+		std::atomic<uint64_t> mOverflowCount{ 0 };
+	};
+}
@@ -0,0 +1,208 @@
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Utility.h"
+#include "Managers/LogManager/LogManager.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		constexpr std::array<std::string_view, static_cast<size_t>(MemoryTag::Count)> cTagNames{
+			"General", "Log", "Events", "Windows", "Vulkan", "Jobs", "Tasks", "FrameMemory", "Profiler", "ECS"
+		};
+
+		struct alignas(cCacheLineSize) TagCounters
+		{
+			std::atomic<size_t> CurrentBytes{ 0 };
+			std::atomic<size_t> PeakBytes{ 0 };
+			std::atomic<uint64_t> CurrentCount{ 0 };
+			std::atomic<uint64_t> TotalCount{ 0 };
+		};
+
+		// @brief Sits right in front of every tracked block.
+		struct AllocationHeader
+		{
+			MemorySite* Site;
+			size_t Size;
+			uint32_t Alignment;
+			uint32_t Offset;								// From the start of the block to the user memory
+		};
+
+		// Constant-initialized: usable from static constructors of any module
+		TagCounters sTagCounters[static_cast<size_t>(MemoryTag::Count)];
+		std::atomic<MemorySite*> sSites{ nullptr };
+
+		void RegisterSite(MemorySite& site)
+		{
+			if (site.IsRegistered.load(std::memory_order_acquire) || site.IsRegistered.exchange(true, std::memory_order_acq_rel))
+				return;
+
+			MemorySite* head = sSites.load(std::memory_order_relaxed);
+			do
+			{
+				site.Next = head;
+			} while (!sSites.compare_exchange_weak(head, &site, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		void RecordAllocation(MemorySite& site, size_t size)
+		{
+			RegisterSite(site);
+			site.LiveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+			site.LiveCount.fetch_add(1, std::memory_order_relaxed);
+
+			TagCounters& counters = sTagCounters[static_cast<size_t>(site.Tag)];
+			const size_t currentBytes = counters.CurrentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+			counters.CurrentCount.fetch_add(1, std::memory_order_relaxed);
+			counters.TotalCount.fetch_add(1, std::memory_order_relaxed);
+
+			size_t peakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+			while (currentBytes > peakBytes && !counters.PeakBytes.compare_exchange_weak(peakBytes, currentBytes, std::memory_order_relaxed))
+			{
+			}
+		}
+
+		void RecordFree(MemorySite& site, size_t size)
+		{
+			site.LiveBytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+			site.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+
+			TagCounters& counters = sTagCounters[static_cast<size_t>(site.Tag)];
+			counters.CurrentBytes.fetch_sub(size, std::memory_order_relaxed);
+			counters.CurrentCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		AllocationHeader* GetHeader(void* memory)
+		{
+			return reinterpret_cast<AllocationHeader*>(static_cast<std::byte*>(memory) - sizeof(AllocationHeader));
+		}
+	}
+
+	// ====================================================================================================
+	// MemoryTracker
+	// ====================================================================================================
+
+	void* MemoryTracker::Allocate(size_t size, size_t alignment, MemorySite& site)
+	{
+		GOJO_ASSERT_MESSAGE((alignment & (alignment - 1)) == 0, "Alignment must be a power of two!");
+
+		alignment = std::max(alignment, alignof(std::max_align_t));
+		const size_t offset = (sizeof(AllocationHeader) + alignment - 1) & ~(alignment - 1);
+
+		auto* block = static_cast<std::byte*>(::operator new(offset + size, std::align_val_t{ alignment }));
+		std::byte* memory = block + offset;
+		::new (memory - sizeof(AllocationHeader)) AllocationHeader{ &site, size, static_cast<uint32_t>(alignment), static_cast<uint32_t>(offset) };
+
+		RecordAllocation(site, size);
+		return memory;
+	}
+
+	void* MemoryTracker::Reallocate(void* memory, size_t size, size_t alignment, MemorySite& site)
+	{
+		if (!memory)
+		{
+			return Allocate(size, alignment, site);
+		}
+
+		if (size == 0)
+		{
+			Free(memory);
+			return nullptr;
+		}
+
+		void* newMemory = Allocate(size, alignment, site);
+		std::memcpy(newMemory, memory, std::min(size, GetHeader(memory)->Size));
+		Free(memory);
+		return newMemory;
+	}
+
+	void MemoryTracker::Free(void* memory)
+	{
+		if (!memory)
+			return;
+
+		const AllocationHeader header = *GetHeader(memory);
+		RecordFree(*header.Site, header.Size);
+
+		::operator delete(static_cast<std::byte*>(memory) - header.Offset, std::align_val_t{ header.Alignment });
+	}
+
+	MemoryTagStats MemoryTracker::GetTagStats(MemoryTag tag)
+	{
+		const TagCounters& counters = sTagCounters[static_cast<size_t>(tag)];
+
+		MemoryTagStats stats;
+		stats.CurrentBytes = counters.CurrentBytes.load(std::memory_order_relaxed);
+		stats.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+		stats.CurrentCount = counters.CurrentCount.load(std::memory_order_relaxed);
+		stats.TotalCount = counters.TotalCount.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	std::string_view MemoryTracker::GetTagName(MemoryTag tag)
+	{
+		const auto index = static_cast<size_t>(tag);
+		return index < cTagNames.size() ? cTagNames[index] : "Unknown";
+	}
+
+	std::vector<MemorySiteStats> MemoryTracker::GetLiveSites(size_t maxCount)
+	{
+		std::vector<MemorySiteStats> sites;
+		for (MemorySite* site = sSites.load(std::memory_order_acquire); site; site = site->Next)
+		{
+			const int64_t liveCount = site->LiveCount.load(std::memory_order_relaxed);
+			if (liveCount <= 0)
+				continue;
+
+			sites.push_back({ site->Tag, site->File, site->Line,
+				static_cast<size_t>(std::max<int64_t>(site->LiveBytes.load(std::memory_order_relaxed), 0)), static_cast<uint64_t>(liveCount) });
+		}
+
+		std::sort(sites.begin(), sites.end(), [](const MemorySiteStats& lhs, const MemorySiteStats& rhs) { return lhs.LiveBytes > rhs.LiveBytes; });
+		if (sites.size() > maxCount)
+		{
+			sites.resize(maxCount);
+		}
+		return sites;
+	}
+
+	void MemoryTracker::LogReport(size_t maxLeakSites)
+	{
+		GOJO_LOG_INFO("Memory", "{:<12} {:>12} {:>8} {:>12} {:>10}", "Tag", "Live bytes", "Live", "Peak bytes", "Total");
+		for (size_t index = 0; index < static_cast<size_t>(MemoryTag::Count); ++index)
+		{
+			const auto tag = static_cast<MemoryTag>(index);
+			const MemoryTagStats stats = GetTagStats(tag);
+			if (stats.TotalCount == 0)
+				continue;
+
+			GOJO_LOG_INFO("Memory", "{:<12} {:>12} {:>8} {:>12} {:>10}", GetTagName(tag), stats.CurrentBytes, stats.CurrentCount, stats.PeakBytes, stats.TotalCount);
+		}
+
+		// The logger is still alive while it reports, its memory is not a leak
+		std::vector<MemorySiteStats> leaks = GetLiveSites(SIZE_MAX);
+		std::erase_if(leaks, [](const MemorySiteStats& site) { return site.Tag == MemoryTag::Log; });
+		if (leaks.empty())
+			return;
+
+		size_t leakedBytes = 0;
+		uint64_t leakedCount = 0;
+		for (const MemorySiteStats& site : leaks)
+		{
+			leakedBytes += site.LiveBytes;
+			leakedCount += site.LiveCount;
+		}
+
+		GOJO_LOG_ERROR("Memory", "{} bytes in {} allocations were not released, top sites:", leakedBytes, leakedCount);
+		for (size_t index = 0; index < std::min(maxLeakSites, leaks.size()); ++index)
+		{
+			const MemorySiteStats& site = leaks[index];
+			GOJO_LOG_ERROR("Memory", "  {:>10} bytes in {:>6} allocations [{}] {}:{}", site.LiveBytes, site.LiveCount, GetTagName(site.Tag), site.File, site.Line);
+		}
+	}
+}
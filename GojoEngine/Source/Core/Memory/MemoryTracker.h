@@ -0,0 +1,213 @@
+#pragma once
+
+#include "Core/Macros.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Memory Tags
+	// ====================================================================================================
+
+	// @brief Subsystem an allocation is accounted to.
+	enum class MemoryTag : uint8_t
+	{
+		General,
+		Log,
+		Events,
+		Windows,
+		Vulkan,
+		Jobs,
+		Tasks,
+		FrameMemory,
+		Profiler,
+		ECS,
+		Count
+	};
+
+	// @brief Live and lifetime counters of one tag.
+	struct MemoryTagStats
+	{
+		size_t CurrentBytes{ 0 };
+		size_t PeakBytes{ 0 };
+		uint64_t CurrentCount{ 0 };
+		uint64_t TotalCount{ 0 };							// Allocations since start-up
+	};
+
+	// ====================================================================================================
+	// Allocation Sites
+	// ====================================================================================================
+
+	/**
+	 * @brief One place in the code that allocates tracked memory, created by GOJO_MEMORY_SITE.
+	 *
+	 * Sites are static objects: they register themselves with the tracker on their first allocation and
+	 * keep counting until the process exits, so the leak report can name whoever still holds memory.
+	 */
+	struct MemorySite
+	{
+		constexpr MemorySite(MemoryTag tag, const char* file, uint32_t line)
+			: Tag(tag), File(file), Line(line)
+		{
+		}
+
+		MemorySite(const MemorySite&) = delete;
+		MemorySite& operator=(const MemorySite&) = delete;
+
+		MemoryTag Tag;
+		const char* File;
+		uint32_t Line;
+
+		std::atomic<int64_t> LiveBytes{ 0 };
+		std::atomic<int64_t> LiveCount{ 0 };
+
+		std::atomic<bool> IsRegistered{ false };
+		MemorySite* Next{ nullptr };						// Tracker's list of registered sites
+	};
+
+	// @brief Snapshot of a site that still holds memory.
+	struct MemorySiteStats
+	{
+		MemoryTag Tag{ MemoryTag::General };
+		const char* File{ nullptr };
+		uint32_t Line{ 0 };
+		size_t LiveBytes{ 0 };
+		uint64_t LiveCount{ 0 };
+	};
+
+	// ====================================================================================================
+	// Memory Tracker
+	// ====================================================================================================
+
+	/**
+	 * @brief Accounts every engine allocation to a subsystem tag and to its call site.
+	 *
+	 * Not a manager: allocations happen before the first manager starts and after the last one stops.
+	 * Counters are relaxed atomics, any thread may allocate and free. Each block carries a small header
+	 * (site and size), so freeing needs nothing but the pointer.
+	 */
+	class GOJO_API MemoryTracker final
+	{
+	public:
+		[[nodiscard]] static void* Allocate(size_t size, size_t alignment, MemorySite& site);
+
+		// @brief realloc() semantics: nullptr allocates, a size of 0 frees and returns nullptr.
+		//        Throws std::bad_alloc like Allocate(), "memory" is left intact then.
+		[[nodiscard]] static void* Reallocate(void* memory, size_t size, size_t alignment, MemorySite& site);
+
+		static void Free(void* memory);
+
+		[[nodiscard]] static MemoryTagStats GetTagStats(MemoryTag tag);
+		[[nodiscard]] static std::string_view GetTagName(MemoryTag tag);
+
+		// @brief Sites that still hold memory, the largest first.
+		[[nodiscard]] static std::vector<MemorySiteStats> GetLiveSites(size_t maxCount);
+
+		/**
+		 * @brief Logs the per-tag counters and the sites that still hold memory. Called on shutdown, once
+		 * everything but the logger is gone: Log allocations are left out of the leak list.
+		 */
+		static void LogReport(size_t maxLeakSites = 10);
+	};
+
+	// ====================================================================================================
+	// Tracked Objects
+	// ====================================================================================================
+
+	template<typename T, typename... ArgsT>
+	[[nodiscard]] T* TrackedNew(MemorySite& site, ArgsT&&... args)
+	{
+		void* memory = MemoryTracker::Allocate(sizeof(T), alignof(T), site);
+		return ::new (memory) T(std::forward<ArgsT>(args)...);
+	}
+
+	// @brief Destroys an object created by TrackedNew(), also through a base pointer with a virtual destructor.
+	template<typename T>
+	void TrackedDelete(T* object)
+	{
+		if (!object)
+			return;
+
+		void* memory = nullptr;
+		if constexpr (std::is_polymorphic_v<T>)
+		{
+			memory = dynamic_cast<void*>(object);			// Most derived object, where the block starts
+		}
+		else
+		{
+			memory = object;
+		}
+
+		object->~T();
+		MemoryTracker::Free(memory);
+	}
+
+	/**
+	 * @brief Minimal STL allocator accounting its memory to one tag, for containers and std::allocate_shared.
+	 *        Every instantiation shares one site per element type.
+	 */
+	template<typename T, MemoryTag TagV>
+	class TaggedAllocator
+	{
+	public:
+		using value_type = T;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = TaggedAllocator<U, TagV>;
+		};
+
+		TaggedAllocator() noexcept = default;
+
+		template<typename U>
+		TaggedAllocator(const TaggedAllocator<U, TagV>&) noexcept
+		{
+		}
+
+		[[nodiscard]] T* allocate(size_t count)
+		{
+			return static_cast<T*>(MemoryTracker::Allocate(count * sizeof(T), alignof(T), GetSite()));
+		}
+
+		void deallocate(T* memory, size_t)
+		{
+			MemoryTracker::Free(memory);
+		}
+
+		template<typename U>
+		bool operator==(const TaggedAllocator<U, TagV>&) const noexcept { return true; }
+
+	private:
+		static MemorySite& GetSite()
+		{
+			static MemorySite sSite{ TagV, "TaggedAllocator", 0 };
+			return sSite;
+		}
+	};
+
+	template<typename T, MemoryTag TagV>
+	using TaggedVector = std::vector<T, TaggedAllocator<T, TagV>>;
+}
+
+// ====================================================================================================
+// Macros
+// ====================================================================================================
+
+// @brief Static site of the calling line.
+#define GOJO_MEMORY_SITE(tag)														\
+	([]() -> ::GojoEngine::MemorySite& {											\
+		static ::GojoEngine::MemorySite sSite{ tag, __FILE__, __LINE__ };			\
+		return sSite;																\
+	}())
+
+#define GOJO_NEW(tag, T, ...) ::GojoEngine::TrackedNew<T>(GOJO_MEMORY_SITE(tag) __VA_OPT__(,) __VA_ARGS__)
+#define GOJO_DELETE(object) ::GojoEngine::TrackedDelete(object)
@@ -0,0 +1,360 @@
+#include "Core/Metrics/Metrics.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <type_traits>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		enum class MetricType : uint8_t
+		{
+			Counter,
+			Gauge,
+			Histogram
+		};
+
+		struct MetricSeries
+		{
+			std::string Labels;
+			std::unique_ptr<Counter> CounterMetric;
+			std::unique_ptr<Gauge> GaugeMetric;
+			std::unique_ptr<Histogram> HistogramMetric;
+		};
+
+		struct MetricFamily
+		{
+			std::string Name;
+			std::string Help;
+			MetricType Type{ MetricType::Counter };
+			std::vector<std::unique_ptr<MetricSeries>> Series;
+		};
+
+		struct RegistryData
+		{
+			std::mutex Mutex;
+			std::vector<std::unique_ptr<MetricFamily>> Families;		// Registration order, also the export order
+		};
+
+		RegistryData& GetData()
+		{
+			static RegistryData data;
+			return data;
+		}
+
+		// @brief Threads take the shards round-robin in the order they first record something.
+		std::atomic<uint32_t> sNextThreadShard{ 0 };
+		thread_local const uint32_t tThreadShard = sNextThreadShard.fetch_add(1, std::memory_order_relaxed);
+
+		template<typename T>
+		std::unique_ptr<T>& GetMetric(MetricSeries& series)
+		{
+			if constexpr (std::is_same_v<T, Counter>)
+				return series.CounterMetric;
+			else if constexpr (std::is_same_v<T, Gauge>)
+				return series.GaugeMetric;
+			else
+				return series.HistogramMetric;
+		}
+
+		template<typename T>
+		T& FindOrRegister(MetricType type, std::string_view name, std::string_view help, std::string_view labels)
+		{
+			auto& data = GetData();
+			std::lock_guard lock(data.Mutex);
+
+			MetricFamily* family = nullptr;
+			for (const auto& candidate : data.Families)
+			{
+				if (candidate->Name == name)
+				{
+					GOJO_RUNTIME_ASSERT(candidate->Type == type, "Metric registered again with another type!");
+					if (candidate->Type == type)
+					{
+						family = candidate.get();
+						break;
+					}
+				}
+			}
+
+			if (!family)
+			{
+				auto newFamily = std::make_unique<MetricFamily>();
+				newFamily->Name = name;
+				newFamily->Help = help;
+				newFamily->Type = type;
+				family = newFamily.get();
+				data.Families.push_back(std::move(newFamily));
+			}
+
+			for (const auto& series : family->Series)
+			{
+				if (series->Labels == labels)
+					return *GetMetric<T>(*series);
+			}
+
+			auto series = std::make_unique<MetricSeries>();
+			series->Labels = labels;
+			auto& metric = GetMetric<T>(*series);
+			metric = std::make_unique<T>();
+
+			T& result = *metric;
+			family->Series.push_back(std::move(series));
+			return result;
+		}
+
+		// @brief "{labels}", "{labels,extra}" or nothing at all.
+		std::string FormatLabels(std::string_view labels, std::string_view extra = {})
+		{
+			if (labels.empty() && extra.empty())
+				return {};
+
+			if (labels.empty() || extra.empty())
+				return std::format("{{{}{}}}", labels, extra);
+
+			return std::format("{{{},{}}}", labels, extra);
+		}
+
+		std::string EscapeHelp(std::string_view help)
+		{
+			std::string escaped;
+			escaped.reserve(help.size());
+			for (char character : help)
+			{
+				if (character == '\\')
+					escaped += "\\\\";
+				else if (character == '\n')
+					escaped += "\\n";
+				else
+					escaped.push_back(character);
+			}
+			return escaped;
+		}
+
+		std::string FormatValue(double value)
+		{
+			if (std::isnan(value))
+				return "NaN";
+			if (std::isinf(value))
+				return value > 0.0 ? "+Inf" : "-Inf";
+			return std::format("{}", value);
+		}
+
+		void AppendHistogram(std::string& output, const MetricFamily& family, const MetricSeries& series)
+		{
+			const HistogramSnapshot snapshot = series.HistogramMetric->GetSnapshot();
+
+			// Only buckets that ever received a value are listed: counts never go down, so the set of bounds
+			// of a series only grows and rate() over the buckets stays meaningful
+			uint64_t cumulative = 0;
+			for (size_t index = 0; index < snapshot.Buckets.size(); ++index)
+			{
+				if (snapshot.Buckets[index] == 0)
+					continue;
+
+				cumulative += snapshot.Buckets[index];
+				output += std::format("{}_bucket{} {}\n", family.Name,
+					FormatLabels(series.Labels, std::format("le=\"{}\"", Histogram::GetBucketUpperBound(index))), cumulative);
+			}
+
+			// The count is taken from the buckets, a racing Record() must not make the +Inf bucket smaller than the last one
+			output += std::format("{}_bucket{} {}\n", family.Name, FormatLabels(series.Labels, "le=\"+Inf\""), cumulative);
+			output += std::format("{}_sum{} {}\n", family.Name, FormatLabels(series.Labels), snapshot.Sum);
+			output += std::format("{}_count{} {}\n", family.Name, FormatLabels(series.Labels), cumulative);
+		}
+	}
+
+	// ====================================================================================================
+	// Counter
+	// ====================================================================================================
+
+	void Counter::Add(uint64_t value)
+	{
+		mShards[tThreadShard % cShardCount].Value.fetch_add(value, std::memory_order_relaxed);
+	}
+
+	uint64_t Counter::GetValue() const
+	{
+		uint64_t value = 0;
+		for (const Shard& shard : mShards)
+		{
+			value += shard.Value.load(std::memory_order_relaxed);
+		}
+		return value;
+	}
+
+	// ====================================================================================================
+	// Histogram
+	// ====================================================================================================
+
+	uint64_t HistogramSnapshot::GetValueAtQuantile(double quantile) const
+	{
+		if (Count == 0)
+			return 0;
+
+		const double clamped = quantile < 0.0 ? 0.0 : (quantile > 1.0 ? 1.0 : quantile);
+		const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped * static_cast<double>(Count))));
+
+		uint64_t cumulative = 0;
+		for (size_t index = 0; index < Buckets.size(); ++index)
+		{
+			cumulative += Buckets[index];
+			if (cumulative >= rank)
+				return Histogram::GetBucketUpperBound(index);
+		}
+		return Histogram::GetBucketUpperBound(Buckets.size() - 1);
+	}
+
+	void Histogram::Record(uint64_t value)
+	{
+		Shard& shard = mShards[tThreadShard % cShardCount];
+		shard.Buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+		shard.Sum.fetch_add(value, std::memory_order_relaxed);
+		shard.Count.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	HistogramSnapshot Histogram::GetSnapshot() const
+	{
+		// Shards are read one after the other while others record: the result is a consistent-enough
+		// view for monitoring, "Count" may be a few values ahead of or behind the buckets
+		HistogramSnapshot snapshot;
+		snapshot.Buckets.assign(cBucketCount, 0);
+		for (const Shard& shard : mShards)
+		{
+			snapshot.Count += shard.Count.load(std::memory_order_relaxed);
+			snapshot.Sum += shard.Sum.load(std::memory_order_relaxed);
+			for (size_t index = 0; index < cBucketCount; ++index)
+			{
+				snapshot.Buckets[index] += shard.Buckets[index].load(std::memory_order_relaxed);
+			}
+		}
+		return snapshot;
+	}
+
+	size_t Histogram::GetBucketIndex(uint64_t value)
+	{
+		if (value < cSubBucketCount)
+			return static_cast<size_t>(value);
+
+		if (value > cMaxValue)
+			return cBucketCount - 1;
+
+		// Exponent selects the power of two, the next cSubBucketBits bits below the leading one the sub-bucket
+		const uint32_t shift = static_cast<uint32_t>(std::bit_width(value)) - 1 - cSubBucketBits;
+		const uint64_t subBucket = (value >> shift) - cSubBucketCount;
+		return static_cast<size_t>(shift + 1) * cSubBucketCount + static_cast<size_t>(subBucket);
+	}
+
+	uint64_t Histogram::GetBucketUpperBound(size_t bucketIndex)
+	{
+		if (bucketIndex < cSubBucketCount)
+			return bucketIndex;
+
+		const uint32_t shift = static_cast<uint32_t>(bucketIndex / cSubBucketCount) - 1;
+		const uint64_t subBucket = bucketIndex % cSubBucketCount;
+		return ((cSubBucketCount + subBucket + 1) << shift) - 1;
+	}
+
+	// ====================================================================================================
+	// Metrics Registry
+	// ====================================================================================================
+
+	Counter& MetricsRegistry::GetCounter(std::string_view name, std::string_view help, std::string_view labels)
+	{
+		return FindOrRegister<Counter>(MetricType::Counter, name, help, labels);
+	}
+
+	Gauge& MetricsRegistry::GetGauge(std::string_view name, std::string_view help, std::string_view labels)
+	{
+		return FindOrRegister<Gauge>(MetricType::Gauge, name, help, labels);
+	}
+
+	Histogram& MetricsRegistry::GetHistogram(std::string_view name, std::string_view help, std::string_view labels)
+	{
+		return FindOrRegister<Histogram>(MetricType::Histogram, name, help, labels);
+	}
+
+	std::string MetricsRegistry::GetSnapshot()
+	{
+		auto& data = GetData();
+		std::lock_guard lock(data.Mutex);
+
+		std::string output;
+		for (const auto& family : data.Families)
+		{
+			constexpr std::string_view cTypeNames[] = { "counter", "gauge", "histogram" };
+
+			output += std::format("# HELP {} {}\n", family->Name, EscapeHelp(family->Help));
+			output += std::format("# TYPE {} {}\n", family->Name, cTypeNames[static_cast<size_t>(family->Type)]);
+
+			for (const auto& series : family->Series)
+			{
+				switch (family->Type)
+				{
+				case MetricType::Counter:
+					output += std::format("{}{} {}\n", family->Name, FormatLabels(series->Labels), series->CounterMetric->GetValue());
+					break;
+
+				case MetricType::Gauge:
+					output += std::format("{}{} {}\n", family->Name, FormatLabels(series->Labels), FormatValue(series->GaugeMetric->GetValue()));
+					break;
+
+				case MetricType::Histogram:
+					AppendHistogram(output, *family, *series);
+					break;
+				}
+			}
+		}
+		return output;
+	}
+
+	bool MetricsRegistry::WriteSnapshot(const std::filesystem::path& path)
+	{
+		const std::string snapshot = GetSnapshot();
+
+		std::error_code error;
+		if (path.has_parent_path())
+		{
+			std::filesystem::create_directories(path.parent_path(), error);
+		}
+
+		std::filesystem::path temporaryPath = path;
+		temporaryPath += ".tmp";
+		{
+			std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+			if (!file.write(snapshot.data(), static_cast<std::streamsize>(snapshot.size())))
+				return false;
+		}
+
+		std::filesystem::rename(temporaryPath, path, error);
+		return !error;
+	}
+
+	std::string MetricsRegistry::EscapeLabelValue(std::string_view value)
+	{
+		std::string escaped;
+		escaped.reserve(value.size());
+		for (char character : value)
+		{
+			if (character == '\\')
+				escaped += "\\\\";
+			else if (character == '"')
+				escaped += "\\\"";
+			else if (character == '\n')
+				escaped += "\\n";
+			else
+				escaped.push_back(character);
+		}
+		return escaped;
+	}
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Metric Types
+	// ====================================================================================================
+
+	/**
+	 * @brief Monotonic counter. Every thread adds to its own cache line (threads are spread over a fixed
+	 * number of shards), so hot paths on different threads never contend. Reads sum the shards.
+	 */
+	class GOJO_API Counter final : public NonCopyable
+	{
+	public:
+		static constexpr size_t cShardCount = 16;
+
+		void Add(uint64_t value = 1);
+		[[nodiscard]] uint64_t GetValue() const;
+
+	private:
+		struct alignas(cCacheLineSize) Shard
+		{
+			std::atomic<uint64_t> Value{ 0 };
+		};
+
+		Shard mShards[cShardCount];
+	};
+
+	// @brief Last written value (queue depths, live object counts). Setting it is a single relaxed store.
+	class GOJO_API Gauge final : public NonCopyable
+	{
+	public:
+		void Set(double value) { mValue.store(value, std::memory_order_relaxed); }
+		void Add(double delta) { mValue.fetch_add(delta, std::memory_order_relaxed); }
+		[[nodiscard]] double GetValue() const { return mValue.load(std::memory_order_relaxed); }
+
+	private:
+		alignas(cCacheLineSize) std::atomic<double> mValue{ 0.0 };
+	};
+
+	// @brief Merged content of a histogram, see Histogram::GetSnapshot().
+	struct HistogramSnapshot
+	{
+		uint64_t Count{ 0 };
+		uint64_t Sum{ 0 };
+		std::vector<uint64_t> Buckets;						// Counts by bucket index, not cumulative
+
+		// @brief Upper bound of the bucket holding the given quantile (0..1), 0 if empty.
+		[[nodiscard]] uint64_t GetValueAtQuantile(double quantile) const;
+	};
+
+	/**
+	 * @brief Log-linear (HDR-style) histogram of integer values such as latencies in microseconds.
+	 *
+	 * Each power of two is split in 16 linear sub-buckets, so any recorded value is known within 1/16
+	 * (about 6%) over the whole range without configuring bounds. Values above cMaxValue land in the last
+	 * bucket. Recording is a bit scan and two relaxed increments in the shard of the calling thread.
+	 */
+	class GOJO_API Histogram final : public NonCopyable
+	{
+	public:
+		static constexpr uint32_t cSubBucketBits = 4;
+		static constexpr uint32_t cSubBucketCount = 1u << cSubBucketBits;
+		static constexpr uint32_t cMaxValueBits = 40;										// ~1.1e12
+		static constexpr uint64_t cMaxValue = (uint64_t{ 1 } << cMaxValueBits) - 1;
+		static constexpr size_t cBucketCount = (cMaxValueBits - cSubBucketBits + 1) * cSubBucketCount;
+		static constexpr size_t cShardCount = 4;
+
+		void Record(uint64_t value);
+		[[nodiscard]] HistogramSnapshot GetSnapshot() const;
+
+		[[nodiscard]] static size_t GetBucketIndex(uint64_t value);
+		// @brief Largest value that falls into "bucketIndex".
+		[[nodiscard]] static uint64_t GetBucketUpperBound(size_t bucketIndex);
+
+	private:
+		struct alignas(cCacheLineSize) Shard
+		{
+			std::atomic<uint64_t> Count{ 0 };
+			std::atomic<uint64_t> Sum{ 0 };
+			std::atomic<uint64_t> Buckets[cBucketCount]{};
+		};
+
+		Shard mShards[cShardCount];
+	};
+
+	// ====================================================================================================
+	// Metrics Registry
+	// ====================================================================================================
+
+	/**
+	 * @brief Process-wide set of named metrics, exported in the Prometheus text format.
+	 *
+	 * Not a manager: counters are registered by whoever needs them, also before the first manager starts.
+	 * Registration takes a lock and returns a reference that stays valid until the process exits, hot
+	 * paths look their metrics up once and keep the reference. Asking again for the same name and labels
+	 * returns the same metric.
+	 *
+	 * Names follow the Prometheus rules ("gojo_events_dispatched_total"), labels are passed in their
+	 * exposition form without braces: type="KeyPressed",window="1".
+	 */
+	class GOJO_API MetricsRegistry final
+	{
+	public:
+		static Counter& GetCounter(std::string_view name, std::string_view help, std::string_view labels = {});
+		static Gauge& GetGauge(std::string_view name, std::string_view help, std::string_view labels = {});
+		static Histogram& GetHistogram(std::string_view name, std::string_view help, std::string_view labels = {});
+
+		// @brief Every metric in the Prometheus text exposition format (version 0.0.4).
+		[[nodiscard]] static std::string GetSnapshot();
+
+		// @brief Writes GetSnapshot() next to "path" and renames it over, readers never see a partial file.
+		static bool WriteSnapshot(const std::filesystem::path& path);
+
+		// @brief Escapes a label value for the labels argument (backslashes, quotes and line breaks).
+		[[nodiscard]] static std::string EscapeLabelValue(std::string_view value);
+	};
+}
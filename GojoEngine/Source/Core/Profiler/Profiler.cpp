@@ -0,0 +1,337 @@
+#include "Core/Profiler/Profiler.h"
+#include "Core/Memory/MemoryTracker.h"
+
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		constexpr size_t cRecordsPerChunk = 4096;
+
+		enum class RecordType : uint8_t
+		{
+			Zone,
+			Frame,
+			Counter
+		};
+
+		struct ProfileRecord
+		{
+			const char* Name;
+			uint64_t Start;
+			uint64_t End;
+			double Value;
+			RecordType Type;
+		};
+
+		struct RecordChunk
+		{
+			std::atomic<RecordChunk*> Next{ nullptr };
+			ProfileRecord Records[cRecordsPerChunk];
+		};
+
+		/**
+		 * @brief Records of one thread. Only the owner writes; "Count" publishes the records to the exporter,
+		 * chunks are reused across captures and only freed by ReleaseMemory().
+		 */
+		struct ThreadBuffer
+		{
+			uint32_t ThreadIndex{ 0 };
+			std::string Name;									// Guarded by the registry mutex
+
+			RecordChunk* First{ nullptr };
+			RecordChunk* Current{ nullptr };
+			size_t CurrentOffset{ 0 };
+
+			std::atomic<uint64_t> CaptureId{ 0 };
+			std::atomic<size_t> Count{ 0 };
+		};
+
+		struct ThreadBufferSlot
+		{
+			uint64_t Generation{ 0 };							// Buffer set the pointer belongs to
+			ThreadBuffer* Buffer{ nullptr };
+		};
+
+		// @brief Clock sample taken when a capture starts, converts raw timestamps to microseconds.
+		struct ClockAnchor
+		{
+			uint64_t Timestamp{ 0 };
+			std::chrono::steady_clock::time_point Time;
+		};
+
+		struct ProfilerData
+		{
+			std::mutex Mutex;
+			std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+			ClockAnchor CaptureStart;
+		};
+
+		std::atomic<bool> sIsCapturing{ false };
+		std::atomic<uint64_t> sCaptureId{ 0 };
+		std::atomic<uint64_t> sBufferGeneration{ 1 };
+
+		thread_local ThreadBufferSlot tThreadBuffer;
+
+		ProfilerData& GetData()
+		{
+			static ProfilerData data;
+			return data;
+		}
+
+		// @brief The cycle counter where there is one: a handful of cycles instead of a system call.
+		uint64_t ReadTimestamp()
+		{
+#if defined(_M_X64) || defined(__x86_64__)
+			return __rdtsc();
+#else
+			return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+		}
+
+		RecordChunk* AllocateChunk()
+		{
+			// Default-initialized: the records are written before they are read
+			void* memory = MemoryTracker::Allocate(sizeof(RecordChunk), alignof(RecordChunk), GOJO_MEMORY_SITE(MemoryTag::Profiler));
+			return ::new (memory) RecordChunk;
+		}
+
+		ThreadBuffer& GetThreadBuffer()
+		{
+			if (tThreadBuffer.Generation != sBufferGeneration.load(std::memory_order_acquire))
+			{
+				auto& data = GetData();
+				std::lock_guard lock(data.Mutex);
+
+				auto buffer = std::make_unique<ThreadBuffer>();
+				buffer->ThreadIndex = static_cast<uint32_t>(data.Buffers.size());
+				buffer->Name = std::format("Thread {}", buffer->ThreadIndex);
+
+				tThreadBuffer = { sBufferGeneration.load(std::memory_order_relaxed), buffer.get() };
+				data.Buffers.push_back(std::move(buffer));
+			}
+			return *tThreadBuffer.Buffer;
+		}
+
+		void WriteRecord(const ProfileRecord& record)
+		{
+			ThreadBuffer& buffer = GetThreadBuffer();
+
+			// First record of a new capture: the old records are dropped, the chunks stay. Threads that never
+			// record (named workers of a session without capture) never allocate one.
+			const uint64_t captureId = sCaptureId.load(std::memory_order_acquire);
+			if (buffer.CaptureId.load(std::memory_order_relaxed) != captureId)
+			{
+				if (!buffer.First)
+				{
+					buffer.First = AllocateChunk();
+				}
+
+				buffer.Count.store(0, std::memory_order_relaxed);
+				buffer.Current = buffer.First;
+				buffer.CurrentOffset = 0;
+				buffer.CaptureId.store(captureId, std::memory_order_release);
+			}
+
+			if (buffer.CurrentOffset == cRecordsPerChunk)
+			{
+				RecordChunk* next = buffer.Current->Next.load(std::memory_order_relaxed);
+				if (!next)
+				{
+					next = AllocateChunk();
+					buffer.Current->Next.store(next, std::memory_order_release);
+				}
+				buffer.Current = next;
+				buffer.CurrentOffset = 0;
+			}
+
+			buffer.Current->Records[buffer.CurrentOffset++] = record;
+			buffer.Count.store(buffer.Count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		// @brief JSON string content (names are literals, but quotes and backslashes stay valid JSON).
+		std::string EscapeJson(std::string_view text)
+		{
+			std::string escaped;
+			escaped.reserve(text.size());
+			for (char character : text)
+			{
+				if (character == '"' || character == '\\')
+				{
+					escaped.push_back('\\');
+				}
+				escaped.push_back(static_cast<unsigned char>(character) < 0x20 ? ' ' : character);
+			}
+			return escaped;
+		}
+	}
+
+	// ====================================================================================================
+	// Profiler
+	// ====================================================================================================
+
+	void Profiler::StartCapture()
+	{
+		auto& data = GetData();
+		std::lock_guard lock(data.Mutex);
+
+		data.CaptureStart = { ReadTimestamp(), std::chrono::steady_clock::now() };
+		sCaptureId.fetch_add(1, std::memory_order_release);
+		sIsCapturing.store(true, std::memory_order_release);
+	}
+
+	void Profiler::StopCapture()
+	{
+		sIsCapturing.store(false, std::memory_order_release);
+	}
+
+	bool Profiler::IsCapturing()
+	{
+		return sIsCapturing.load(std::memory_order_relaxed);
+	}
+
+	bool Profiler::ExportChromeTrace(const std::filesystem::path& path)
+	{
+		auto& data = GetData();
+		std::lock_guard lock(data.Mutex);
+
+		const uint64_t captureId = sCaptureId.load(std::memory_order_acquire);
+		if (captureId == 0)
+			return false;
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file)
+			return false;
+
+		// Raw timestamps are mapped linearly between the capture start and now
+		const ClockAnchor start = data.CaptureStart;
+		const ClockAnchor now{ ReadTimestamp(), std::chrono::steady_clock::now() };
+		const double elapsedMicroseconds = std::chrono::duration<double, std::micro>(now.Time - start.Time).count();
+		const double microsecondsPerTick = now.Timestamp > start.Timestamp ? elapsedMicroseconds / static_cast<double>(now.Timestamp - start.Timestamp) : 0.0;
+		const auto toMicroseconds = [&](uint64_t timestamp)
+			{
+				return timestamp > start.Timestamp ? static_cast<double>(timestamp - start.Timestamp) * microsecondsPerTick : 0.0;
+			};
+
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		file << R"({"name":"process_name","ph":"M","pid":1,"tid":0,"args":{"name":"GojoEngine"}})";
+
+		for (const auto& buffer : data.Buffers)
+		{
+			file << std::format(",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+				buffer->ThreadIndex, EscapeJson(buffer->Name));
+
+			// A thread that did not write since the capture started still holds older records. Once it moved
+			// to this capture its count only grows until the next StartCapture(), which waits for the mutex.
+			if (buffer->CaptureId.load(std::memory_order_acquire) != captureId)
+				continue;
+
+			const size_t count = buffer->Count.load(std::memory_order_acquire);
+
+			const RecordChunk* chunk = buffer->First;
+			for (size_t index = 0; index < count; ++index)
+			{
+				if (index > 0 && index % cRecordsPerChunk == 0)
+				{
+					chunk = chunk->Next.load(std::memory_order_acquire);
+				}
+
+				const ProfileRecord& record = chunk->Records[index % cRecordsPerChunk];
+				switch (record.Type)
+				{
+				case RecordType::Zone:
+					file << std::format(",\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+						EscapeJson(record.Name), buffer->ThreadIndex, toMicroseconds(record.Start), toMicroseconds(record.End) - toMicroseconds(record.Start));
+					break;
+
+				case RecordType::Frame:
+					file << std::format(",\n{{\"name\":\"Frame {}\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":{},\"ts\":{:.3f}}}",
+						static_cast<uint64_t>(record.Value), buffer->ThreadIndex, toMicroseconds(record.Start));
+					break;
+
+				case RecordType::Counter:
+					file << std::format(",\n{{\"name\":\"{}\",\"ph\":\"C\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"args\":{{\"value\":{}}}}}",
+						EscapeJson(record.Name), buffer->ThreadIndex, toMicroseconds(record.Start), record.Value);
+					break;
+				}
+			}
+		}
+
+		file << "\n]}\n";
+		return static_cast<bool>(file);
+	}
+
+	void Profiler::SetThreadName(std::string_view name)
+	{
+		ThreadBuffer& buffer = GetThreadBuffer();
+
+		std::lock_guard lock(GetData().Mutex);
+		buffer.Name = name;
+	}
+
+	uint64_t Profiler::BeginZone()
+	{
+		return sIsCapturing.load(std::memory_order_relaxed) ? ReadTimestamp() : 0;
+	}
+
+	void Profiler::EndZone(const char* name, uint64_t start)
+	{
+		WriteRecord({ name, start, ReadTimestamp(), 0.0, RecordType::Zone });
+	}
+
+	void Profiler::MarkFrame(uint64_t frameIndex)
+	{
+		if (sIsCapturing.load(std::memory_order_relaxed))
+		{
+			const uint64_t now = ReadTimestamp();
+			WriteRecord({ nullptr, now, now, static_cast<double>(frameIndex), RecordType::Frame });
+		}
+	}
+
+	void Profiler::SetCounter(const char* name, double value)
+	{
+		if (sIsCapturing.load(std::memory_order_relaxed))
+		{
+			const uint64_t now = ReadTimestamp();
+			WriteRecord({ name, now, now, value, RecordType::Counter });
+		}
+	}
+
+	void Profiler::ReleaseMemory()
+	{
+		auto& data = GetData();
+		std::lock_guard lock(data.Mutex);
+
+		// Threads still holding a pointer see the new generation and start over with a fresh buffer
+		sBufferGeneration.fetch_add(1, std::memory_order_acq_rel);
+
+		for (const auto& buffer : data.Buffers)
+		{
+			RecordChunk* chunk = buffer->First;
+			while (chunk)
+			{
+				RecordChunk* next = chunk->Next.load(std::memory_order_relaxed);
+				TrackedDelete(chunk);
+				chunk = next;
+			}
+		}
+		data.Buffers.clear();
+	}
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Core/Macros.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+// ================================================================================
+// Compile-Time Switch
+// ================================================================================
+#ifndef GOJO_PROFILER_ENABLED
+#define GOJO_PROFILER_ENABLED 1
+#endif
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Profiler Types
+	// ====================================================================================================
+
+	struct ProfilerSettings
+	{
+		bool CaptureOnStartUp{ false };						// Start capturing before the first manager starts
+		std::filesystem::path TracePath;					// A capture still running at shutdown is exported here
+	};
+
+	// ====================================================================================================
+	// Profiler
+	// ====================================================================================================
+
+	/**
+	 * @brief Instrumenting CPU profiler: zones, frame markers and counters, exported as Chrome trace JSON
+	 * (chrome://tracing, ui.perfetto.dev).
+	 *
+	 * Every thread records into its own chunked buffer without locks, a zone is two timestamp reads and
+	 * one record. Nothing is recorded while no capture runs. StartCapture() discards the previous capture,
+	 * threads drop their old records lazily on their next write. Zone and counter names must be string
+	 * literals (or otherwise outlive the capture).
+	 */
+	class GOJO_API Profiler final
+	{
+	public:
+		static void StartCapture();
+		static void StopCapture();
+		[[nodiscard]] static bool IsCapturing();
+
+		// @brief Writes the records of the current (or last) capture. May run while capturing.
+		static bool ExportChromeTrace(const std::filesystem::path& path);
+
+		// @brief Name of the calling thread in the exported trace.
+		static void SetThreadName(std::string_view name);
+
+		// @brief Timestamp for EndZone(), 0 while no capture runs.
+		[[nodiscard]] static uint64_t BeginZone();
+		static void EndZone(const char* name, uint64_t start);
+
+		static void MarkFrame(uint64_t frameIndex);
+		static void SetCounter(const char* name, double value);
+
+		// @brief Frees every thread buffer. Only once the other recording threads are gone (shutdown).
+		static void ReleaseMemory();
+	};
+
+	// @brief RAII zone, see GOJO_PROFILE_SCOPE.
+	class ProfileScope final
+	{
+	public:
+		explicit ProfileScope(const char* name)
+			: mName(name), mStart(Profiler::BeginZone())
+		{
+		}
+
+		~ProfileScope()
+		{
+			if (mStart != 0)
+			{
+				Profiler::EndZone(mName, mStart);
+			}
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		const char* mName;
+		uint64_t mStart;
+	};
+}
+
+// ================================================================================
+// Macros
+// ================================================================================
+#define GOJO_PROFILE_CONCAT_IMPL(a, b) a##b
+#define GOJO_PROFILE_CONCAT(a, b) GOJO_PROFILE_CONCAT_IMPL(a, b)
+
+#if GOJO_PROFILER_ENABLED
+#define GOJO_PROFILE_SCOPE(name) ::GojoEngine::ProfileScope GOJO_PROFILE_CONCAT(gojoProfileScope, __LINE__)(name)
+#define GOJO_PROFILE_FUNCTION() GOJO_PROFILE_SCOPE(__func__)
+#define GOJO_PROFILE_FRAME(frameIndex) ::GojoEngine::Profiler::MarkFrame(frameIndex)
+#define GOJO_PROFILE_COUNTER(name, value) ::GojoEngine::Profiler::SetCounter(name, static_cast<double>(value))
+#else
+#define GOJO_PROFILE_SCOPE(name)
+#define GOJO_PROFILE_FUNCTION()
+#define GOJO_PROFILE_FRAME(frameIndex)
+#define GOJO_PROFILE_COUNTER(name, value)
+#endif
@@ -0,0 +1,238 @@
+#include "Core/StartupGraph.h"
+#include "Core/Profiler/Profiler.h"
+#include "Managers/JobSystem/JobSystem.h"
+#include "Managers/LogManager/LogManager.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <format>
+#include <mutex>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		// @brief Stages that finished on workers, handed back to the thread driving the startup.
+		struct FinishedStages
+		{
+			std::mutex Mutex;
+			std::condition_variable Signal;
+			std::vector<size_t> Indices;
+		};
+
+		double MillisecondsSince(std::chrono::steady_clock::time_point startTime)
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+		}
+	}
+
+	// ====================================================================================================
+	// StartupGraph
+	// ====================================================================================================
+
+	void StartupGraph::Add(StartupStage stage)
+	{
+		mStages.push_back(std::move(stage));
+	}
+
+	std::expected<void, StartupError> StartupGraph::StartUp()
+	{
+		const size_t stageCount = mStages.size();
+
+		// Edges by index: "dependents[i]" start once stage i did, "remaining[i]" counts unstarted dependencies
+		std::vector<std::vector<size_t>> dependents(stageCount);
+		std::vector<uint32_t> remaining(stageCount, 0);
+
+		const auto findStage = [this](const char* name) -> size_t
+			{
+				for (size_t index = 0; index < mStages.size(); ++index)
+				{
+					if (std::strcmp(mStages[index].Name, name) == 0)
+						return index;
+				}
+				return mStages.size();
+			};
+
+		for (size_t index = 0; index < stageCount; ++index)
+		{
+			if (findStage(mStages[index].Name) != index)
+				return std::unexpected(StartupError::DuplicateStage);
+
+			for (const char* dependency : mStages[index].Dependencies)
+			{
+				const size_t dependencyIndex = findStage(dependency);
+				if (dependencyIndex == stageCount)
+					return std::unexpected(StartupError::UnknownDependency);
+
+				dependents[dependencyIndex].push_back(index);
+				++remaining[index];
+			}
+		}
+
+		// Kahn's algorithm on a copy: every stage must become ready at some point
+		{
+			std::vector<uint32_t> pending = remaining;
+			std::vector<size_t> ready;
+			for (size_t index = 0; index < stageCount; ++index)
+			{
+				if (pending[index] == 0)
+					ready.push_back(index);
+			}
+
+			size_t visitedCount = 0;
+			while (!ready.empty())
+			{
+				const size_t index = ready.back();
+				ready.pop_back();
+				++visitedCount;
+
+				for (size_t dependent : dependents[index])
+				{
+					if (--pending[dependent] == 0)
+						ready.push_back(dependent);
+				}
+			}
+
+			if (visitedCount != stageCount)
+				return std::unexpected(StartupError::DependencyCycle);
+		}
+
+		mTimings.assign(stageCount, StartupTiming{});
+		mStartedOrder.clear();
+		mStartedOrder.reserve(stageCount);
+
+		const auto startTime = std::chrono::steady_clock::now();
+		FinishedStages finished;
+		JobCounter workerStages;
+		bool usedWorkers = false;
+		std::vector<size_t> mainThreadReady;
+
+		const auto launch = [&](size_t index)
+			{
+				if (mStages[index].Thread == StartupThread::Main || !JobSystem::IsInitialized())
+				{
+					mainThreadReady.push_back(index);
+					return;
+				}
+
+				usedWorkers = true;
+				FinishedStages* finishedStages = &finished;
+				JobSystem::GetInstance().Run([this, finishedStages, index, startTime]()
+					{
+						RunStage(index, startTime);
+
+						std::lock_guard lock(finishedStages->Mutex);
+						finishedStages->Indices.push_back(index);
+						finishedStages->Signal.notify_one();
+					}, &workerStages);
+			};
+
+		for (size_t index = 0; index < stageCount; ++index)
+		{
+			if (remaining[index] == 0)
+				launch(index);
+		}
+
+		std::vector<size_t> justFinished;
+		while (mStartedOrder.size() < stageCount)
+		{
+			justFinished.clear();
+			{
+				std::unique_lock lock(finished.Mutex);
+				if (mainThreadReady.empty())
+				{
+					finished.Signal.wait(lock, [&finished]() { return !finished.Indices.empty(); });
+				}
+				justFinished.swap(finished.Indices);
+			}
+
+			// Worker results first, so their dependents are queued before the main thread is busy again
+			if (justFinished.empty() && !mainThreadReady.empty())
+			{
+				const size_t index = mainThreadReady.front();
+				mainThreadReady.erase(mainThreadReady.begin());
+
+				RunStage(index, startTime);
+				justFinished.push_back(index);
+			}
+
+			for (size_t index : justFinished)
+			{
+				mStartedOrder.push_back(index);
+				for (size_t dependent : dependents[index])
+				{
+					if (--remaining[dependent] == 0)
+						launch(dependent);
+				}
+			}
+		}
+
+		// The jobs signalled before returning, wait until they are fully done with "finished"
+		if (usedWorkers)
+		{
+			JobSystem::GetInstance().Wait(workerStages);
+		}
+
+		mTotalMs = MillisecondsSince(startTime);
+		return {};
+	}
+
+	void StartupGraph::ShutDown()
+	{
+		// Reverse start order is a reverse topological order: dependents go first
+		for (auto it = mStartedOrder.rbegin(); it != mStartedOrder.rend(); ++it)
+		{
+			StartupStage& stage = mStages[*it];
+			if (stage.ShutDown)
+			{
+				ProfileScope zone(stage.Name);
+				stage.ShutDown();
+			}
+		}
+		mStartedOrder.clear();
+	}
+
+	void StartupGraph::LogReport() const
+	{
+		std::vector<size_t> order(mTimings.size());
+		for (size_t index = 0; index < order.size(); ++index)
+		{
+			order[index] = index;
+		}
+		std::sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs) { return mTimings[lhs].StartMs < mTimings[rhs].StartMs; });
+
+		double workMs = 0.0;
+		for (const StartupTiming& timing : mTimings)
+		{
+			workMs += timing.DurationMs;
+		}
+
+		GOJO_LOG_INFO("Engine", "Startup took {:.2f} ms for {:.2f} ms of work in {} stages:", mTotalMs, workMs, mTimings.size());
+		for (size_t index : order)
+		{
+			const StartupTiming& timing = mTimings[index];
+			GOJO_LOG_INFO("Engine", "  {:<24} {:>8.2f} ms  (at {:>8.2f} ms, {})", timing.Name, timing.DurationMs, timing.StartMs,
+				timing.ThreadIndex == 0 ? std::string("main thread") : std::format("worker {}", timing.ThreadIndex));
+		}
+	}
+
+	void StartupGraph::RunStage(size_t index, std::chrono::steady_clock::time_point startTime)
+	{
+		StartupStage& stage = mStages[index];
+		StartupTiming& timing = mTimings[index];
+		timing.Name = stage.Name;
+		timing.ThreadIndex = JobSystem::GetCurrentThreadIndex();
+		timing.StartMs = MillisecondsSince(startTime);
+
+		{
+			ProfileScope zone(stage.Name);
+			stage.StartUp();
+		}
+
+		timing.DurationMs = MillisecondsSince(startTime) - timing.StartMs;
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Delegate.h"
+
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Startup Types
+	// ====================================================================================================
+
+	enum class StartupThread : uint8_t
+	{
+		Any,											// Runs on a worker once the JobSystem is up
+		Main											// Thread-affine (GLFW, thread-local state, ...)
+	};
+
+	/**
+	 * @brief One subsystem of the engine startup. Names and dependencies are string literals, a stage starts
+	 * once every stage it depends on started and shuts down before any of them.
+	 */
+	struct StartupStage
+	{
+		const char* Name{ nullptr };
+		std::vector<const char*> Dependencies;
+		StartupThread Thread{ StartupThread::Any };
+		Delegate<void()> StartUp;
+		Delegate<void()> ShutDown;						// Optional
+	};
+
+	struct StartupTiming
+	{
+		const char* Name{ nullptr };
+		double StartMs{ 0.0 };							// Since the startup began
+		double DurationMs{ 0.0 };
+		uint32_t ThreadIndex{ 0 };						// JobSystem::GetCurrentThreadIndex(), 0 is the main thread
+	};
+
+	enum class StartupError
+	{
+		DuplicateStage,
+		UnknownDependency,
+		DependencyCycle
+	};
+
+	// ====================================================================================================
+	// Startup Graph
+	// ====================================================================================================
+
+	/**
+	 * @brief Starts stages in dependency order, independent ones concurrently, and shuts them down in
+	 * the reverse order they finished starting.
+	 *
+	 * Main stages run on the calling thread. Any stages become jobs as soon as the JobSystem is initialized
+	 * (they run on the calling thread before that), so slow independent work such as the Vulkan instance
+	 * overlaps with the thread-affine managers.
+	 */
+	class GOJO_API StartupGraph final
+	{
+	public:
+		void Add(StartupStage stage);
+
+		// @brief Validates the graph (nothing runs if it is invalid) and starts every stage.
+		[[nodiscard]] std::expected<void, StartupError> StartUp();
+		void ShutDown();
+
+		[[nodiscard]] std::span<const StartupTiming> GetTimings() const { return mTimings; }
+		[[nodiscard]] double GetTotalMs() const { return mTotalMs; }
+
+		// @brief Logs the per-stage timings, in the order the stages started.
+		void LogReport() const;
+
+	private:
+		void RunStage(size_t index, std::chrono::steady_clock::time_point startTime);
+
+	private:
+		std::vector<StartupStage> mStages;
+		std::vector<StartupTiming> mTimings;			// Indexed like "mStages"
+		std::vector<size_t> mStartedOrder;				// Order the stages finished starting
+		double mTotalMs{ 0.0 };
+	};
+}
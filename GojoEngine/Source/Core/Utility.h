@@ -1,7 +1,45 @@
 #pragma once
 
+#include <cstddef>
+#include <string_view>
+
 namespace GojoEngine
 {
+	// @brief Alignment that keeps data written by different threads on separate cache lines.
+	//        Fixed instead of std::hardware_destructive_interference_size, whose value may differ between compilers and flags.
+	constexpr size_t cCacheLineSize = 64;
+
+	// @brief Qualified name of T as the compiler spells it, used as a process-wide key of types.
+	//        Types in anonymous namespaces of different files may share a name.
+	template<typename T>
+	constexpr std::string_view GetTypeName()
+	{
+#if defined(_MSC_VER)
+		constexpr std::string_view signature = __FUNCSIG__;
+		constexpr std::string_view prefix = "GetTypeName<";
+		constexpr size_t begin = signature.find(prefix) + prefix.size();
+		constexpr size_t end = signature.rfind(">(void)");
+		std::string_view name = signature.substr(begin, end - begin);
+
+		// MSVC spells the kind of class types: "class GojoEngine::KeyPressedEvent"
+		for (const std::string_view keyword : { std::string_view("class "), std::string_view("struct "), std::string_view("enum ") })
+		{
+			if (name.starts_with(keyword))
+			{
+				name.remove_prefix(keyword.size());
+			}
+		}
+		return name;
+#else
+		// GCC appends the typedefs it used: "[with T = Name; std::string_view = ...]"
+		constexpr std::string_view signature = __PRETTY_FUNCTION__;
+		constexpr std::string_view prefix = "T = ";
+		constexpr size_t begin = signature.find(prefix) + prefix.size();
+		constexpr size_t end = signature.find_first_of(";]", begin);
+		return signature.substr(begin, end - begin);
+#endif
+	}
+
 	/**
 	 * @brief Inherit from this class to prevent copying and moving of the derived class.
 	 */
@@ -0,0 +1,161 @@
+#include "ECS/Archetype.h"
+#include "Managers/LogManager/LogManager.h"
+
+#include <algorithm>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		constexpr size_t AlignUp(size_t value, size_t alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+	}
+
+	// ====================================================================================================
+	// Archetype
+	// ====================================================================================================
+
+	Archetype::Archetype(const ComponentMask& mask, FixedSizePool& chunkPool)
+		: mMask(mask), mChunkPool(chunkPool)
+	{
+		mColumnByType.fill(cNoColumn);
+
+		size_t rowSize = sizeof(Entity);
+		for (ComponentTypeId type = 1; type < cMaxComponentTypes; ++type)
+		{
+			if (!mMask.test(type))
+				continue;
+
+			const ComponentTypeInfo& info = ComponentTypeRegistry::GetInfo(type);
+			mColumnByType[type] = static_cast<uint8_t>(mTypes.size());
+			mTypes.push_back(type);
+			mInfos.push_back(&info);
+			mColumnSizes.push_back(info.Size);
+			rowSize += info.Size;
+		}
+
+		// Largest capacity whose columns, each aligned for its type, still fit into one chunk
+		mColumnOffsets.resize(mTypes.size());
+		for (size_t capacity = cChunkSize / rowSize; capacity > 0; --capacity)
+		{
+			size_t offset = sizeof(Entity) * capacity;
+			for (size_t column = 0; column < mTypes.size(); ++column)
+			{
+				offset = AlignUp(offset, mInfos[column]->Alignment);
+				mColumnOffsets[column] = static_cast<uint32_t>(offset);
+				offset += static_cast<size_t>(mColumnSizes[column]) * capacity;
+			}
+
+			if (offset <= cChunkSize)
+			{
+				mChunkCapacity = static_cast<uint32_t>(capacity);
+				break;
+			}
+		}
+		GOJO_ASSERT_MESSAGE(mChunkCapacity > 0, "Components of one entity do not fit into an archetype chunk!");
+	}
+
+	Archetype::~Archetype()
+	{
+		for (size_t chunkIndex = 0; chunkIndex < mChunks.size(); ++chunkIndex)
+		{
+			const uint32_t count = GetChunkEntityCount(chunkIndex);
+			for (uint32_t column = 0; column < mTypes.size(); ++column)
+			{
+				const ComponentTypeInfo& info = *mInfos[column];
+				if (!info.Destroy)
+					continue;
+
+				std::byte* components = static_cast<std::byte*>(GetChunkColumn(chunkIndex, column));
+				for (uint32_t index = 0; index < count; ++index)
+				{
+					info.Destroy(components + static_cast<size_t>(index) * info.Size);
+				}
+			}
+			mChunkPool.Free(mChunks[chunkIndex]);
+		}
+	}
+
+	uint32_t Archetype::AddRow(Entity entity)
+	{
+		if (mEntityCount == mChunks.size() * mChunkCapacity)
+		{
+			mChunks.push_back(static_cast<std::byte*>(mChunkPool.Allocate()));
+		}
+
+		const uint32_t row = mEntityCount++;
+		GetChunkEntities(row / mChunkCapacity)[row % mChunkCapacity] = entity;
+		return row;
+	}
+
+	Entity Archetype::RemoveRow(uint32_t row)
+	{
+		for (uint32_t column = 0; column < mTypes.size(); ++column)
+		{
+			DestroyComponent(*mInfos[column], GetComponent(row, column));
+		}
+		return PopRowInto(row);
+	}
+
+	Entity Archetype::MoveRow(uint32_t row, Archetype& destination, uint32_t& outDestinationRow)
+	{
+		outDestinationRow = destination.AddRow(GetEntity(row));
+
+		for (uint32_t column = 0; column < mTypes.size(); ++column)
+		{
+			const uint32_t destinationColumn = destination.GetColumn(mTypes[column]);
+			if (destinationColumn != cNoColumn)
+			{
+				RelocateComponent(*mInfos[column], destination.GetComponent(outDestinationRow, destinationColumn), GetComponent(row, column));
+			}
+			else
+			{
+				DestroyComponent(*mInfos[column], GetComponent(row, column));
+			}
+		}
+		return PopRowInto(row);
+	}
+
+	Archetype* Archetype::FindEdge(ComponentTypeId type, bool isAdd) const
+	{
+		const auto& edges = isAdd ? mAddEdges : mRemoveEdges;
+		auto it = edges.find(type);
+		return it != edges.end() ? it->second : nullptr;
+	}
+
+	void Archetype::SetEdge(ComponentTypeId type, bool isAdd, Archetype* archetype)
+	{
+		(isAdd ? mAddEdges : mRemoveEdges)[type] = archetype;
+	}
+
+	Entity Archetype::PopRowInto(uint32_t row)
+	{
+		const uint32_t lastRow = mEntityCount - 1;
+
+		Entity movedEntity;
+		if (row != lastRow)
+		{
+			for (uint32_t column = 0; column < mTypes.size(); ++column)
+			{
+				RelocateComponent(*mInfos[column], GetComponent(row, column), GetComponent(lastRow, column));
+			}
+
+			movedEntity = GetEntity(lastRow);
+			GetChunkEntities(row / mChunkCapacity)[row % mChunkCapacity] = movedEntity;
+		}
+
+		// The last chunk is returned as soon as it is empty, the pool keeps the memory around
+		--mEntityCount;
+		if (mEntityCount == (mChunks.size() - 1) * mChunkCapacity)
+		{
+			mChunkPool.Free(mChunks.back());
+			mChunks.pop_back();
+		}
+		return movedEntity;
+	}
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+#include "Core/Memory/FixedSizePool.h"
+#include "ECS/Component.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Archetype
+	// ====================================================================================================
+
+	/**
+	 * @brief Every entity with exactly one set of component types, stored in fixed-size chunks.
+	 *
+	 * A chunk holds the entity handles followed by one array per component type (struct of arrays), so a
+	 * query touching two components of a 20-component archetype only streams those two arrays. Rows are
+	 * dense over the chunks: only the last chunk is partly filled, row "r" lives in chunk r / capacity.
+	 * Removing a row moves the last row into the hole, the caller fixes the location of the moved entity.
+	 *
+	 * Owned by a World, which also creates and caches the archetype graph edges (add / remove one type).
+	 */
+	class GOJO_API Archetype final : public NonCopyable
+	{
+	public:
+		static constexpr size_t cChunkSize = 16 * 1024;
+		static constexpr uint8_t cNoColumn = 0xFF;
+
+		Archetype(const ComponentMask& mask, FixedSizePool& chunkPool);
+		~Archetype() override;
+
+		[[nodiscard]] const ComponentMask& GetMask() const { return mMask; }
+		[[nodiscard]] std::span<const ComponentTypeId> GetComponentTypes() const { return mTypes; }
+
+		// @return Column of "type", cNoColumn if the archetype does not have it.
+		[[nodiscard]] uint32_t GetColumn(ComponentTypeId type) const { return mColumnByType[type]; }
+
+		[[nodiscard]] uint32_t GetChunkCapacity() const { return mChunkCapacity; }
+		[[nodiscard]] uint32_t GetEntityCount() const { return mEntityCount; }
+		[[nodiscard]] size_t GetChunkCount() const { return mChunks.size(); }
+
+		[[nodiscard]] uint32_t GetChunkEntityCount(size_t chunkIndex) const
+		{
+			return chunkIndex + 1 < mChunks.size() ? mChunkCapacity : mEntityCount - static_cast<uint32_t>(chunkIndex) * mChunkCapacity;
+		}
+
+		[[nodiscard]] Entity* GetChunkEntities(size_t chunkIndex) const
+		{
+			return reinterpret_cast<Entity*>(mChunks[chunkIndex]);
+		}
+
+		[[nodiscard]] void* GetChunkColumn(size_t chunkIndex, uint32_t column) const
+		{
+			return mChunks[chunkIndex] + mColumnOffsets[column];
+		}
+
+		[[nodiscard]] void* GetComponent(uint32_t row, uint32_t column) const
+		{
+			return mChunks[row / mChunkCapacity] + mColumnOffsets[column] + static_cast<size_t>(row % mChunkCapacity) * mColumnSizes[column];
+		}
+
+		[[nodiscard]] Entity GetEntity(uint32_t row) const
+		{
+			return GetChunkEntities(row / mChunkCapacity)[row % mChunkCapacity];
+		}
+
+		// @brief Appends a row, its components are left uninitialized.
+		uint32_t AddRow(Entity entity);
+
+		// @brief Destroys the components of "row" and moves the last row into it.
+		// @return The entity moved into "row", invalid if "row" was the last one.
+		Entity RemoveRow(uint32_t row);
+
+		/**
+		 * @brief Moves "row" to a new row of "destination": shared components are relocated, components the
+		 * destination lacks are destroyed, components only the destination has stay uninitialized.
+		 * @return The entity moved into "row" of this archetype, invalid if "row" was the last one.
+		 */
+		Entity MoveRow(uint32_t row, Archetype& destination, uint32_t& outDestinationRow);
+
+		// @brief Cached neighbour with "type" added (or removed), nullptr until the World set it.
+		[[nodiscard]] Archetype* FindEdge(ComponentTypeId type, bool isAdd) const;
+		void SetEdge(ComponentTypeId type, bool isAdd, Archetype* archetype);
+
+	private:
+		// @brief Drops the last row without touching its components (already destroyed or relocated).
+		Entity PopRowInto(uint32_t row);
+
+	private:
+		ComponentMask mMask;
+		std::vector<ComponentTypeId> mTypes;								// Ascending, index == column
+		std::vector<const ComponentTypeInfo*> mInfos;
+		std::vector<uint32_t> mColumnSizes;
+		std::vector<uint32_t> mColumnOffsets;								// From the chunk start, the entities sit at 0
+		std::array<uint8_t, cMaxComponentTypes> mColumnByType;
+
+		FixedSizePool& mChunkPool;
+		std::vector<std::byte*> mChunks;
+		uint32_t mChunkCapacity{ 0 };
+		uint32_t mEntityCount{ 0 };
+
+		std::unordered_map<ComponentTypeId, Archetype*> mAddEdges;
+		std::unordered_map<ComponentTypeId, Archetype*> mRemoveEdges;
+	};
+}
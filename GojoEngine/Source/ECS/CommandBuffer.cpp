@@ -0,0 +1,260 @@
+#include "ECS/CommandBuffer.h"
+#include "ECS/World.h"
+#include "Core/Profiler/Profiler.h"
+#include "Managers/JobSystem/JobSystem.h"
+#include "Managers/LogManager/LogManager.h"
+
+#include <atomic>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		std::atomic<uint32_t> sNextEpoch{ 1 };
+
+		// @brief Epoch of a new recording, unique across every buffer until the counter wraps (never 0).
+		uint32_t AcquireEpoch()
+		{
+			uint32_t epoch = sNextEpoch.fetch_add(1, std::memory_order_relaxed);
+			while (epoch == 0)
+			{
+				epoch = sNextEpoch.fetch_add(1, std::memory_order_relaxed);
+			}
+			return epoch;
+		}
+	}
+
+	// ====================================================================================================
+	// Command Buffer
+	// ====================================================================================================
+
+	CommandBuffer::CommandBuffer(size_t payloadCapacity)
+		: mPayloads(payloadCapacity, GOJO_MEMORY_SITE(MemoryTag::ECS))
+		, mEpoch(AcquireEpoch())
+	{
+	}
+
+	CommandBuffer::~CommandBuffer()
+	{
+		Clear();
+	}
+
+	Entity CommandBuffer::CreateEntity()
+	{
+		// The index out of range of every world, the generation names the recording
+		const Entity placeholder{ cPlaceholderBit | ++mPendingEntityCount, mEpoch };
+		Record(CommandType::CreateEntity, placeholder, cInvalidComponentTypeId, nullptr);
+		return placeholder;
+	}
+
+	void CommandBuffer::DestroyEntity(Entity entity)
+	{
+		Record(CommandType::DestroyEntity, entity, cInvalidComponentTypeId, nullptr);
+	}
+
+	void CommandBuffer::Playback(World& world)
+	{
+		if (mCommands.empty())
+			return;
+
+		GOJO_PROFILE_SCOPE("CommandBuffer::Playback");
+
+		mCreatedEntities.assign(mPendingEntityCount, Entity{});
+		mResolvedEpoch = mEpoch;
+		for (size_t index = 0; index < mCommands.size(); ++index)
+		{
+			Command& command = mCommands[index];
+			switch (command.Type)
+			{
+			case CommandType::CreateEntity:
+				index = PlaybackCreate(world, index);
+				break;
+
+			case CommandType::DestroyEntity:
+				world.DestroyEntity(Resolve(command.Target));
+				break;
+
+			case CommandType::AddComponent:
+			{
+				const ComponentTypeInfo& info = ComponentTypeRegistry::GetInfo(command.Component);
+
+				bool hadComponent = false;
+				void* storage = world.AddComponent(Resolve(command.Target), command.Component, hadComponent);
+				if (storage)
+				{
+					if (hadComponent)
+					{
+						DestroyComponent(info, storage);
+					}
+					RelocateComponent(info, storage, command.Payload);
+					command.Payload = nullptr;
+				}
+				break;
+			}
+
+			case CommandType::RemoveComponent:
+				world.RemoveComponent(Resolve(command.Target), command.Component);
+				break;
+			}
+		}
+
+		// Payloads of skipped commands are destroyed here, the placeholders stay resolvable
+		Clear();
+	}
+
+	void CommandBuffer::Clear()
+	{
+		for (const Command& command : mCommands)
+		{
+			if (command.Payload)
+			{
+				DestroyComponent(ComponentTypeRegistry::GetInfo(command.Component), command.Payload);
+			}
+		}
+
+		mCommands.clear();
+		mPayloads.Reset();
+		mPendingEntityCount = 0;
+		mEpoch = AcquireEpoch();
+	}
+
+	Entity CommandBuffer::Resolve(Entity entity) const
+	{
+		if (!IsPlaceholder(entity))
+			return entity;
+
+		const uint32_t number = entity.Index & ~cPlaceholderBit;
+		if (entity.Generation != mResolvedEpoch || number == 0 || number > mCreatedEntities.size())
+			return Entity{};
+
+		return mCreatedEntities[number - 1];
+	}
+
+	void CommandBuffer::Record(CommandType type, Entity target, ComponentTypeId component, void* payload)
+	{
+		GOJO_ASSERT_MESSAGE(!IsPlaceholder(target) || target.Generation == mEpoch, "Placeholder of another command buffer or of a finished recording!");
+		mCommands.push_back(Command{ type, component, target, payload });
+	}
+
+	size_t CommandBuffer::PlaybackCreate(World& world, size_t index)
+	{
+		const Entity placeholder = mCommands[index].Target;
+
+		// The components added right after the creation, up to the first type added twice
+		ComponentMask mask;
+		mTypeScratch.clear();
+		size_t lastIndex = index;
+		while (lastIndex + 1 < mCommands.size())
+		{
+			const Command& next = mCommands[lastIndex + 1];
+			if (next.Type != CommandType::AddComponent || next.Target != placeholder || mask.test(next.Component))
+				break;
+
+			mask.set(next.Component);
+			mTypeScratch.push_back(next.Component);
+			++lastIndex;
+		}
+
+		const Entity entity = world.CreateEntityWithTypes(mTypeScratch);
+		for (size_t commandIndex = index + 1; commandIndex <= lastIndex; ++commandIndex)
+		{
+			Command& command = mCommands[commandIndex];
+			RelocateComponent(ComponentTypeRegistry::GetInfo(command.Component), world.GetComponent(entity, command.Component), command.Payload);
+			command.Payload = nullptr;
+		}
+
+		mCreatedEntities[(placeholder.Index & ~cPlaceholderBit) - 1] = entity;
+		return lastIndex;
+	}
+
+	// ====================================================================================================
+	// Thread Command Buffers
+	// ====================================================================================================
+
+	ThreadCommandBuffers::ThreadCommandBuffers(size_t payloadCapacity)
+		: mPayloadCapacity(payloadCapacity)
+	{
+		SyncThreadCount();
+	}
+
+	ThreadCommandBuffers::~ThreadCommandBuffers() = default;
+
+	CommandBuffer& ThreadCommandBuffers::GetLocal()
+	{
+		const uint32_t threadIndex = JobSystem::GetCurrentThreadIndex();
+		GOJO_RUNTIME_ASSERT(threadIndex < mBuffers.size(), "Job system grew since the last SyncThreadCount()!");
+
+		// Only the thread itself touches its slot
+		std::unique_ptr<CommandBuffer>& buffer = mBuffers[threadIndex];
+		if (!buffer)
+		{
+			buffer = std::make_unique<CommandBuffer>(mPayloadCapacity);
+		}
+		return *buffer;
+	}
+
+	void ThreadCommandBuffers::SyncThreadCount()
+	{
+		// Grows only, buffers of threads gone may still hold commands
+		const size_t threadCount = JobSystem::IsInitialized() ? JobSystem::GetInstance().GetWorkerCount() + 1 : 1;
+		if (threadCount > mBuffers.size())
+		{
+			mBuffers.resize(threadCount);
+		}
+	}
+
+	void ThreadCommandBuffers::Playback(World& world)
+	{
+		for (const std::unique_ptr<CommandBuffer>& buffer : mBuffers)
+		{
+			if (buffer)
+			{
+				buffer->Playback(world);
+			}
+		}
+	}
+
+	void ThreadCommandBuffers::Clear()
+	{
+		for (const std::unique_ptr<CommandBuffer>& buffer : mBuffers)
+		{
+			if (buffer)
+			{
+				buffer->Clear();
+			}
+		}
+	}
+
+	Entity ThreadCommandBuffers::Resolve(Entity entity) const
+	{
+		if (!CommandBuffer::IsPlaceholder(entity))
+			return entity;
+
+		// Epochs are unique, at most one buffer knows the placeholder
+		for (const std::unique_ptr<CommandBuffer>& buffer : mBuffers)
+		{
+			const Entity resolved = buffer ? buffer->Resolve(entity) : Entity{};
+			if (resolved.IsValid())
+				return resolved;
+		}
+		return Entity{};
+	}
+
+	bool ThreadCommandBuffers::IsEmpty() const
+	{
+		return GetCommandCount() == 0;
+	}
+
+	size_t ThreadCommandBuffers::GetCommandCount() const
+	{
+		size_t count = 0;
+		for (const std::unique_ptr<CommandBuffer>& buffer : mBuffers)
+		{
+			count += buffer ? buffer->GetCommandCount() : 0;
+		}
+		return count;
+	}
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+#include "Core/Memory/LinearArena.h"
+#include "ECS/Component.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace GojoEngine
+{
+	class World;
+
+	// ====================================================================================================
+	// Command Buffer
+	// ====================================================================================================
+
+	/**
+	 * @brief Structural changes recorded now and applied to a world later, in recording order.
+	 *
+	 * Queries and systems cannot change the layout of the world they iterate, they record here and the
+	 * owner plays the buffer back once iteration is over. Component values are constructed when recorded
+	 * (into an arena that is reset by Playback()) and moved into the world on playback. A new entity and
+	 * the components added to it right after are placed into their final archetype at once.
+	 *
+	 * CreateEntity() returns a placeholder that only this buffer understands: use it for the following
+	 * commands of the same buffer, the real entity exists once the buffer was played back and Resolve()
+	 * maps the placeholder to it until the next playback. Every recording gets a process-wide unique
+	 * epoch stamped into its placeholders, so a placeholder used after its recording was played back or
+	 * cleared (or in another buffer) never lands on an unrelated entity: it asserts when recorded and
+	 * resolves to no entity. Commands on entities that are dead by then are skipped.
+	 * Single owner thread, see ThreadCommandBuffers for parallel recording.
+	 */
+	class GOJO_API CommandBuffer final : public NonCopyable
+	{
+	public:
+		static constexpr size_t cDefaultPayloadCapacity = 16 * 1024;
+
+		// @brief Set in the index of placeholders, the world never gets anywhere near 2^31 entity slots.
+		static constexpr uint32_t cPlaceholderBit = 1u << 31;
+
+		explicit CommandBuffer(size_t payloadCapacity = cDefaultPayloadCapacity);
+		~CommandBuffer() override;
+
+		Entity CreateEntity();
+		void DestroyEntity(Entity entity);
+
+		template<ComponentType T, typename... ArgsT>
+		void AddComponent(Entity entity, ArgsT&&... args)
+		{
+			void* payload = mPayloads.Allocate(sizeof(T), alignof(T));
+			::new (payload) T(std::forward<ArgsT>(args)...);
+			Record(CommandType::AddComponent, entity, GetComponentTypeId<T>(), payload);
+		}
+
+		template<ComponentType T>
+		void RemoveComponent(Entity entity)
+		{
+			Record(CommandType::RemoveComponent, entity, GetComponentTypeId<T>(), nullptr);
+		}
+
+		// @brief Applies every command to "world" and clears the buffer.
+		void Playback(World& world);
+
+		// @brief Drops every command without applying it, the placeholders recorded so far go stale.
+		void Clear();
+
+		// @brief Real entity of a placeholder created by the last playback, Entity{} for any other
+		//        placeholder (not played back yet, stale, or from another buffer). Other handles are returned as they are.
+		[[nodiscard]] Entity Resolve(Entity entity) const;
+
+		[[nodiscard]] static bool IsPlaceholder(Entity entity) { return (entity.Index & cPlaceholderBit) != 0; }
+
+		[[nodiscard]] bool IsEmpty() const { return mCommands.empty(); }
+		[[nodiscard]] size_t GetCommandCount() const { return mCommands.size(); }
+
+	private:
+		enum class CommandType : uint8_t
+		{
+			CreateEntity,
+			DestroyEntity,
+			AddComponent,
+			RemoveComponent
+		};
+
+		struct Command
+		{
+			CommandType Type;
+			ComponentTypeId Component;
+			Entity Target;
+			void* Payload;											// Constructed component, nullptr once moved out
+		};
+
+		void Record(CommandType type, Entity target, ComponentTypeId component, void* payload);
+
+		// @brief Creates the entity of commands[index] with the components added right after it.
+		// @return Index of the last command consumed.
+		size_t PlaybackCreate(World& world, size_t index);
+
+	private:
+		std::vector<Command> mCommands;
+		LinearArena mPayloads;
+		uint32_t mPendingEntityCount{ 0 };
+		uint32_t mEpoch{ 0 };										// Generation of the placeholders being recorded
+
+		std::vector<Entity> mCreatedEntities;						// Placeholder number - 1 -> entity, of the last playback
+		uint32_t mResolvedEpoch{ 0 };								// Epoch "mCreatedEntities" belongs to
+		std::vector<ComponentTypeId> mTypeScratch;
+	};
+
+	// ====================================================================================================
+	// Thread Command Buffers
+	// ====================================================================================================
+
+	/**
+	 * @brief One CommandBuffer per job system thread, so code spread over the workers records without locks.
+	 *
+	 * GetLocal() hands out the buffer of JobSystem::GetCurrentThreadIndex(), created on first use.
+	 * Playback() applies the buffers in thread index order. Which thread records a command depends on
+	 * scheduling; the order among the commands of one thread does not. A placeholder belongs to the
+	 * buffer of the thread that created it, Resolve() finds it in any of them after playback.
+	 */
+	class GOJO_API ThreadCommandBuffers final : public NonCopyable
+	{
+	public:
+		explicit ThreadCommandBuffers(size_t payloadCapacity = CommandBuffer::cDefaultPayloadCapacity);
+		~ThreadCommandBuffers() override;
+
+		// @brief Buffer of the calling thread. Thread-safe as long as SyncThreadCount() does not run.
+		[[nodiscard]] CommandBuffer& GetLocal();
+
+		// @brief Makes room for every thread of the running job system (workers + 1), while nothing records.
+		void SyncThreadCount();
+
+		// @brief Plays every buffer back into "world" in thread index order.
+		void Playback(World& world);
+		void Clear();
+
+		[[nodiscard]] Entity Resolve(Entity entity) const;
+
+		[[nodiscard]] bool IsEmpty() const;
+		[[nodiscard]] size_t GetCommandCount() const;
+		[[nodiscard]] size_t GetThreadCount() const { return mBuffers.size(); }
+
+	private:
+		std::vector<std::unique_ptr<CommandBuffer>> mBuffers;		// Index == JobSystem thread index, nullptr until used
+		size_t mPayloadCapacity;
+	};
+}
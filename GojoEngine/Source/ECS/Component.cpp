@@ -0,0 +1,101 @@
+#include "ECS/Component.h"
+#include "Managers/LogManager/LogManager.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		struct ComponentTypeRegistryData
+		{
+			std::mutex Mutex;
+			std::deque<std::string> Names;									// Registered names must outlive the module that passed them
+			std::unordered_map<std::string_view, ComponentTypeId> Ids;		// Keys point into "Names"
+			std::array<ComponentTypeInfo, cMaxComponentTypes> Infos{};		// Index == ComponentTypeId
+			std::atomic<ComponentTypeId> Count{ 1 };
+		};
+
+		ComponentTypeRegistryData& GetRegistryData()
+		{
+			static ComponentTypeRegistryData data;
+			return data;
+		}
+
+		// @brief Ids are baked into archetypes and statics all over the process, there is no way to carry on.
+		[[noreturn]] void FailRegistration(std::string_view name, const char* reason)
+		{
+			GOJO_LOG_FATAL("ECS", "Cannot register component type '{}': {}", name, reason);
+			if (const LogManager* logManager = LogManager::GetPtr())
+			{
+				logManager->Flush();
+			}
+			GOJO_ASSERT_MESSAGE(false, reason);
+			std::abort();
+		}
+
+		// @brief Function pointers differ between modules, the layout of one type does not.
+		bool HasSameLayout(const ComponentTypeInfo& left, const ComponentTypeInfo& right)
+		{
+			return left.Size == right.Size && left.Alignment == right.Alignment
+				&& (left.MoveConstruct == nullptr) == (right.MoveConstruct == nullptr)
+				&& (left.Destroy == nullptr) == (right.Destroy == nullptr);
+		}
+	}
+
+	// ====================================================================================================
+	// ComponentTypeRegistry
+	// ====================================================================================================
+
+	ComponentTypeId ComponentTypeRegistry::Register(const ComponentTypeInfo& info)
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		if (auto it = data.Ids.find(info.Name); it != data.Ids.end())
+		{
+			// Two different types spelled the same, e.g. in anonymous namespaces of different files
+			if (!HasSameLayout(data.Infos[it->second], info))
+			{
+				FailRegistration(info.Name, "Name collision with a different type, give the component a unique name!");
+			}
+			return it->second;
+		}
+
+		const ComponentTypeId id = data.Count.load(std::memory_order_relaxed);
+		if (id >= cMaxComponentTypes)
+		{
+			FailRegistration(info.Name, "Too many component types, raise cMaxComponentTypes!");
+		}
+
+		const std::string& storedName = data.Names.emplace_back(info.Name);
+		data.Infos[id] = info;
+		data.Infos[id].Name = storedName;
+		data.Ids.emplace(storedName, id);
+
+		// Published after the info is complete, GetInfo() needs no lock
+		data.Count.store(id + 1, std::memory_order_release);
+		return id;
+	}
+
+	const ComponentTypeInfo& ComponentTypeRegistry::GetInfo(ComponentTypeId id)
+	{
+		auto& data = GetRegistryData();
+		GOJO_RUNTIME_ASSERT(id < data.Count.load(std::memory_order_acquire), "Unknown component type id!");
+		return data.Infos[id];
+	}
+
+	ComponentTypeId ComponentTypeRegistry::GetCount()
+	{
+		return GetRegistryData().Count.load(std::memory_order_acquire);
+	}
+}
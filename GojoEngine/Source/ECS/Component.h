@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+#include "Core/Containers/SlotMap.h"
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Entity
+	// ====================================================================================================
+
+	struct EntityTag;
+
+	// @brief Index and generation of an entity, stale once the entity is destroyed.
+	using Entity = SlotHandle<EntityTag>;
+
+	// ====================================================================================================
+	// Component Type IDs
+	// ====================================================================================================
+
+	// @brief Dense, process-wide id of a component type (0 is never assigned).
+	using ComponentTypeId = uint32_t;
+	constexpr ComponentTypeId cInvalidComponentTypeId = 0;
+	constexpr size_t cMaxComponentTypes = 256;
+
+	// @brief Set of component types, indexed by ComponentTypeId.
+	using ComponentMask = std::bitset<cMaxComponentTypes>;
+
+	// @brief What archetype chunks need to know about a component type.
+	struct ComponentTypeInfo
+	{
+		std::string_view Name;
+		uint32_t Size{ 0 };
+		uint32_t Alignment{ 0 };
+		void (*MoveConstruct)(void* destination, void* source){ nullptr };	// nullptr: trivially copyable, moved with memcpy
+		void (*Destroy)(void* component){ nullptr };						// nullptr: trivially destructible
+	};
+
+	// @brief Process-wide registry that hands out dense component type ids by type name.
+	//        Lives in GojoEngine so the engine and client modules agree on every id.
+	class GOJO_API ComponentTypeRegistry final
+	{
+	public:
+		// @brief Returns the id of "info.Name", registering it on first use. Thread-safe.
+		//        Aborts, also in release, when the name is taken by a type of another layout or no id is left.
+		static ComponentTypeId Register(const ComponentTypeInfo& info);
+
+		// @brief Info of a registered id. Lock-free: ids are only known once their info is complete.
+		static const ComponentTypeInfo& GetInfo(ComponentTypeId id);
+
+		// @brief Upper bound (exclusive) of all ids registered so far.
+		static ComponentTypeId GetCount();
+	};
+
+	// ====================================================================================================
+	// Component Type ID Lookup
+	// ====================================================================================================
+
+	// @brief Components are plain values: moved (never copied) between chunks, so moving must not throw.
+	template<typename T>
+	concept ComponentType = std::is_object_v<T> && !std::is_const_v<T>
+						 && std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>;
+
+	template<ComponentType T>
+	ComponentTypeInfo MakeComponentTypeInfo()
+	{
+		GOJO_STATIC_ASSERT(alignof(T) <= alignof(std::max_align_t), "Component is over-aligned for archetype chunks!");
+
+		ComponentTypeInfo info;
+		info.Name = GetTypeName<T>();
+		info.Size = static_cast<uint32_t>(sizeof(T));
+		info.Alignment = static_cast<uint32_t>(alignof(T));
+
+		if constexpr (!std::is_trivially_copyable_v<T>)
+		{
+			info.MoveConstruct = [](void* destination, void* source)
+				{
+					::new (destination) T(std::move(*static_cast<T*>(source)));
+				};
+		}
+
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			info.Destroy = [](void* component)
+				{
+					static_cast<T*>(component)->~T();
+				};
+		}
+		return info;
+	}
+
+	// @brief Dense id of T (const ignored). Resolved once per type and module, then a plain static read.
+	template<typename T>
+		requires ComponentType<std::remove_const_t<T>>
+	inline ComponentTypeId GetComponentTypeId()
+	{
+		static const ComponentTypeId sTypeId = ComponentTypeRegistry::Register(MakeComponentTypeInfo<std::remove_const_t<T>>());
+		return sTypeId;
+	}
+
+	template<typename... ComponentsT>
+	ComponentMask MakeComponentMask()
+	{
+		ComponentMask mask;
+		(mask.set(GetComponentTypeId<ComponentsT>()), ...);
+		return mask;
+	}
+
+	// ====================================================================================================
+	// Type-Erased Component Operations
+	// ====================================================================================================
+
+	// @brief Moves "source" into uninitialized "destination" and destroys "source".
+	inline void RelocateComponent(const ComponentTypeInfo& info, void* destination, void* source)
+	{
+		if (info.MoveConstruct)
+		{
+			info.MoveConstruct(destination, source);
+			if (info.Destroy)
+			{
+				info.Destroy(source);
+			}
+		}
+		else
+		{
+			std::memcpy(destination, source, info.Size);
+		}
+	}
+
+	inline void DestroyComponent(const ComponentTypeInfo& info, void* component)
+	{
+		if (info.Destroy)
+		{
+			info.Destroy(component);
+		}
+	}
+}
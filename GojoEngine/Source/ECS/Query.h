@@ -0,0 +1,231 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "ECS/Archetype.h"
+#include "ECS/Component.h"
+#include "ECS/World.h"
+#include "Managers/JobSystem/JobSystem.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Query
+	// ====================================================================================================
+
+	/**
+	 * @brief Iterates every entity of a world that has all of ComponentsT.
+	 *
+	 * The matching archetypes and the column of each component in them are cached; the cache catches up
+	 * with archetypes created since the last run, so keep the query around instead of building one per
+	 * frame. Iteration walks the chunks of each archetype and hands out plain arrays.
+	 *
+	 * "const" components are read-only: Query<Transform, const Velocity> writes transforms and only
+	 * reads velocities, which is what GetWriteMask() and GetReadMask() report to the SystemScheduler.
+	 * The world refuses structural changes while the query runs, use a CommandBuffer.
+	 */
+	template<typename... ComponentsT>
+	class Query final
+	{
+	public:
+		explicit Query(World& world)
+			: mWorld(world)
+			, mMask(MakeComponentMask<ComponentsT...>())
+			, mTypes{ GetComponentTypeId<ComponentsT>()... }
+		{
+			GOJO_RUNTIME_ASSERT(mMask.count() == sizeof...(ComponentsT), "Component types of a query must be distinct!");
+		}
+
+		// @brief Calls function(ComponentsT&...) or function(Entity, ComponentsT&...) for every matching entity.
+		template<typename FunctionT>
+		void ForEach(FunctionT&& function)
+		{
+			StructureLock lock(mWorld);
+			Refresh();
+
+			for (const Match& match : mMatches)
+			{
+				for (size_t chunkIndex = 0; chunkIndex < match.Owner->GetChunkCount(); ++chunkIndex)
+				{
+					RunChunk(match, chunkIndex, function);
+				}
+			}
+		}
+
+		// @brief Calls function(std::span<const Entity>, std::span<ComponentsT>...) once per chunk.
+		//        Loops over the spans compile to plain array loops, the fastest way through many entities.
+		template<typename FunctionT>
+		void ForEachChunk(FunctionT&& function)
+		{
+			StructureLock lock(mWorld);
+			Refresh();
+
+			for (const Match& match : mMatches)
+			{
+				for (size_t chunkIndex = 0; chunkIndex < match.Owner->GetChunkCount(); ++chunkIndex)
+				{
+					RunChunkSpans(match, chunkIndex, function, std::index_sequence_for<ComponentsT...>{});
+				}
+			}
+		}
+
+		/**
+		 * @brief ForEach() with the chunks spread over the job system; sequential if it is not running.
+		 * "function" runs concurrently for different chunks and must not touch other entities' components.
+		 */
+		template<typename FunctionT>
+		void ParallelForEach(FunctionT&& function)
+		{
+			StructureLock lock(mWorld);
+			Refresh();
+
+			mChunkJobs.clear();
+			for (uint32_t matchIndex = 0; matchIndex < mMatches.size(); ++matchIndex)
+			{
+				for (size_t chunkIndex = 0; chunkIndex < mMatches[matchIndex].Owner->GetChunkCount(); ++chunkIndex)
+				{
+					mChunkJobs.push_back({ matchIndex, static_cast<uint32_t>(chunkIndex) });
+				}
+			}
+
+			if (!JobSystem::IsInitialized())
+			{
+				for (const ChunkJob& job : mChunkJobs)
+				{
+					RunChunk(mMatches[job.MatchIndex], job.ChunkIndex, function);
+				}
+				return;
+			}
+
+			JobSystem::GetInstance().ParallelFor(static_cast<uint32_t>(mChunkJobs.size()), [this, &function](uint32_t index)
+				{
+					const ChunkJob& job = mChunkJobs[index];
+					RunChunk(mMatches[job.MatchIndex], job.ChunkIndex, function);
+				});
+		}
+
+		[[nodiscard]] size_t GetEntityCount()
+		{
+			Refresh();
+
+			size_t count = 0;
+			for (const Match& match : mMatches)
+			{
+				count += match.Owner->GetEntityCount();
+			}
+			return count;
+		}
+
+		// @brief Components written (non-const) and only read (const) by this query.
+		[[nodiscard]] static ComponentMask GetWriteMask()
+		{
+			ComponentMask mask;
+			((std::is_const_v<ComponentsT> ? void() : void(mask.set(GetComponentTypeId<ComponentsT>()))), ...);
+			return mask;
+		}
+
+		[[nodiscard]] static ComponentMask GetReadMask()
+		{
+			ComponentMask mask;
+			((std::is_const_v<ComponentsT> ? void(mask.set(GetComponentTypeId<ComponentsT>())) : void()), ...);
+			return mask;
+		}
+
+	private:
+		struct Match
+		{
+			Archetype* Owner;
+			std::array<uint32_t, sizeof...(ComponentsT)> Columns;
+		};
+
+		struct ChunkJob
+		{
+			uint32_t MatchIndex;
+			uint32_t ChunkIndex;
+		};
+
+		// @brief Structural changes are refused while it lives (nests, may be held by several threads).
+		class StructureLock final
+		{
+		public:
+			explicit StructureLock(const World& world) : mWorld(world) { mWorld.LockStructure(); }
+			~StructureLock() { mWorld.UnlockStructure(); }
+
+			StructureLock(const StructureLock&) = delete;
+			StructureLock& operator=(const StructureLock&) = delete;
+
+		private:
+			const World& mWorld;
+		};
+
+		// @brief Matches the archetypes created since the last call, archetypes are never destroyed.
+		void Refresh()
+		{
+			const std::span<Archetype* const> archetypes = mWorld.GetArchetypes();
+			for (; mSeenArchetypeCount < archetypes.size(); ++mSeenArchetypeCount)
+			{
+				Archetype* archetype = archetypes[mSeenArchetypeCount];
+				if ((archetype->GetMask() & mMask) != mMask)
+					continue;
+
+				Match& match = mMatches.emplace_back();
+				match.Owner = archetype;
+				for (size_t index = 0; index < mTypes.size(); ++index)
+				{
+					match.Columns[index] = archetype->GetColumn(mTypes[index]);
+				}
+			}
+		}
+
+		template<typename FunctionT>
+		void RunChunk(const Match& match, size_t chunkIndex, FunctionT& function) const
+		{
+			RunChunkEntities(match, chunkIndex, function, std::index_sequence_for<ComponentsT...>{});
+		}
+
+		template<typename FunctionT, size_t... IndicesT>
+		void RunChunkEntities(const Match& match, size_t chunkIndex, FunctionT& function, std::index_sequence<IndicesT...>) const
+		{
+			const uint32_t count = match.Owner->GetChunkEntityCount(chunkIndex);
+			const Entity* entities = match.Owner->GetChunkEntities(chunkIndex);
+			const std::tuple<ComponentsT*...> columns{ static_cast<ComponentsT*>(match.Owner->GetChunkColumn(chunkIndex, match.Columns[IndicesT]))... };
+
+			for (uint32_t index = 0; index < count; ++index)
+			{
+				if constexpr (std::is_invocable_v<FunctionT&, Entity, ComponentsT&...>)
+				{
+					function(entities[index], std::get<IndicesT>(columns)[index]...);
+				}
+				else
+				{
+					function(std::get<IndicesT>(columns)[index]...);
+				}
+			}
+		}
+
+		template<typename FunctionT, size_t... IndicesT>
+		void RunChunkSpans(const Match& match, size_t chunkIndex, FunctionT& function, std::index_sequence<IndicesT...>) const
+		{
+			const uint32_t count = match.Owner->GetChunkEntityCount(chunkIndex);
+			function(std::span<const Entity>(match.Owner->GetChunkEntities(chunkIndex), count),
+				std::span<ComponentsT>(static_cast<ComponentsT*>(match.Owner->GetChunkColumn(chunkIndex, match.Columns[IndicesT])), count)...);
+		}
+
+	private:
+		World& mWorld;
+		ComponentMask mMask;
+		std::array<ComponentTypeId, sizeof...(ComponentsT)> mTypes;
+
+		std::vector<Match> mMatches;
+		size_t mSeenArchetypeCount{ 0 };
+		std::vector<ChunkJob> mChunkJobs;
+	};
+}
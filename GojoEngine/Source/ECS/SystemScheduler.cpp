@@ -0,0 +1,173 @@
+#include "ECS/SystemScheduler.h"
+#include "ECS/CommandBuffer.h"
+#include "ECS/World.h"
+#include "Core/Profiler/Profiler.h"
+#include "Managers/JobSystem/JobSystem.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// SystemScheduler Implementation (PIMPL)
+	// ====================================================================================================
+
+	class SystemScheduler::Impl
+	{
+	public:
+		struct System
+		{
+			SystemId Id{ cInvalidSystemId };
+			const char* Name{ nullptr };
+			SystemAccess Access;
+			SystemFunction Function;
+			std::unique_ptr<ThreadCommandBuffers> Commands;
+		};
+
+		SystemId AddSystem(const char* name, const SystemAccess& access, SystemFunction function)
+		{
+			System& system = mSystems.emplace_back();
+			system.Id = mNextId++;
+			system.Name = name;
+			system.Access = access;
+			system.Function = std::move(function);
+			system.Commands = std::make_unique<ThreadCommandBuffers>();
+
+			mIsDirty = true;
+			return system.Id;
+		}
+
+		bool RemoveSystem(SystemId id)
+		{
+			const size_t removedCount = std::erase_if(mSystems, [id](const System& system) { return system.Id == id; });
+			mIsDirty |= removedCount > 0;
+			return removedCount > 0;
+		}
+
+		// @brief Batches in execution order, each a list of indices into the systems.
+		const std::vector<std::vector<uint32_t>>& GetBatches()
+		{
+			if (mIsDirty)
+			{
+				BuildBatches();
+				mIsDirty = false;
+			}
+			return mBatches;
+		}
+
+		std::vector<System>& GetSystems() { return mSystems; }
+
+	private:
+		void BuildBatches()
+		{
+			// Quadratic in the system count, rebuilt only when systems change
+			std::vector<uint32_t> batchOf(mSystems.size(), 0);
+			mBatches.clear();
+			for (uint32_t index = 0; index < mSystems.size(); ++index)
+			{
+				for (uint32_t earlier = 0; earlier < index; ++earlier)
+				{
+					if (mSystems[index].Access.ConflictsWith(mSystems[earlier].Access))
+					{
+						batchOf[index] = std::max(batchOf[index], batchOf[earlier] + 1);
+					}
+				}
+
+				if (batchOf[index] >= mBatches.size())
+				{
+					mBatches.resize(batchOf[index] + 1);
+				}
+				mBatches[batchOf[index]].push_back(index);
+			}
+		}
+
+	private:
+		std::vector<System> mSystems;
+		std::vector<std::vector<uint32_t>> mBatches;
+		SystemId mNextId{ 1 };
+		bool mIsDirty{ false };
+	};
+
+	// ====================================================================================================
+	// SystemScheduler Public API
+	// ====================================================================================================
+
+	SystemScheduler::SystemScheduler()
+		: pImpl(std::make_unique<Impl>())
+	{
+	}
+
+	SystemScheduler::~SystemScheduler() = default;
+
+	SystemId SystemScheduler::AddSystem(const char* name, const SystemAccess& access, SystemFunction function)
+	{
+		return pImpl->AddSystem(name, access, std::move(function));
+	}
+
+	bool SystemScheduler::RemoveSystem(SystemId id)
+	{
+		return pImpl->RemoveSystem(id);
+	}
+
+	void SystemScheduler::Run(World& world)
+	{
+		GOJO_PROFILE_SCOPE("SystemScheduler::Run");
+
+		auto& systems = pImpl->GetSystems();
+		for (Impl::System& system : systems)
+		{
+			system.Commands->SyncThreadCount();
+		}
+
+		auto runSystem = [&world, &systems](uint32_t index)
+			{
+				Impl::System& system = systems[index];
+				GOJO_PROFILE_SCOPE(system.Name);
+				system.Function(world, *system.Commands);
+			};
+
+		for (const std::vector<uint32_t>& batch : pImpl->GetBatches())
+		{
+			// An exclusive system is alone in its batch and the only one allowed to change the world directly
+			const bool isExclusive = batch.size() == 1 && systems[batch.front()].Access.IsExclusive;
+			if (isExclusive)
+			{
+				runSystem(batch.front());
+				continue;
+			}
+
+			world.LockStructure();
+			if (batch.size() > 1 && JobSystem::IsInitialized())
+			{
+				JobSystem::GetInstance().ParallelFor(static_cast<uint32_t>(batch.size()), [&batch, &runSystem](uint32_t index)
+					{
+						runSystem(batch[index]);
+					});
+			}
+			else
+			{
+				for (uint32_t index : batch)
+				{
+					runSystem(index);
+				}
+			}
+			world.UnlockStructure();
+		}
+
+		for (Impl::System& system : systems)
+		{
+			system.Commands->Playback(world);
+		}
+	}
+
+	size_t SystemScheduler::GetSystemCount() const
+	{
+		return pImpl->GetSystems().size();
+	}
+
+	size_t SystemScheduler::GetBatchCount() const
+	{
+		return pImpl->GetBatches().size();
+	}
+}
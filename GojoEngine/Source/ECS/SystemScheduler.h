@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+#include "Core/Delegate.h"
+#include "ECS/Component.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace GojoEngine
+{
+	class World;
+	class ThreadCommandBuffers;
+
+	// ====================================================================================================
+	// System Types
+	// ====================================================================================================
+
+	// @brief Components a system reads and writes. Exclusive systems conflict with every other system.
+	struct SystemAccess
+	{
+		ComponentMask Reads;
+		ComponentMask Writes;
+		bool IsExclusive{ false };
+
+		// @brief Non-const types are written, const types only read: Of<Transform, const Velocity>().
+		template<typename... ComponentsT>
+		[[nodiscard]] static SystemAccess Of()
+		{
+			SystemAccess access;
+			((std::is_const_v<ComponentsT> ? void(access.Reads.set(GetComponentTypeId<ComponentsT>()))
+										   : void(access.Writes.set(GetComponentTypeId<ComponentsT>()))), ...);
+			return access;
+		}
+
+		[[nodiscard]] static SystemAccess Exclusive()
+		{
+			SystemAccess access;
+			access.IsExclusive = true;
+			return access;
+		}
+
+		// @brief Two systems may run at the same time unless one writes what the other touches.
+		[[nodiscard]] bool ConflictsWith(const SystemAccess& other) const
+		{
+			return IsExclusive || other.IsExclusive
+				|| (Writes & (other.Reads | other.Writes)).any()
+				|| (other.Writes & Reads).any();
+		}
+	};
+
+	// @brief Structural changes go to commands.GetLocal(), exclusive systems may also change the world directly.
+	using SystemFunction = Delegate<void(World&, ThreadCommandBuffers&)>;
+
+	using SystemId = uint32_t;
+	constexpr SystemId cInvalidSystemId = 0;
+
+	// ====================================================================================================
+	// System Scheduler
+	// ====================================================================================================
+
+	/**
+	 * @brief Runs systems over a world, in parallel wherever their declared access allows it.
+	 *
+	 * Systems are split into batches: a system goes into the batch after the last earlier system it
+	 * conflicts with, so conflicting systems always run in registration order and everything else runs
+	 * alongside. Batches run one after the other, the systems of a batch across the job system
+	 * (sequentially if it is not running). Each system records into its own ThreadCommandBuffers, also
+	 * from the jobs it spreads over the workers; once every system ran they are played back system by
+	 * system in registration order, the buffers of a system in thread index order. The next run hands
+	 * a system the same buffers, where Resolve() maps its placeholders to the entities created.
+	 *
+	 * System names show up as profiler zones and must be string literals. Not thread-safe, owner only.
+	 */
+	class GOJO_API SystemScheduler final : public NonCopyable
+	{
+	public:
+		SystemScheduler();
+		~SystemScheduler() override;
+
+		SystemId AddSystem(const char* name, const SystemAccess& access, SystemFunction function);
+		bool RemoveSystem(SystemId id);
+
+		// @brief Runs every system once, then applies their command buffers.
+		void Run(World& world);
+
+		[[nodiscard]] size_t GetSystemCount() const;
+
+		// @brief Number of batches Run() executes one after the other (1 if nothing conflicts).
+		[[nodiscard]] size_t GetBatchCount() const;
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+	};
+}
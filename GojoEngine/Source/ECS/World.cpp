@@ -0,0 +1,269 @@
+#include "ECS/World.h"
+#include "ECS/Archetype.h"
+#include "Core/Containers/SlotMap.h"
+#include "Core/Memory/FixedSizePool.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Managers/LogManager/LogManager.h"
+
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		constexpr size_t cChunksPerPoolBlock = 16;						// Archetype chunks are taken from the heap 256 KiB at a time
+
+		struct EntityLocation
+		{
+			Archetype* Owner{ nullptr };
+			uint32_t Row{ 0 };
+		};
+	}
+
+	// ====================================================================================================
+	// World Implementation (PIMPL)
+	// ====================================================================================================
+
+	class World::Impl
+	{
+	public:
+		Impl()
+			: mChunkPool(Archetype::cChunkSize, cChunksPerPoolBlock, GOJO_MEMORY_SITE(MemoryTag::ECS))
+		{
+			mEmptyArchetype = &FindOrCreateArchetype(ComponentMask{});
+		}
+
+		~Impl()
+		{
+			// Components go before the pool their chunks came from
+			mArchetypesByMask.clear();
+			mArchetypePointers.clear();
+			mArchetypes.clear();
+		}
+
+		Entity CreateEntity(Archetype& archetype)
+		{
+			AssertStructureUnlocked();
+
+			const Entity entity = mEntities.Emplace();
+			mEntities.Get(entity)->Owner = &archetype;
+			mEntities.Get(entity)->Row = archetype.AddRow(entity);
+			return entity;
+		}
+
+		Entity CreateEntityWithTypes(std::span<const ComponentTypeId> types)
+		{
+			ComponentMask mask;
+			for (ComponentTypeId type : types)
+			{
+				mask.set(type);
+			}
+			GOJO_RUNTIME_ASSERT(mask.count() == types.size(), "Component types of a new entity must be distinct!");
+
+			return CreateEntity(FindOrCreateArchetype(mask));
+		}
+
+		bool DestroyEntity(Entity entity)
+		{
+			AssertStructureUnlocked();
+
+			const EntityLocation* location = mEntities.Get(entity);
+			if (!location)
+				return false;
+
+			const Entity movedEntity = location->Owner->RemoveRow(location->Row);
+			if (movedEntity.IsValid())
+			{
+				mEntities.Get(movedEntity)->Row = location->Row;
+			}
+			mEntities.Remove(entity);
+			return true;
+		}
+
+		void* AddComponent(Entity entity, ComponentTypeId type, bool& outHadComponent)
+		{
+			EntityLocation* location = mEntities.Get(entity);
+			if (!location)
+				return nullptr;
+
+			const uint32_t column = location->Owner->GetColumn(type);
+			outHadComponent = column != Archetype::cNoColumn;
+			if (outHadComponent)
+				return location->Owner->GetComponent(location->Row, column);
+
+			AssertStructureUnlocked();
+
+			Archetype& destination = GetNeighbour(*location->Owner, type, true);
+			MoveEntity(*location, destination);
+			return destination.GetComponent(location->Row, destination.GetColumn(type));
+		}
+
+		bool RemoveComponent(Entity entity, ComponentTypeId type)
+		{
+			EntityLocation* location = mEntities.Get(entity);
+			if (!location || location->Owner->GetColumn(type) == Archetype::cNoColumn)
+				return false;
+
+			AssertStructureUnlocked();
+
+			MoveEntity(*location, GetNeighbour(*location->Owner, type, false));
+			return true;
+		}
+
+		void* GetComponent(Entity entity, ComponentTypeId type) const
+		{
+			const EntityLocation* location = mEntities.Get(entity);
+			if (!location)
+				return nullptr;
+
+			const uint32_t column = location->Owner->GetColumn(type);
+			return column != Archetype::cNoColumn ? location->Owner->GetComponent(location->Row, column) : nullptr;
+		}
+
+		void Reserve(size_t entityCount) { mEntities.Reserve(entityCount); }
+		bool IsAlive(Entity entity) const { return mEntities.Contains(entity); }
+		size_t GetEntityCount() const { return mEntities.GetSize(); }
+		std::span<Archetype* const> GetArchetypes() const { return mArchetypePointers; }
+		Archetype& GetEmptyArchetype() { return *mEmptyArchetype; }
+
+		void LockStructure() { mStructureLockCount.fetch_add(1, std::memory_order_relaxed); }
+		void UnlockStructure() { mStructureLockCount.fetch_sub(1, std::memory_order_relaxed); }
+		bool IsStructureLocked() const { return mStructureLockCount.load(std::memory_order_relaxed) != 0; }
+
+	private:
+		void AssertStructureUnlocked() const
+		{
+			GOJO_ASSERT_MESSAGE(!IsStructureLocked(), "Structural change while the world is iterated, use a CommandBuffer!");
+		}
+
+		Archetype& FindOrCreateArchetype(const ComponentMask& mask)
+		{
+			if (auto it = mArchetypesByMask.find(mask); it != mArchetypesByMask.end())
+				return *it->second;
+
+			auto& archetype = mArchetypes.emplace_back(std::make_unique<Archetype>(mask, mChunkPool));
+			mArchetypePointers.push_back(archetype.get());
+			mArchetypesByMask.emplace(mask, archetype.get());
+			return *archetype;
+		}
+
+		// @brief Archetype with "type" added to (or removed from) "source", through the cached edge when possible.
+		Archetype& GetNeighbour(Archetype& source, ComponentTypeId type, bool isAdd)
+		{
+			if (Archetype* cached = source.FindEdge(type, isAdd))
+				return *cached;
+
+			ComponentMask mask = source.GetMask();
+			mask.set(type, isAdd);
+
+			Archetype& neighbour = FindOrCreateArchetype(mask);
+			source.SetEdge(type, isAdd, &neighbour);
+			neighbour.SetEdge(type, !isAdd, &source);
+			return neighbour;
+		}
+
+		void MoveEntity(EntityLocation& location, Archetype& destination)
+		{
+			uint32_t destinationRow = 0;
+			const Entity movedEntity = location.Owner->MoveRow(location.Row, destination, destinationRow);
+			if (movedEntity.IsValid())
+			{
+				mEntities.Get(movedEntity)->Row = location.Row;
+			}
+
+			location.Owner = &destination;
+			location.Row = destinationRow;
+		}
+
+	private:
+		FixedSizePool mChunkPool;
+		std::vector<std::unique_ptr<Archetype>> mArchetypes;
+		std::vector<Archetype*> mArchetypePointers;
+		std::unordered_map<ComponentMask, Archetype*> mArchetypesByMask;
+		Archetype* mEmptyArchetype{ nullptr };
+
+		SlotMap<EntityLocation, EntityTag> mEntities;
+		std::atomic<uint32_t> mStructureLockCount{ 0 };
+	};
+
+	// ====================================================================================================
+	// World Public API
+	// ====================================================================================================
+
+	World::World()
+		: pImpl(std::make_unique<Impl>())
+	{
+	}
+
+	World::~World() = default;
+
+	Entity World::CreateEntity()
+	{
+		return pImpl->CreateEntity(pImpl->GetEmptyArchetype());
+	}
+
+	bool World::DestroyEntity(Entity entity)
+	{
+		return pImpl->DestroyEntity(entity);
+	}
+
+	bool World::IsAlive(Entity entity) const
+	{
+		return pImpl->IsAlive(entity);
+	}
+
+	void World::Reserve(size_t entityCount)
+	{
+		pImpl->Reserve(entityCount);
+	}
+
+	size_t World::GetEntityCount() const
+	{
+		return pImpl->GetEntityCount();
+	}
+
+	std::span<Archetype* const> World::GetArchetypes() const
+	{
+		return pImpl->GetArchetypes();
+	}
+
+	bool World::IsStructureLocked() const
+	{
+		return pImpl->IsStructureLocked();
+	}
+
+	Entity World::CreateEntityWithTypes(std::span<const ComponentTypeId> types)
+	{
+		return pImpl->CreateEntityWithTypes(types);
+	}
+
+	void* World::AddComponent(Entity entity, ComponentTypeId type, bool& outHadComponent)
+	{
+		return pImpl->AddComponent(entity, type, outHadComponent);
+	}
+
+	bool World::RemoveComponent(Entity entity, ComponentTypeId type)
+	{
+		return pImpl->RemoveComponent(entity, type);
+	}
+
+	void* World::GetComponent(Entity entity, ComponentTypeId type) const
+	{
+		return pImpl->GetComponent(entity, type);
+	}
+
+	void World::LockStructure() const
+	{
+		pImpl->LockStructure();
+	}
+
+	void World::UnlockStructure() const
+	{
+		pImpl->UnlockStructure();
+	}
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+#include "ECS/Component.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace GojoEngine
+{
+	class Archetype;
+	class SystemScheduler;
+
+	template<typename... ComponentsT>
+	class Query;
+
+	// ====================================================================================================
+	// World
+	// ====================================================================================================
+
+	/**
+	 * @brief Entities and their components, grouped into archetypes (see Archetype).
+	 *
+	 * An entity handle resolves through a slot map to its archetype and row, so any lookup is two array
+	 * reads. Adding or removing a component moves the entity to the neighbouring archetype along a cached
+	 * graph edge. Structural changes (creating and destroying entities, adding and removing components)
+	 * are not allowed while a Query iterates or systems run, record them in a CommandBuffer instead.
+	 * Reading and writing components of existing entities is fine from any thread that owns them.
+	 */
+	class GOJO_API World final : public NonCopyable
+	{
+		template<typename... ComponentsT>
+		friend class Query;
+		friend class SystemScheduler;
+
+	public:
+		World();
+		~World() override;
+
+		Entity CreateEntity();
+
+		template<typename... ComponentsT>
+			requires (sizeof...(ComponentsT) > 0 && (ComponentType<std::decay_t<ComponentsT>> && ...))
+		Entity CreateEntity(ComponentsT&&... components)
+		{
+			const std::array<ComponentTypeId, sizeof...(ComponentsT)> types{ GetComponentTypeId<std::decay_t<ComponentsT>>()... };
+			const Entity entity = CreateEntityWithTypes(types);
+			(::new (GetComponent(entity, GetComponentTypeId<std::decay_t<ComponentsT>>())) std::decay_t<ComponentsT>(std::forward<ComponentsT>(components)), ...);
+			return entity;
+		}
+
+		// @return False if the entity was already destroyed.
+		bool DestroyEntity(Entity entity);
+		[[nodiscard]] bool IsAlive(Entity entity) const;
+
+		// @brief Constructs the component, replaces the value if the entity already has one.
+		// @return nullptr if the entity was destroyed.
+		template<ComponentType T, typename... ArgsT>
+		T* AddComponent(Entity entity, ArgsT&&... args)
+		{
+			bool hadComponent = false;
+			void* storage = AddComponent(entity, GetComponentTypeId<T>(), hadComponent);
+			if (!storage)
+				return nullptr;
+
+			if (hadComponent)
+			{
+				static_cast<T*>(storage)->~T();
+			}
+			return ::new (storage) T(std::forward<ArgsT>(args)...);
+		}
+
+		template<ComponentType T>
+		bool RemoveComponent(Entity entity)
+		{
+			return RemoveComponent(entity, GetComponentTypeId<T>());
+		}
+
+		// @return nullptr if the entity was destroyed or does not have T.
+		template<ComponentType T>
+		[[nodiscard]] T* GetComponent(Entity entity)
+		{
+			return static_cast<T*>(GetComponent(entity, GetComponentTypeId<T>()));
+		}
+
+		template<ComponentType T>
+		[[nodiscard]] const T* GetComponent(Entity entity) const
+		{
+			return static_cast<const T*>(GetComponent(entity, GetComponentTypeId<T>()));
+		}
+
+		template<ComponentType T>
+		[[nodiscard]] bool HasComponent(Entity entity) const
+		{
+			return GetComponent(entity, GetComponentTypeId<T>()) != nullptr;
+		}
+
+		// @brief Makes room for "entityCount" entities in the handle table.
+		void Reserve(size_t entityCount);
+
+		[[nodiscard]] size_t GetEntityCount() const;
+
+		// @brief Archetypes in creation order; they live as long as the world, also once empty.
+		[[nodiscard]] std::span<Archetype* const> GetArchetypes() const;
+
+		// @brief True while queries iterate or systems run: structural changes must go through a CommandBuffer.
+		[[nodiscard]] bool IsStructureLocked() const;
+
+		// ----------------------------------------------------------------------------------------------------
+		// Type-erased access, used by the templates above and by command buffers
+		// ----------------------------------------------------------------------------------------------------
+
+		// @brief Creates an entity with the given (distinct) types, its components are left uninitialized.
+		Entity CreateEntityWithTypes(std::span<const ComponentTypeId> types);
+
+		// @brief Storage of "type" in "entity", uninitialized unless "outHadComponent" is set. nullptr if dead.
+		void* AddComponent(Entity entity, ComponentTypeId type, bool& outHadComponent);
+
+		bool RemoveComponent(Entity entity, ComponentTypeId type);
+		[[nodiscard]] void* GetComponent(Entity entity, ComponentTypeId type) const;
+
+	private:
+		void LockStructure() const;
+		void UnlockStructure() const;
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+	};
+}
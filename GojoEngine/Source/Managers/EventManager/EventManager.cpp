@@ -1,11 +1,79 @@
 #include "Managers/EventManager/EventManager.h"
+#include "Managers/EventManager/EventRecorder.h"
+#include "Managers/EventManager/Events/KeyboardEvents.h"
+#include "Managers/EventManager/Events/MouseEvents.h"
+#include "Managers/EventManager/Events/WindowEvents.h"
 #include "Managers/LogManager/LogManager.h" 
+#include "Managers/FlightRecorder/FlightRecorder.h"
+#include "Core/Containers/MPSCQueue.h"
+#include "Core/Containers/BoundedQueue.h"
+#include "Core/Containers/TimerWheel.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Metrics/Metrics.h"
+#include "Core/Profiler/Profiler.h"
 
-#include <unordered_map>
 #include <vector>
+#include <optional>
+#include <format>
 
 namespace GojoEngine
 {
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		constexpr size_t cEventQueueCapacity = 2048;
+		constexpr size_t cQueuedEventInlineSize = 64;
+
+		// @brief One timer wheel tick.
+		using TimerTick = std::chrono::milliseconds;
+
+		// @brief One preallocated queue slot. Small events live in "Storage", larger ones are heap owned.
+		struct QueuedEvent
+		{
+			Event* Instance{ nullptr };
+			const QueuedEventOps* Ops{ nullptr };
+			EventTypeId TypeId{ cInvalidEventTypeId };
+			bool IsHeapOwned{ false };
+			bool IsRecordable{ true };		// False if a listener queued it, see tDispatchDepth
+			alignas(std::max_align_t) std::byte Storage[cQueuedEventInlineSize];
+
+			void Destroy()
+			{
+				if (IsHeapOwned)
+				{
+					delete Instance;
+				}
+				else
+				{
+					Instance->~Event();
+				}
+
+				Instance = nullptr;
+				IsHeapOwned = false;
+			}
+		};
+
+		// @brief Heap event waiting in the overflow queue.
+		struct OverflowEvent
+		{
+			std::unique_ptr<Event> Instance;
+			bool IsRecordable{ true };
+		};
+
+		// @brief Listener depth of the calling thread. Events queued while it is non-zero are consequences
+		//        of the event being dispatched: replaying that event queues them again, so they are not recorded.
+		thread_local uint32_t tDispatchDepth = 0;
+
+		// @brief Payload of a delayed or periodic event (copied once when scheduled).
+		struct ScheduledEvent
+		{
+			std::unique_ptr<Event> Instance;
+			EventTypeId TypeId{ cInvalidEventTypeId };
+		};
+	}
+
 	// ====================================================================================================
 	// EventManager Implementation (PIMPL)
 	// ====================================================================================================
@@ -13,68 +81,465 @@ namespace GojoEngine
 	class EventManager::Impl
 	{
 	public:
+		Impl()
+		{
+			// Register the engine events up front so recordings can be replayed before any listener exists
+			GetEventTypeId<KeyPressedEvent>();
+			GetEventTypeId<KeyReleasedEvent>();
+			GetEventTypeId<KeyTypedEvent>();
+			GetEventTypeId<MouseMovedEvent>();
+			GetEventTypeId<MouseScrolledEvent>();
+			GetEventTypeId<MouseButtonPressedEvent>();
+			GetEventTypeId<MouseButtonReleasedEvent>();
+			GetEventTypeId<WindowResizeEvent>();
+			GetEventTypeId<WindowCloseEvent>();
+			GetEventTypeId<WindowFocusEvent>();
+			GetEventTypeId<WindowLostFocusEvent>();
+			GetEventTypeId<WindowMovedEvent>();
+		}
+
+		~Impl()
+		{
+			mRecorder.Stop();
+
+			// Destroy events that were never dispatched
+			while (mEventQueue.TryPop([](QueuedEvent& slot) { slot.Destroy(); })) {}
+		}
+
 		// @brief Internal implementation to add a listener.
-		void AddListener(const EventType& eventType, std::unique_ptr<IEventCallback>&& callback)
+		void AddListener(EventTypeId typeId, EventDelegate&& callback)
+		{
+			GOJO_ASSERT_MESSAGE(callback, "Cannot add null listener!");
+			GOJO_ASSERT_MESSAGE(typeId != cInvalidEventTypeId, "Cannot add listener for an invalid event type!");
+
+			// Growing a table while one of its delegates runs would move that delegate, defer instead
+			if (mDispatchDepth > 0)
+			{
+				mPendingListeners.push_back({ typeId, std::nullopt, nullptr, std::move(callback) });
+				return;
+			}
+
+			// Store the callback in the contiguous list associated with the event type
+			GetOrCreateTable(typeId).Global.emplace_back(std::move(callback));
+
+			GOJO_LOG_DEBUG("EventManager", "Listener added for '{}'", EventTypeRegistry::GetName(typeId));
+		}
+
+		// @brief Internal implementation to add a window-scoped listener.
+		void AddWindowListener(EventTypeId typeId, WindowId windowId, EventWindowIdGetter windowIdGetter, EventDelegate&& callback)
 		{
 			GOJO_ASSERT_MESSAGE(callback, "Cannot add null listener!");
+			GOJO_ASSERT_MESSAGE(windowIdGetter, "Window listeners require a window ID getter!");
+			GOJO_ASSERT_MESSAGE(typeId != cInvalidEventTypeId, "Cannot add listener for an invalid event type!");
 
-			// Store the callback in the list associated with the event type
-			mListeners[eventType].emplace_back(std::move(callback));
+			if (mDispatchDepth > 0)
+			{
+				mPendingListeners.push_back({ typeId, windowId, windowIdGetter, std::move(callback) });
+				return;
+			}
 
-			GOJO_LOG_DEBUG("EventManager", "Listener added");
+			ListenerTable& table = GetOrCreateTable(typeId);
+			table.GetWindowId = windowIdGetter;
+
+			if (windowId.Index >= table.PerWindow.size())
+			{
+				table.PerWindow.resize(static_cast<size_t>(windowId.Index) + 1);
+			}
+
+			// A bucket left over by an erased window that used the same slot starts over
+			WindowListeners& bucket = table.PerWindow[windowId.Index];
+			if (bucket.Generation != windowId.Generation)
+			{
+				bucket.Generation = windowId.Generation;
+				bucket.Listeners.clear();
+			}
+			bucket.Listeners.emplace_back(std::move(callback));
+
+			GOJO_LOG_DEBUG("EventManager", "Listener added for '{}' on window {}", EventTypeRegistry::GetName(typeId), windowId.Index);
+		}
+
+		// @brief Internal implementation to drop the listeners of a destroyed window.
+		void RemoveWindowListeners(WindowId windowId)
+		{
+			if (mDispatchDepth > 0)
+			{
+				mPendingWindowRemovals.push_back(windowId);
+				return;
+			}
+
+			for (ListenerTable& table : mListeners)
+			{
+				if (windowId.Index < table.PerWindow.size() && table.PerWindow[windowId.Index].Generation == windowId.Generation)
+				{
+					table.PerWindow[windowId.Index].Listeners.clear();
+				}
+			}
 		}
 
 		// @brief Internal implementation to dispatch events immediately.
-		void DispatchEvent(const Event& event) const
+		//        Visits the bucket of the event's window (if any) and then the global listeners.
+		// @param isRecordable False for queued events that a listener enqueued.
+		void DispatchEvent(const Event& event, EventTypeId typeId, bool isRecordable = true)
 		{
-			auto it = mListeners.find(event.GetType());
-			if (it != mListeners.end())
+			GOJO_PROFILE_SCOPE("EventManager::DispatchEvent");
+
+			if (FlightRecorder* recorder = FlightRecorder::GetPtr())
+			{
+				recorder->RecordEvent(typeId, mDispatchDepth);
+			}
+			GetDispatchCounter(typeId).Add();
+
+			// Nested, timer and listener-queued dispatches are consequences of outer events, replay recreates them
+			if (isRecordable && mDispatchDepth == 0 && !mAdvancingTimers && mRecorder.IsRecording())
+			{
+				mRecorder.Record(event, typeId);
+			}
+
+			if (typeId >= mListeners.size())
 			{
-				for (const auto& callback : it->second)
+				GOJO_LOG_WARNING("EventManager", "No listeners found");
+				return;
+			}
+
+			const ListenerTable& table = mListeners[typeId];
+			const TaggedVector<EventDelegate, MemoryTag::Events>* windowListeners = nullptr;
+			if (table.GetWindowId)
+			{
+				// Events of an erased window (delayed ones, replays) do not reach a window that reused its slot
+				const WindowId windowId = table.GetWindowId(event);
+				if (windowId.Index < table.PerWindow.size() && table.PerWindow[windowId.Index].Generation == windowId.Generation)
 				{
-					if (callback)
+					windowListeners = &table.PerWindow[windowId.Index].Listeners;
+				}
+			}
+
+			if (table.Global.empty() && (!windowListeners || windowListeners->empty()))
+			{
+				GOJO_LOG_WARNING("EventManager", "No listeners found");
+				return;
+			}
+
+			++mDispatchDepth;
+			++tDispatchDepth;
+			if (windowListeners)
+			{
+				for (const EventDelegate& callback : *windowListeners)
+				{
+					callback(event);
+				}
+			}
+			for (const EventDelegate& callback : table.Global)
+			{
+				callback(event);
+			}
+			--tDispatchDepth;
+			--mDispatchDepth;
+
+			if (mDispatchDepth == 0)
+			{
+				FlushPendingChanges();
+			}
+		}
+
+		// @brief Internal implementation to enqueue a copy of an event (any thread).
+		void EnqueueEvent(const Event& event, EventTypeId typeId, const QueuedEventOps& ops)
+		{
+			const bool fitsInline = ops.Size <= cQueuedEventInlineSize && ops.Alignment <= alignof(std::max_align_t);
+			const bool isRecordable = tDispatchDepth == 0;
+
+			// Once the ring overflowed, every event (oversized ones included) keeps spilling until the
+			// consumer caught up, otherwise it would overtake the events waiting in the overflow queue
+			if (mOverflowQueue.GetSize() == 0)
+			{
+				if (fitsInline)
+				{
+					const bool pushed = mEventQueue.TryPush([&](QueuedEvent& slot)
+						{
+							slot.Instance = ops.CopyConstruct(slot.Storage, event);
+							slot.Ops = &ops;
+							slot.TypeId = typeId;
+							slot.IsHeapOwned = false;
+							slot.IsRecordable = isRecordable;
+						});
+
+					if (pushed)
 					{
-						callback->Execute(event);
+						mInlineEventCount.fetch_add(1, std::memory_order_relaxed);
+						return;
 					}
-					else
+				}
+				else
+				{
+					// Oversized events keep their place in the ring, only their payload lives on the heap
+					std::unique_ptr<Event> heapEvent = ops.HeapClone(event);
+					const bool pushed = mEventQueue.TryPush([&](QueuedEvent& slot)
+						{
+							slot.Instance = heapEvent.release();
+							slot.Ops = &ops;
+							slot.TypeId = typeId;
+							slot.IsHeapOwned = true;
+							slot.IsRecordable = isRecordable;
+						});
+
+					if (pushed)
 					{
-						GOJO_LOG_ERROR("EventManager", "Encountered null callback during dispatch!");
+						mHeapEventCount.fetch_add(1, std::memory_order_relaxed);
+						return;
 					}
+
+					EnqueueEvent(std::move(heapEvent));
+					return;
 				}
 			}
-			else
-			{
-				GOJO_LOG_WARNING("EventManager", "No listeners found");
-			}
+
+			EnqueueEvent(ops.HeapClone(event));
 		}
 
-		// @brief Internal implementation to enqueue events.
+		// @brief Internal implementation to enqueue heap events (any thread).
 		void EnqueueEvent(std::unique_ptr<Event>&& event)
 		{
 			GOJO_ASSERT_MESSAGE(event, "Cannot enqueue null event!");
-			mEventQueue.emplace_back(std::move(event));
+			mOverflowQueue.Push(OverflowEvent{ std::move(event), tDispatchDepth == 0 });
+			mHeapEventCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// @brief Internal implementation to schedule delayed/periodic events (main thread).
+		TimerHandle ScheduleEvent(const Event& event, EventTypeId typeId, const QueuedEventOps& ops, TimerTick delay, TimerTick period)
+		{
+			GOJO_ASSERT_MESSAGE(delay.count() >= 0 && period.count() >= 0, "Timer durations must not be negative!");
+
+			// The delay is measured from now, not from the last drain: the wheel only moves in DispatchEventsInQueue
+			return mTimers.ScheduleAt(
+				GetTimerTickNow() + static_cast<uint64_t>(delay.count()),
+				static_cast<uint64_t>(period.count()),
+				ScheduledEvent{ ops.HeapClone(event), typeId }
+			);
 		}
 
-		// @brief Internal implementation to process the queue.
+		bool CancelTimer(TimerHandle handle)
+		{
+			return mTimers.Cancel(handle);
+		}
+
+		// @brief Internal implementation to process the queue (main thread).
 		void DispatchEventsInQueue()
 		{
-			if (mEventQueue.empty())
+			GOJO_PROFILE_SCOPE("EventManager::DispatchEventsInQueue");
+
+			AdvanceTimers();
+
+			// Only drain what was queued before this call, events enqueued by listeners
+			// (or by other threads meanwhile) are processed on the next drain.
+			// The overflow is counted first: an event that spilled after an older one of the same
+			// producer went into the ring then always finds that older event in the ring count.
+			size_t pendingOverflowCount = mOverflowQueue.GetSize();
+			size_t pendingCount = mEventQueue.GetSize();
+			mQueueDepthMetric.Set(static_cast<double>(pendingCount + pendingOverflowCount));
+
+			const bool coalescingEnabled = mCoalescingEnabled.load(std::memory_order_relaxed);
+
+			while (pendingCount > 0)
+			{
+				--pendingCount;
+				const bool popped = mEventQueue.TryPop([&](QueuedEvent& slot)
+					{
+						GOJO_ASSERT(slot.Instance != nullptr);
+
+						if (coalescingEnabled && slot.Ops->Coalesce)
+						{
+							pendingCount -= CoalesceFollowingEvents(slot, pendingCount);
+						}
+
+						DispatchEvent(*slot.Instance, slot.TypeId, slot.IsRecordable);
+						slot.Destroy();
+					});
+
+				if (!popped)
+				{
+					// A producer is still writing its slot: the overflowed events must not overtake it
+					pendingOverflowCount = 0;
+					break;
+				}
+			}
+
+			OverflowEvent overflowEvent;
+			while (pendingOverflowCount-- > 0 && mOverflowQueue.TryPop(overflowEvent))
+			{
+				GOJO_ASSERT(overflowEvent.Instance != nullptr);
+				DispatchEvent(*overflowEvent.Instance, overflowEvent.Instance->GetTypeId(), overflowEvent.IsRecordable);
+			}
+
+			mRecorder.EndFrame();
+		}
+
+		[[nodiscard]] EventQueueStats GetQueueStats() const
+		{
+			EventQueueStats stats;
+			stats.InlineEvents = mInlineEventCount.load(std::memory_order_relaxed);
+			stats.HeapEvents = mHeapEventCount.load(std::memory_order_relaxed);
+			stats.CoalescedEvents = mCoalescedEventCount.load(std::memory_order_relaxed);
+			return stats;
+		}
+
+		void SetCoalescingEnabled(bool enabled) { mCoalescingEnabled.store(enabled, std::memory_order_relaxed); }
+		[[nodiscard]] bool IsCoalescingEnabled() const { return mCoalescingEnabled.load(std::memory_order_relaxed); }
+
+		bool StartRecording(const std::filesystem::path& path) { return mRecorder.Start(path); }
+		void StopRecording() { mRecorder.Stop(); }
+		[[nodiscard]] bool IsRecording() const { return mRecorder.IsRecording(); }
+
+	private:
+		// @brief Listeners of one window slot, only valid for the window handle of the same generation.
+		struct WindowListeners
+		{
+			uint32_t Generation{ 0 };
+			TaggedVector<EventDelegate, MemoryTag::Events> Listeners;
+		};
+
+		// @brief Listeners of one event type: global ones plus one bucket per window.
+		struct ListenerTable
+		{
+			TaggedVector<EventDelegate, MemoryTag::Events> Global;
+			TaggedVector<WindowListeners, MemoryTag::Events> PerWindow;	// Indexed by WindowId::Index
+			EventWindowIdGetter GetWindowId{ nullptr };				// Set once a window listener exists
+		};
+
+		// @brief Listener registration deferred until the outermost dispatch returns.
+		struct PendingListener
+		{
+			EventTypeId TypeId;
+			std::optional<WindowId> Window;
+			EventWindowIdGetter GetWindowId;
+			EventDelegate Callback;
+		};
+
+		[[nodiscard]] uint64_t GetTimerTickNow() const
+		{
+			return static_cast<uint64_t>(std::chrono::duration_cast<TimerTick>(std::chrono::steady_clock::now() - mTimerEpoch).count());
+		}
+
+		// @brief Dispatches every timer that became due since the previous call.
+		void AdvanceTimers()
+		{
+			const uint64_t currentTick = GetTimerTickNow();
+			if (currentTick <= mTimers.GetCurrentTick() || mAdvancingTimers)
 				return;
 
-			// Iterate through the queue and dispatch each event
-			for (const auto& eventPtr : mEventQueue)
+			mAdvancingTimers = true;
+			mTimers.Advance(currentTick - mTimers.GetCurrentTick(), [this](TimerHandle, ScheduledEvent& scheduled)
+				{
+					DispatchEvent(*scheduled.Instance, scheduled.TypeId);
+				});
+			mAdvancingTimers = false;
+		}
+
+		// @brief Merges the run of queued events that directly follows "slot" and can be coalesced into it.
+		//        The head slot is already claimed, so peeking/popping here sees the next events in order.
+		// @return Number of queued events consumed (at most maxCount).
+		size_t CoalesceFollowingEvents(QueuedEvent& slot, size_t maxCount)
+		{
+			size_t consumedCount = 0;
+			while (consumedCount < maxCount)
+			{
+				bool canMerge = false;
+				mEventQueue.TryPeek([&](QueuedEvent& next)
+					{
+						// A recorded event never absorbs a listener-queued one (or the other way round)
+						canMerge = next.TypeId == slot.TypeId && next.IsRecordable == slot.IsRecordable
+							&& slot.Ops->Coalesce(*slot.Instance, *next.Instance);
+					});
+
+				if (!canMerge)
+					break;
+
+				mEventQueue.TryPop([](QueuedEvent& next) { next.Destroy(); });
+				++consumedCount;
+			}
+
+			mCoalescedEventCount.fetch_add(consumedCount, std::memory_order_relaxed);
+			return consumedCount;
+		}
+
+		ListenerTable& GetOrCreateTable(EventTypeId typeId)
+		{
+			if (typeId >= mListeners.size())
+			{
+				mListeners.resize(static_cast<size_t>(typeId) + 1);
+			}
+			return mListeners[typeId];
+		}
+
+		void FlushPendingChanges()
+		{
+			if (!mPendingListeners.empty())
+			{
+				auto pendingListeners = std::move(mPendingListeners);
+				mPendingListeners.clear();
+
+				for (auto& pending : pendingListeners)
+				{
+					if (pending.Window)
+					{
+						AddWindowListener(pending.TypeId, *pending.Window, pending.GetWindowId, std::move(pending.Callback));
+					}
+					else
+					{
+						AddListener(pending.TypeId, std::move(pending.Callback));
+					}
+				}
+			}
+
+			if (!mPendingWindowRemovals.empty())
 			{
-				GOJO_ASSERT(eventPtr != nullptr);
-				DispatchEvent(*eventPtr);
+				auto pendingRemovals = std::move(mPendingWindowRemovals);
+				mPendingWindowRemovals.clear();
+
+				for (WindowId windowId : pendingRemovals)
+				{
+					RemoveWindowListeners(windowId);
+				}
 			}
+		}
 
-			// Clear the queue after processing
-			mEventQueue.clear();
+		// @brief Dispatch counter of an event type, registered the first time the type is dispatched.
+		Counter& GetDispatchCounter(EventTypeId typeId)
+		{
+			if (typeId >= mDispatchCounters.size())
+			{
+				mDispatchCounters.resize(static_cast<size_t>(typeId) + 1, nullptr);
+			}
+
+			Counter*& counter = mDispatchCounters[typeId];
+			if (!counter)
+			{
+				counter = &MetricsRegistry::GetCounter("gojo_events_dispatched_total", "Events dispatched to the listeners, by event type",
+					std::format("type=\"{}\"", MetricsRegistry::EscapeLabelValue(EventTypeRegistry::GetName(typeId))));
+			}
+			return *counter;
 		}
 
 	private:
-		std::unordered_map<EventType, std::vector<std::unique_ptr<IEventCallback>>> mListeners;
-		std::vector<std::unique_ptr<Event>> mEventQueue;
+		TaggedVector<ListenerTable, MemoryTag::Events> mListeners;		// Indexed by EventTypeId
+		TaggedVector<PendingListener, MemoryTag::Events> mPendingListeners;
+		std::vector<WindowId> mPendingWindowRemovals;
+		uint32_t mDispatchDepth{ 0 };
+
+		BoundedQueue<QueuedEvent> mEventQueue{ cEventQueueCapacity };	// Preallocated, reused every frame
+		MPSCQueue<OverflowEvent> mOverflowQueue;						// Used only when the ring is full
+
+		std::atomic<uint64_t> mInlineEventCount{ 0 };
+		std::atomic<uint64_t> mHeapEventCount{ 0 };
+		std::atomic<uint64_t> mCoalescedEventCount{ 0 };
+		std::atomic<bool> mCoalescingEnabled{ false };
+
+		TimerWheel<ScheduledEvent> mTimers;
+		std::chrono::steady_clock::time_point mTimerEpoch{ std::chrono::steady_clock::now() };
+		bool mAdvancingTimers{ false };
+
+		EventRecorder mRecorder;
+
+		std::vector<Counter*> mDispatchCounters;						// Indexed by EventTypeId, resolved lazily
+		Gauge& mQueueDepthMetric{ MetricsRegistry::GetGauge("gojo_event_queue_depth", "Events waiting in the queue when it was last drained") };
 	};
 
 	// ====================================================================================================
@@ -89,17 +554,41 @@ namespace GojoEngine
 
 	EventManager::~EventManager()
 	{
+		// Queued, overflowed and scheduled events die with the queues, the event pools can shrink now
+		pImpl.reset();
+		Event::ReleaseUnusedMemory();
+
 		GOJO_LOG_INFO("EventManager", "EventManager ShutDown complete!");
 	}
 
-	void EventManager::AddListener(const EventType& eventType, std::unique_ptr<IEventCallback>&& callback)
+	void EventManager::AddListener(EventTypeId typeId, EventDelegate&& callback)
+	{
+		pImpl->AddListener(typeId, std::move(callback));
+	}
+
+	void EventManager::AddWindowListener(EventTypeId typeId, WindowId windowId, EventWindowIdGetter windowIdGetter, EventDelegate&& callback)
+	{
+		pImpl->AddWindowListener(typeId, windowId, windowIdGetter, std::move(callback));
+	}
+
+	void EventManager::RemoveWindowListeners(WindowId windowId)
 	{
-		pImpl->AddListener(eventType, std::move(callback));
+		pImpl->RemoveWindowListeners(windowId);
 	}
 
 	void EventManager::DispatchEvent(const Event& event)
 	{
-		pImpl->DispatchEvent(event);
+		pImpl->DispatchEvent(event, event.GetTypeId());
+	}
+
+	void EventManager::DispatchEvent(const Event& event, EventTypeId typeId)
+	{
+		pImpl->DispatchEvent(event, typeId);
+	}
+
+	void EventManager::EnqueueEvent(const Event& event, EventTypeId typeId, const QueuedEventOps& ops)
+	{
+		pImpl->EnqueueEvent(event, typeId, ops);
 	}
 
 	void EventManager::EnqueueEvent(std::unique_ptr<Event>&& event)
@@ -107,8 +596,54 @@ namespace GojoEngine
 		pImpl->EnqueueEvent(std::move(event));
 	}
 
+	TimerHandle EventManager::EnqueueEventDelayed(const Event& event, EventTypeId typeId, const QueuedEventOps& ops, std::chrono::milliseconds delay)
+	{
+		return pImpl->ScheduleEvent(event, typeId, ops, delay, std::chrono::milliseconds::zero());
+	}
+
+	TimerHandle EventManager::EnqueueEventEvery(const Event& event, EventTypeId typeId, const QueuedEventOps& ops, std::chrono::milliseconds period)
+	{
+		GOJO_ASSERT_MESSAGE(period.count() > 0, "Periodic events require a positive period!");
+		return pImpl->ScheduleEvent(event, typeId, ops, period, period);
+	}
+
+	bool EventManager::CancelTimer(TimerHandle handle)
+	{
+		return pImpl->CancelTimer(handle);
+	}
+
 	void EventManager::DispatchEventsInQueue()
 	{
 		pImpl->DispatchEventsInQueue();
 	}
+
+	EventQueueStats EventManager::GetQueueStats() const
+	{
+		return pImpl->GetQueueStats();
+	}
+
+	void EventManager::SetCoalescingEnabled(bool enabled)
+	{
+		pImpl->SetCoalescingEnabled(enabled);
+	}
+
+	bool EventManager::IsCoalescingEnabled() const
+	{
+		return pImpl->IsCoalescingEnabled();
+	}
+
+	bool EventManager::StartRecording(const std::filesystem::path& path)
+	{
+		return pImpl->StartRecording(path);
+	}
+
+	void EventManager::StopRecording()
+	{
+		pImpl->StopRecording();
+	}
+
+	bool EventManager::IsRecording() const
+	{
+		return pImpl->IsRecording();
+	}
 }
\ No newline at end of file
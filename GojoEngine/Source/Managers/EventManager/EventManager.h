@@ -1,61 +1,105 @@
 #pragma once
 #include "Core/Macros.h"
+#include "Core/Delegate.h"
+#include "Core/Containers/TimerWheel.h"
 #include "Managers/Manager.h"
 #include "Managers/EventManager/Events/Event.h"
 #include "Managers/WindowManager/WindowManager.h"
-#include <functional>
+#include <chrono>
+#include <filesystem>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <concepts>
 
 namespace GojoEngine
 {
 	// ====================================================================================================
-	// Concepts
+	// Type Definitions
 	// ====================================================================================================
-	
-	// @brief Ensures the type is derived from the base Event class.
-	template<typename T>
-	concept DerivedFromEvent = std::derived_from<T, Event>;
 
-	// @brief Ensures the type is a valid event (derived from Event and copy constructible for queueing).
-	template<typename T>
-	concept ValidEvent = DerivedFromEvent<T> && std::copy_constructible<T>;
+	// @brief Inline storage reserved for every listener callable (captures included).
+	constexpr size_t cEventListenerCapacity = 64;
 
-	// ====================================================================================================
-	// Type Definitions & Interfaces
-	// ====================================================================================================
+	// @brief Type-erased listener stored contiguously in the dispatch tables.
+	using EventDelegate = Delegate<void(const Event&), cEventListenerCapacity>;
 
+	// @brief Typed callback, handy for storing listeners on the client side.
 	template<typename EventT>
-	using EventCallback = std::function<void(const EventT&)>;
+	using EventCallback = Delegate<void(const EventT&)>;
+
+	// @brief Ensures the callable can listen to EventT.
+	template<typename CallbackT, typename EventT>
+	concept EventListener = std::invocable<std::remove_cvref_t<CallbackT>&, const EventT&>;
 
-	// @brief Interface for type-erased event callbacks.
-	class IEventCallback
+	// @brief Concept to check if an Event type has a GetWindowId() method.
+	template<typename T>
+	concept HasWindowId = requires(T t)
 	{
-	public:
-		virtual ~IEventCallback() = default;
-		virtual void Execute(const Event& event) const = 0;
+		{ t.GetWindowId() } -> std::same_as<WindowId>;
 	};
 
-	// @brief Type-safe wrapper that casts the generic Event back to the specific EventT.
-	template<typename EventT>
-	class EventCallbackWrapper final : public IEventCallback
+	// @brief Extracts the window of a window-scoped event, used to pick the per-window listener bucket.
+	using EventWindowIdGetter = WindowId(*)(const Event& event);
+
+	// @brief Concept to check if an Event type can merge a newer event of the same type into itself.
+	template<typename T>
+	concept CoalescibleEvent = requires(T older, const T& newer)
 	{
-	public:
-		explicit EventCallbackWrapper(EventCallback<EventT> callback)
-			: mEventCallback(std::move(callback)) {}
+		older.Coalesce(newer);
+	};
 
-		void Execute(const Event& event) const override
+	// @brief Type-erased operations used by the event queue to store a concrete event inline.
+	struct QueuedEventOps
+	{
+		size_t Size;
+		size_t Alignment;
+		Event* (*CopyConstruct)(void* memory, const Event& source);
+		std::unique_ptr<Event> (*HeapClone)(const Event& source);
+		bool (*Coalesce)(Event& older, const Event& newer);		// nullptr if the type never coalesces
+	};
+
+	template<typename EventT>
+		requires ValidEvent<EventT>
+	inline constexpr QueuedEventOps cQueuedEventOps
+	{
+		sizeof(EventT),
+		alignof(EventT),
+		[](void* memory, const Event& source) -> Event* { return ::new (memory) EventT(static_cast<const EventT&>(source)); },
+		[](const Event& source) -> std::unique_ptr<Event> { return std::make_unique<EventT>(static_cast<const EventT&>(source)); },
+		[]() -> bool (*)(Event&, const Event&)
 		{
-			// Verify type safety
-			if (EventT::GetStaticType() == event.GetType())
+			if constexpr (CoalescibleEvent<EventT>)
 			{
-				mEventCallback(static_cast<const EventT&>(event));
+				return [](Event& older, const Event& newer) -> bool
+					{
+						auto& olderEvent = static_cast<EventT&>(older);
+						const auto& newerEvent = static_cast<const EventT&>(newer);
+
+						// Only events of the same window are merged
+						if constexpr (HasWindowId<EventT>)
+						{
+							if (olderEvent.GetWindowId() != newerEvent.GetWindowId())
+								return false;
+						}
+
+						olderEvent.Coalesce(newerEvent);
+						return true;
+					};
 			}
-		}
+			else
+			{
+				return nullptr;
+			}
+		}()
+	};
 
-	private:
-		EventCallback<EventT> mEventCallback;
+	// @brief Counters describing how queued events were stored and dispatched.
+	struct EventQueueStats
+	{
+		uint64_t InlineEvents{ 0 };		// Copied into a preallocated queue slot (no heap allocation)
+		uint64_t HeapEvents{ 0 };		// Oversized events or queue overflow (heap allocation)
+		uint64_t CoalescedEvents{ 0 };	// Merged into a preceding event instead of being dispatched
 	};
 
 	// ====================================================================================================
@@ -68,21 +112,80 @@ namespace GojoEngine
 
 	public:
 		// @brief Registers a listener for a specific event type.
-		// @param eventType The type ID of the event.
-		// @param callback Unique pointer to the callback interface (ownership transfer).
-		void AddListener(const EventType& eventType, std::unique_ptr<IEventCallback>&& callback);
+		//        Listeners added while dispatching become active once the outermost dispatch returns.
+		// @param typeId The dense type ID of the event.
+		// @param callback The type-erased callback (stored inline in the dispatch table).
+		void AddListener(EventTypeId typeId, EventDelegate&& callback);
+
+		// @brief Registers a listener that only receives events of one window.
+		//        Listeners are bucketed per (event type, window), so dispatch never visits other windows.
+		// @param typeId The dense type ID of the event.
+		// @param windowId The window to listen to.
+		// @param windowIdGetter Extracts the window ID from an event of this type.
+		// @param callback The type-erased callback (stored inline in the dispatch table).
+		void AddWindowListener(EventTypeId typeId, WindowId windowId, EventWindowIdGetter windowIdGetter, EventDelegate&& callback);
+
+		// @brief Drops every listener bound to a window (called when the window is destroyed).
+		void RemoveWindowListeners(WindowId windowId);
 
 		// @brief Immediately dispatches an event to all registered listeners.
 		// @param event The event instance to dispatch.
 		void DispatchEvent(const Event& event);
 
-		// @brief Adds an event to the queue for later processing.
+		// @brief Immediately dispatches an event whose type ID is already known (skips the virtual lookup).
+		// @param event The event instance to dispatch.
+		// @param typeId The dense type ID of the event.
+		void DispatchEvent(const Event& event, EventTypeId typeId);
+
+		// @brief Copies an event into the preallocated event queue for later processing.
+		//        Thread-safe and lock-free: may be called from any thread.
+		//        Performs no heap allocation unless the event is oversized or the queue is full.
+		// @param event The event instance to copy.
+		// @param typeId The dense type ID of the event.
+		// @param ops Type-erased copy operations of the concrete event type.
+		void EnqueueEvent(const Event& event, EventTypeId typeId, const QueuedEventOps& ops);
+
+		// @brief Adds an already heap-allocated event to the queue for later processing.
+		//        Thread-safe and lock-free: may be called from any thread.
 		// @param event Unique pointer to the event (ownership transfer).
 		void EnqueueEvent(std::unique_ptr<Event>&& event);
 
-		// @brief Processes all events currently in the queue.
+		// @brief Schedules a copy of an event to be dispatched once "delay" elapsed.
+		//        Timers live in a hierarchical timer wheel (O(1) schedule and cancel) and are
+		//        dispatched from DispatchEventsInQueue. Main thread only.
+		// @return Handle that can be passed to CancelTimer.
+		TimerHandle EnqueueEventDelayed(const Event& event, EventTypeId typeId, const QueuedEventOps& ops, std::chrono::milliseconds delay);
+
+		// @brief Schedules a copy of an event to be dispatched every "period" (first time after one period).
+		//        Main thread only.
+		// @return Handle that can be passed to CancelTimer.
+		TimerHandle EnqueueEventEvery(const Event& event, EventTypeId typeId, const QueuedEventOps& ops, std::chrono::milliseconds period);
+
+		// @brief Cancels a delayed or periodic event. Main thread only.
+		// @return False if the timer already fired (one-shot) or was cancelled.
+		bool CancelTimer(TimerHandle handle);
+
+		// @brief Processes due timers and all events currently in the queue.
+		//        Must be called from the main thread only (single consumer).
 		void DispatchEventsInQueue();
 
+		// @brief Returns how many queued events were stored inline, on the heap and coalesced since StartUp.
+		[[nodiscard]] EventQueueStats GetQueueStats() const;
+
+		// @brief Enables merging of consecutive coalescible queued events of the same type and window
+		//        (e.g. mouse moves, resizes). While enabled, window callbacks queue their events
+		//        instead of dispatching them, so a burst of input costs one dispatch per frame.
+		void SetCoalescingEnabled(bool enabled);
+		[[nodiscard]] bool IsCoalescingEnabled() const;
+
+		// @brief Streams every externally dispatched event (window input, queued events) into a binary
+		//        file together with its frame number and timestamp. Events dispatched or queued from listeners
+		//        and timer events are not recorded, replaying the outer events reproduces them. See EventReplayer.
+		// @return False if the file could not be created.
+		bool StartRecording(const std::filesystem::path& path);
+		void StopRecording();
+		[[nodiscard]] bool IsRecording() const;
+
 	private:
 		EventManager();
 		~EventManager();
@@ -98,46 +201,50 @@ namespace GojoEngine
 	// ====================================================================================================
 
 	// @brief Global helper to easily register a lambda or function as an event listener.
-	//        Automatically handles type deduction and wrapper creation.
+	//        The callable is stored inline, dispatch casts straight to EventT without any type check
+	//        because listeners are indexed by the exact event type ID.
 	// @tparam EventT The specific Event type to listen for.
 	// @param eventCallback The function to call when the event triggers.
-	template<typename EventT>
-		requires DerivedFromEvent<EventT>
-	inline void AddListener(const EventCallback<EventT>& eventCallback)
+	template<typename EventT, typename CallbackT>
+		requires IdentifiableEvent<EventT> && EventListener<CallbackT, EventT>
+	inline void AddListener(CallbackT&& eventCallback)
 	{
-		GOJO_ASSERT_MESSAGE(eventCallback, "Attempting to add an empty event callback!");
+		if constexpr (std::is_constructible_v<bool, const std::remove_cvref_t<CallbackT>&>)
+		{
+			GOJO_ASSERT_MESSAGE(eventCallback, "Attempting to add an empty event callback!");
+		}
 
 		EventManager::GetInstance().AddListener(
-			EventT::GetStaticType(),
-			std::make_unique<EventCallbackWrapper<EventT>>(eventCallback)
+			GetEventTypeId<EventT>(),
+			[callback = std::forward<CallbackT>(eventCallback)](const Event& event)
+			{
+				callback(static_cast<const EventT&>(event));
+			}
 		);
 	}
 
-	// @brief Concept to check if an Event type has a GetWindowId() method.
-	template<typename T>
-	concept HasWindowId = requires(T t)
-	{
-		{ t.GetWindowId() } -> std::same_as<WindowId>;
-	};
-
 	// @brief Global helper to register a listener for a specific Window ID.
-	//        The callback will only execute if the event's WindowId matches the target.
+	//        The callback is stored in the window's own bucket, events of other windows never reach it.
 	//        Useful for multi-window applications to filter events.
 	// @tparam EventT The specific Event type (Must have GetWindowId()).
 	// @param targetWindowId The specific Window ID to listen to.
 	// @param callback The function to call.
-	template<typename EventT>
-		requires DerivedFromEvent<EventT> && HasWindowId<EventT>
-	inline void AddWindowListener(WindowId targetWindowId, const EventCallback<EventT>& callback)
+	template<typename EventT, typename CallbackT>
+		requires IdentifiableEvent<EventT> && HasWindowId<EventT> && EventListener<CallbackT, EventT>
+	inline void AddWindowListener(WindowId targetWindowId, CallbackT&& callback)
 	{
-		// Wrap the callback in a lambda that checks the Window ID first
-		AddListener<EventT>(
-			[targetWindowId, callback](const EventT& event)
+		if constexpr (std::is_constructible_v<bool, const std::remove_cvref_t<CallbackT>&>)
+		{
+			GOJO_ASSERT_MESSAGE(callback, "Attempting to add an empty event callback!");
+		}
+
+		EventManager::GetInstance().AddWindowListener(
+			GetEventTypeId<EventT>(),
+			targetWindowId,
+			[](const Event& event) -> WindowId { return static_cast<const EventT&>(event).GetWindowId(); },
+			[callback = std::forward<CallbackT>(callback)](const Event& event)
 			{
-				if (targetWindowId == event.GetWindowId())
-				{
-					callback(event);
-				}
+				callback(static_cast<const EventT&>(event));
 			}
 		);
 	}
@@ -149,15 +256,67 @@ namespace GojoEngine
 		EventManager::GetInstance().DispatchEvent(event);
 	}
 
+	// @brief Global helper to dispatch an event of a statically known type immediately (blocking).
+	// @param event The event object.
+	template<typename EventT>
+		requires DerivedFromEvent<EventT>
+	inline void DispatchEvent(const EventT& event)
+	{
+		EventManager::GetInstance().DispatchEvent(event, GetEventTypeId(event));
+	}
+
 	// @brief Global helper to enqueue an event for later processing (non-blocking).
-	//        Creates a copy of the event on the heap.
+	//        Copies the event into a preallocated queue slot. Safe to call from any thread.
 	// @tparam EventT The type of event.
 	// @param event The event object to copy and queue.
 	template<typename EventT>
 		requires ValidEvent<EventT>
 	inline void EnqueueEvent(const EventT& event)
 	{
-		EventManager::GetInstance().EnqueueEvent(std::make_unique<EventT>(event));
+		EventManager::GetInstance().EnqueueEvent(event, GetEventTypeId(event), cQueuedEventOps<EventT>);
+	}
+
+	// @brief Global helper to dispatch a copy of an event after a delay (main thread).
+	// @return Handle that can be passed to CancelTimer.
+	template<typename EventT>
+		requires ValidEvent<EventT>
+	inline TimerHandle EnqueueEventDelayed(const EventT& event, std::chrono::milliseconds delay)
+	{
+		return EventManager::GetInstance().EnqueueEventDelayed(event, GetEventTypeId(event), cQueuedEventOps<EventT>, delay);
+	}
+
+	// @brief Global helper to dispatch a copy of an event periodically (main thread).
+	// @return Handle that can be passed to CancelTimer.
+	template<typename EventT>
+		requires ValidEvent<EventT>
+	inline TimerHandle EnqueueEventEvery(const EventT& event, std::chrono::milliseconds period)
+	{
+		return EventManager::GetInstance().EnqueueEventEvery(event, GetEventTypeId(event), cQueuedEventOps<EventT>, period);
+	}
+
+	// @brief Global helper to cancel a delayed or periodic event (main thread).
+	inline bool CancelTimer(TimerHandle handle)
+	{
+		return EventManager::GetInstance().CancelTimer(handle);
+	}
+
+	// @brief Global helper for event producers such as window callbacks.
+	//        Queues the event when coalescing is enabled (keeping its order relative to other
+	//        posted events), otherwise dispatches it immediately.
+	// @param event The event object.
+	template<typename EventT>
+		requires ValidEvent<EventT>
+	inline void PostEvent(const EventT& event)
+	{
+		auto& eventManager = EventManager::GetInstance();
+		if (eventManager.IsCoalescingEnabled())
+		{
+			eventManager.EnqueueEvent(event, GetEventTypeId(event), cQueuedEventOps<EventT>);
+		}
+		else
+		{
+			eventManager.DispatchEvent(event, GetEventTypeId(event));
+		}
 	}
 
 	// @brief Global helper to process all queued events.
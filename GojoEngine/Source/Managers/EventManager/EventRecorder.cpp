@@ -0,0 +1,422 @@
+#include "Managers/EventManager/EventRecorder.h"
+#include "Managers/EventManager/EventManager.h"
+#include "Managers/LogManager/LogManager.h"
+#include "Core/MappedFile.h"
+
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		// @brief Buffered records are written once they exceed this size (and at the end of every frame).
+		constexpr size_t cRecorderFlushThreshold = 64 * 1024;
+
+		constexpr size_t cRecordingHeaderSize = sizeof(cEventRecordingMagic) + sizeof(cEventRecordingVersion);
+
+		enum class RecordTag : uint8_t
+		{
+			TypeDeclaration = 0,
+			Event = 1
+		};
+
+		void WriteVarint(std::vector<std::byte>& output, uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				output.push_back(static_cast<std::byte>((value & 0x7F) | 0x80));
+				value >>= 7;
+			}
+			output.push_back(static_cast<std::byte>(value));
+		}
+
+		// @brief Reads a varint and advances "input". Returns std::nullopt on truncated or malformed data.
+		std::optional<uint64_t> ReadVarint(std::span<const std::byte>& input)
+		{
+			uint64_t value = 0;
+			for (uint32_t shift = 0; shift < 64 && !input.empty(); shift += 7)
+			{
+				const auto byte = static_cast<uint8_t>(input.front());
+				input = input.subspan(1);
+
+				value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0)
+				{
+					return value;
+				}
+			}
+			return std::nullopt;
+		}
+	}
+
+	// ====================================================================================================
+	// EventRecorder
+	// ====================================================================================================
+
+	bool EventRecorder::Start(const std::filesystem::path& path)
+	{
+		Stop();
+
+		mFile.open(path, std::ios::binary | std::ios::trunc);
+		if (!mFile.is_open())
+		{
+			GOJO_LOG_ERROR("EventRecorder", "Failed to open '{}' for recording", path.string());
+			return false;
+		}
+
+		mBuffer.clear();
+		mDeclaredTypes.clear();
+		mFrameIndex = 0;
+		mLastRecordFrame = 0;
+		mLastRecordTime = std::chrono::steady_clock::now();
+
+		const auto* magic = reinterpret_cast<const std::byte*>(cEventRecordingMagic);
+		mBuffer.insert(mBuffer.end(), magic, magic + sizeof(cEventRecordingMagic));
+		const auto* version = reinterpret_cast<const std::byte*>(&cEventRecordingVersion);
+		mBuffer.insert(mBuffer.end(), version, version + sizeof(cEventRecordingVersion));
+
+		GOJO_LOG_INFO("EventRecorder", "Recording events to '{}'", path.string());
+		return true;
+	}
+
+	void EventRecorder::Stop()
+	{
+		if (!mFile.is_open())
+			return;
+
+		WriteBuffer();
+		mFile.close();
+
+		GOJO_LOG_INFO("EventRecorder", "Recording stopped after {} frames", mFrameIndex);
+	}
+
+	void EventRecorder::Record(const Event& event, EventTypeId typeId)
+	{
+		const EventSerializer* serializer = EventTypeRegistry::GetSerializer(typeId);
+		if (!serializer)
+			return;
+
+		if (typeId >= mDeclaredTypes.size())
+		{
+			mDeclaredTypes.resize(static_cast<size_t>(typeId) + 1, false);
+		}
+
+		if (!mDeclaredTypes[typeId])
+		{
+			const std::string_view name = EventTypeRegistry::GetName(typeId);
+			mBuffer.push_back(static_cast<std::byte>(RecordTag::TypeDeclaration));
+			WriteVarint(mBuffer, typeId);
+			WriteVarint(mBuffer, name.size());
+			const auto* nameBytes = reinterpret_cast<const std::byte*>(name.data());
+			mBuffer.insert(mBuffer.end(), nameBytes, nameBytes + name.size());
+			mDeclaredTypes[typeId] = true;
+		}
+
+		mPayload.clear();
+		EventArchive archive(mPayload);
+		serializer->Serialize(event, archive);
+
+		const auto now = std::chrono::steady_clock::now();
+		const auto timeDelta = std::chrono::duration_cast<std::chrono::nanoseconds>(now - mLastRecordTime).count();
+
+		mBuffer.push_back(static_cast<std::byte>(RecordTag::Event));
+		WriteVarint(mBuffer, typeId);
+		WriteVarint(mBuffer, mFrameIndex - mLastRecordFrame);
+		WriteVarint(mBuffer, static_cast<uint64_t>(timeDelta > 0 ? timeDelta : 0));
+		WriteVarint(mBuffer, mPayload.size());
+		mBuffer.insert(mBuffer.end(), mPayload.begin(), mPayload.end());
+
+		mLastRecordFrame = mFrameIndex;
+		mLastRecordTime = now;
+
+		if (mBuffer.size() >= cRecorderFlushThreshold)
+		{
+			WriteBuffer();
+		}
+	}
+
+	void EventRecorder::EndFrame()
+	{
+		if (!mFile.is_open())
+			return;
+
+		++mFrameIndex;
+		WriteBuffer();
+	}
+
+	void EventRecorder::WriteBuffer()
+	{
+		if (mBuffer.empty())
+			return;
+
+		mFile.write(reinterpret_cast<const char*>(mBuffer.data()), static_cast<std::streamsize>(mBuffer.size()));
+		mBuffer.clear();
+	}
+
+	// ====================================================================================================
+	// EventReplayer Implementation (PIMPL)
+	// ====================================================================================================
+
+	class EventReplayer::Impl
+	{
+	public:
+		~Impl()
+		{
+			DestroyEvent();
+		}
+
+		bool Open(const std::filesystem::path& path)
+		{
+			Close();
+
+			if (!mFile.Open(path, MappedFile::Access::ReadOnly))
+			{
+				GOJO_LOG_ERROR("EventReplayer", "Failed to map '{}'", path.string());
+				return false;
+			}
+
+			const std::span<const std::byte> data(mFile.GetData(), mFile.GetSize());
+			uint32_t version = 0;
+			if (data.size() < cRecordingHeaderSize || std::memcmp(data.data(), cEventRecordingMagic, sizeof(cEventRecordingMagic)) != 0)
+			{
+				GOJO_LOG_ERROR("EventReplayer", "'{}' is not an event recording", path.string());
+				Close();
+				return false;
+			}
+
+			std::memcpy(&version, data.data() + sizeof(cEventRecordingMagic), sizeof(version));
+			if (version != cEventRecordingVersion)
+			{
+				GOJO_LOG_ERROR("EventReplayer", "'{}' has unsupported version {}", path.string(), version);
+				Close();
+				return false;
+			}
+
+			mCursor = data.subspan(cRecordingHeaderSize);
+			ReadNextEvent();
+
+			GOJO_LOG_INFO("EventReplayer", "Replaying events from '{}'", path.string());
+			return true;
+		}
+
+		void Close()
+		{
+			DestroyEvent();
+			mFile.Close();
+			mCursor = {};
+			mTypeMap.clear();
+			mHasNextEvent = false;
+			mNextFrame = 0;
+			mFrameIndex = 0;
+			mReplayedCount = 0;
+			mRecordedTime = {};
+			mNextTime = {};
+		}
+
+		size_t ReplayFrame()
+		{
+			size_t dispatchedCount = 0;
+			while (mHasNextEvent && mNextFrame <= mFrameIndex)
+			{
+				dispatchedCount += DispatchNextEvent() ? 1 : 0;
+				ReadNextEvent();
+			}
+
+			++mFrameIndex;
+			return dispatchedCount;
+		}
+
+		size_t ReplayAll()
+		{
+			size_t dispatchedCount = 0;
+			while (mHasNextEvent)
+			{
+				dispatchedCount += DispatchNextEvent() ? 1 : 0;
+				mFrameIndex = mNextFrame;
+				ReadNextEvent();
+			}
+			return dispatchedCount;
+		}
+
+		[[nodiscard]] bool IsFinished() const { return !mHasNextEvent; }
+		[[nodiscard]] uint64_t GetFrameIndex() const { return mFrameIndex; }
+		[[nodiscard]] uint64_t GetReplayedEventCount() const { return mReplayedCount; }
+		[[nodiscard]] std::chrono::nanoseconds GetRecordedTime() const { return mRecordedTime; }
+
+	private:
+		// @brief Parses records up to the next event. Type declarations are resolved on the way.
+		void ReadNextEvent()
+		{
+			mHasNextEvent = false;
+			while (!mCursor.empty())
+			{
+				const auto tag = static_cast<RecordTag>(mCursor.front());
+				mCursor = mCursor.subspan(1);
+
+				if (tag == RecordTag::TypeDeclaration)
+				{
+					const auto recordedId = ReadVarint(mCursor);
+					const auto nameLength = ReadVarint(mCursor);
+					if (!recordedId || !nameLength || *nameLength > mCursor.size())
+						break;
+
+					const std::string_view name(reinterpret_cast<const char*>(mCursor.data()), static_cast<size_t>(*nameLength));
+					mCursor = mCursor.subspan(static_cast<size_t>(*nameLength));
+
+					if (*recordedId >= mTypeMap.size())
+					{
+						mTypeMap.resize(static_cast<size_t>(*recordedId) + 1, cInvalidEventTypeId);
+					}
+					mTypeMap[*recordedId] = EventTypeRegistry::Find(name);
+
+					if (mTypeMap[*recordedId] == cInvalidEventTypeId)
+					{
+						GOJO_LOG_WARNING("EventReplayer", "Skipping unknown event type '{}'", name);
+					}
+					continue;
+				}
+
+				if (tag != RecordTag::Event)
+					break;
+
+				const auto recordedId = ReadVarint(mCursor);
+				const auto frameDelta = ReadVarint(mCursor);
+				const auto timeDelta = ReadVarint(mCursor);
+				const auto payloadSize = ReadVarint(mCursor);
+				if (!recordedId || !frameDelta || !timeDelta || !payloadSize || *payloadSize > mCursor.size())
+					break;
+
+				mNextTypeId = *recordedId < mTypeMap.size() ? mTypeMap[*recordedId] : cInvalidEventTypeId;
+				mNextFrame += *frameDelta;
+				mNextTime += std::chrono::nanoseconds(static_cast<int64_t>(*timeDelta));
+				mNextPayload = mCursor.first(static_cast<size_t>(*payloadSize));
+				mCursor = mCursor.subspan(static_cast<size_t>(*payloadSize));
+				mHasNextEvent = true;
+				return;
+			}
+
+			if (!mCursor.empty())
+			{
+				GOJO_LOG_ERROR("EventReplayer", "Recording is truncated or corrupted, replay stopped");
+				mCursor = {};
+			}
+		}
+
+		// @brief Rebuilds the pending event in the reused buffer and dispatches it.
+		bool DispatchNextEvent()
+		{
+			mRecordedTime = mNextTime;
+
+			const EventSerializer* serializer = EventTypeRegistry::GetSerializer(mNextTypeId);
+			if (!serializer)
+				return false;
+
+			GOJO_ASSERT_MESSAGE(serializer->Alignment <= alignof(std::max_align_t), "Replayed events cannot be over-aligned!");
+
+			DestroyEvent();
+			const size_t blockCount = (serializer->Size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+			if (blockCount > mEventStorage.size())
+			{
+				mEventStorage.resize(blockCount);
+			}
+
+			mEvent = serializer->Construct(mEventStorage.data());
+
+			EventArchive archive(mNextPayload);
+			serializer->Deserialize(*mEvent, archive);
+			if (archive.HasFailed())
+			{
+				GOJO_LOG_ERROR("EventReplayer", "Payload of '{}' does not match the event layout", EventTypeRegistry::GetName(mNextTypeId));
+				return false;
+			}
+
+			EventManager::GetInstance().DispatchEvent(*mEvent, mNextTypeId);
+			++mReplayedCount;
+			return true;
+		}
+
+		void DestroyEvent()
+		{
+			if (mEvent)
+			{
+				mEvent->~Event();
+				mEvent = nullptr;
+			}
+		}
+
+	private:
+		MappedFile mFile;
+		std::span<const std::byte> mCursor;
+		std::vector<EventTypeId> mTypeMap;				// Recorded type id -> id in this process
+
+		bool mHasNextEvent{ false };
+		EventTypeId mNextTypeId{ cInvalidEventTypeId };
+		uint64_t mNextFrame{ 0 };
+		std::chrono::nanoseconds mNextTime{ 0 };
+		std::span<const std::byte> mNextPayload;
+
+		std::vector<std::max_align_t> mEventStorage;	// Reused for every replayed event
+		Event* mEvent{ nullptr };
+
+		uint64_t mFrameIndex{ 0 };
+		uint64_t mReplayedCount{ 0 };
+		std::chrono::nanoseconds mRecordedTime{ 0 };
+	};
+
+	// ====================================================================================================
+	// EventReplayer Public API
+	// ====================================================================================================
+
+	EventReplayer::EventReplayer()
+		: pImpl(std::make_unique<Impl>())
+	{
+	}
+
+	EventReplayer::~EventReplayer() = default;
+
+	bool EventReplayer::Open(const std::filesystem::path& path)
+	{
+		return pImpl->Open(path);
+	}
+
+	void EventReplayer::Close()
+	{
+		pImpl->Close();
+	}
+
+	size_t EventReplayer::ReplayFrame()
+	{
+		return pImpl->ReplayFrame();
+	}
+
+	size_t EventReplayer::ReplayAll()
+	{
+		return pImpl->ReplayAll();
+	}
+
+	bool EventReplayer::IsFinished() const
+	{
+		return pImpl->IsFinished();
+	}
+
+	uint64_t EventReplayer::GetFrameIndex() const
+	{
+		return pImpl->GetFrameIndex();
+	}
+
+	uint64_t EventReplayer::GetReplayedEventCount() const
+	{
+		return pImpl->GetReplayedEventCount();
+	}
+
+	std::chrono::nanoseconds EventReplayer::GetRecordedTime() const
+	{
+		return pImpl->GetRecordedTime();
+	}
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "Core/Macros.h"
+#include "Core/Utility.h"
+#include "Managers/EventManager/Events/Event.h"
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Event Recording Format
+	// ====================================================================================================
+
+	/**
+	 * File layout (all integers except the header are LEB128 varints):
+	 *     Header:           "GJER" | uint32 version
+	 *     TypeDeclaration:  tag(0) | recorded type id | name length | name bytes
+	 *     Event:            tag(1) | recorded type id | frame delta | time delta (ns) | payload size | payload
+	 * A type is declared once, right before its first event. Payloads are written by Event::Serialize.
+	 */
+	constexpr char cEventRecordingMagic[4] = { 'G', 'J', 'E', 'R' };
+	constexpr uint32_t cEventRecordingVersion = 2;						// 2: WindowId became an index and generation pair
+
+	// ====================================================================================================
+	// Event Recorder
+	// ====================================================================================================
+
+	/**
+	 * @brief Streams dispatched events into a binary file. Owned by the EventManager (main thread only).
+	 */
+	class EventRecorder final : public NonCopyable
+	{
+	public:
+		bool Start(const std::filesystem::path& path);
+		void Stop();
+
+		// @brief Appends one event. Types without a serializer are skipped.
+		void Record(const Event& event, EventTypeId typeId);
+
+		// @brief Moves to the next frame and writes the buffered records to the file.
+		void EndFrame();
+
+		[[nodiscard]] bool IsRecording() const { return mFile.is_open(); }
+
+	private:
+		void WriteBuffer();
+
+	private:
+		std::ofstream mFile;
+		std::vector<std::byte> mBuffer;				// Records of the current frame
+		std::vector<std::byte> mPayload;			// Scratch buffer reused for every event
+		std::vector<bool> mDeclaredTypes;			// Indexed by EventTypeId
+
+		uint64_t mFrameIndex{ 0 };
+		uint64_t mLastRecordFrame{ 0 };
+		std::chrono::steady_clock::time_point mLastRecordTime;
+	};
+
+	// ====================================================================================================
+	// Event Replayer
+	// ====================================================================================================
+
+	/**
+	 * @brief Feeds a recording back through the EventManager, frame by frame.
+	 *
+	 * The file is memory mapped and events are rebuilt in a reused buffer, so replaying performs no
+	 * allocation once warm. No window is needed: events keep their recorded WindowId and reach the same
+	 * listeners. Types unknown to this process (never registered) are skipped.
+	 */
+	class GOJO_API EventReplayer final : public NonCopyable
+	{
+	public:
+		EventReplayer();
+		~EventReplayer() override;
+
+		// @brief Maps a recording and validates its header.
+		bool Open(const std::filesystem::path& path);
+		void Close();
+
+		// @brief Dispatches the events recorded for the next frame.
+		// @return Number of events dispatched.
+		size_t ReplayFrame();
+
+		// @brief Dispatches every remaining event, ignoring frame boundaries.
+		// @return Number of events dispatched.
+		size_t ReplayAll();
+
+		[[nodiscard]] bool IsFinished() const;
+		[[nodiscard]] uint64_t GetFrameIndex() const;
+		[[nodiscard]] uint64_t GetReplayedEventCount() const;
+
+		// @brief Time elapsed since the start of the recording at the last replayed event.
+		[[nodiscard]] std::chrono::nanoseconds GetRecordedTime() const;
+
+	private:
+		// PIMPL idiom to hide implementation details and STL containers
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+	};
+}
@@ -0,0 +1,196 @@
+#include "Managers/EventManager/Events/Event.h"
+#include "Core/Memory/FixedSizePool.h"
+#include "Managers/LogManager/LogManager.h"
+
+#include <array>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		struct EventTypeRegistryData
+		{
+			std::mutex Mutex;
+			std::deque<std::string> Names{ "None" };					// Index == EventTypeId, references are stable
+			std::deque<EventSerializer> Serializers{ EventSerializer{} };	// Index == EventTypeId
+			std::unordered_map<std::string_view, EventTypeId> Ids;		// Keys point into "Names"
+		};
+
+		EventTypeRegistryData& GetRegistryData()
+		{
+			static EventTypeRegistryData data;
+			return data;
+		}
+
+		// @brief Two types share one id: listeners would cast one to the other, there is no way to carry on.
+		[[noreturn]] void FailRegistration(std::string_view name, const char* reason)
+		{
+			GOJO_LOG_FATAL("EventManager", "Cannot register event type '{}': {}", name, reason);
+			if (const LogManager* logManager = LogManager::GetPtr())
+			{
+				logManager->Flush();
+			}
+			GOJO_ASSERT_MESSAGE(false, reason);
+			std::abort();
+		}
+
+		// @brief Function pointers differ between modules, the layout of one type does not.
+		bool IsSameType(const EventSerializer& left, const EventSerializer& right)
+		{
+			return left.Size == 0 || right.Size == 0
+				|| (left.Size == right.Size && left.Alignment == right.Alignment && left.IsValid() == right.IsValid());
+		}
+
+		constexpr size_t cEventPoolChunkSize = 16 * 1024;
+		constexpr std::array<size_t, 4> cEventPoolBlockSizes{ 64, 128, 256, 512 };
+
+		// @brief Size-class pools of heap events, larger events go straight to the tracker.
+		struct EventPools
+		{
+			EventPools()
+			{
+				for (size_t index = 0; index < cEventPoolBlockSizes.size(); ++index)
+				{
+					Pools[index] = std::make_unique<FixedSizePool>(cEventPoolBlockSizes[index], cEventPoolChunkSize / cEventPoolBlockSizes[index], PoolSite);
+				}
+			}
+
+			FixedSizePool* Find(size_t size)
+			{
+				for (size_t index = 0; index < cEventPoolBlockSizes.size(); ++index)
+				{
+					if (size <= cEventPoolBlockSizes[index])
+						return Pools[index].get();
+				}
+				return nullptr;
+			}
+
+			MemorySite PoolSite{ MemoryTag::Events, "EventPool", 0 };
+			MemorySite LargeEventSite{ MemoryTag::Events, "EventPool (large events)", 0 };
+			std::array<std::unique_ptr<FixedSizePool>, cEventPoolBlockSizes.size()> Pools;
+		};
+
+		EventPools& GetEventPools()
+		{
+			// Never destroyed: events may still be released by static destructors of other modules
+			static EventPools* pools = new EventPools();
+			return *pools;
+		}
+	}
+
+	// ====================================================================================================
+	// Event Memory
+	// ====================================================================================================
+
+	void* Event::operator new(size_t size)
+	{
+		EventPools& pools = GetEventPools();
+		if (FixedSizePool* pool = pools.Find(size))
+		{
+			return pool->Allocate();
+		}
+		return MemoryTracker::Allocate(size, alignof(std::max_align_t), pools.LargeEventSite);
+	}
+
+	void* Event::operator new(size_t size, std::align_val_t alignment)
+	{
+		return MemoryTracker::Allocate(size, static_cast<size_t>(alignment), GetEventPools().LargeEventSite);
+	}
+
+	void Event::operator delete(void* memory, size_t size) noexcept
+	{
+		if (FixedSizePool* pool = GetEventPools().Find(size))
+		{
+			pool->Free(memory);
+			return;
+		}
+		MemoryTracker::Free(memory);
+	}
+
+	void Event::operator delete(void* memory, size_t, std::align_val_t) noexcept
+	{
+		MemoryTracker::Free(memory);
+	}
+
+	void Event::ReleaseUnusedMemory()
+	{
+		for (auto& pool : GetEventPools().Pools)
+		{
+			pool->Trim();
+		}
+	}
+
+	// ====================================================================================================
+	// EventTypeRegistry
+	// ====================================================================================================
+
+	EventTypeId EventTypeRegistry::Register(std::string_view name, const EventSerializer& serializer)
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		if (auto it = data.Ids.find(name); it != data.Ids.end())
+		{
+			EventSerializer& registered = data.Serializers[it->second];
+			if (!IsSameType(registered, serializer))
+			{
+				FailRegistration(name, "Name collision with a different type, give the event a unique name!");
+			}
+
+			// The name may have been registered on its own, without a layout, before the type
+			if (registered.Size == 0)
+			{
+				registered = serializer;
+			}
+			return it->second;
+		}
+
+		const auto id = static_cast<EventTypeId>(data.Names.size());
+		const std::string& storedName = data.Names.emplace_back(name);
+		data.Serializers.emplace_back(serializer);
+		data.Ids.emplace(storedName, id);
+
+		return id;
+	}
+
+	EventTypeId EventTypeRegistry::Find(std::string_view name)
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		auto it = data.Ids.find(name);
+		return it != data.Ids.end() ? it->second : cInvalidEventTypeId;
+	}
+
+	std::string_view EventTypeRegistry::GetName(EventTypeId id)
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		return id < data.Names.size() ? std::string_view(data.Names[id]) : std::string_view();
+	}
+
+	const EventSerializer* EventTypeRegistry::GetSerializer(EventTypeId id)
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		return (id < data.Serializers.size() && data.Serializers[id].IsValid()) ? &data.Serializers[id] : nullptr;
+	}
+
+	EventTypeId EventTypeRegistry::GetCount()
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		return static_cast<EventTypeId>(data.Names.size());
+	}
+}
\ No newline at end of file
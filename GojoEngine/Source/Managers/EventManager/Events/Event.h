@@ -1,22 +1,62 @@
 #pragma once
 
 #include "Core/Macros.h"
+#include "Core/Utility.h"
+#include "Managers/EventManager/Events/EventArchive.h"
 
 #include <string>
+#include <string_view>
 #include <format>
+#include <concepts>
+#include <cstdint>
+#include <new>
+#include <type_traits>
 
 namespace GojoEngine
 {
 	// ====================================================================================================
-	// Event Types
+	// Event Type IDs
 	// ====================================================================================================
 
-	enum class GOJO_API EventType
+	// @brief Dense, process-wide id of a concrete event type (0 is never assigned).
+	using EventTypeId = uint32_t;
+	constexpr EventTypeId cInvalidEventTypeId = 0;
+
+	class Event;
+
+	// @brief Type-erased (de)serialization of one event type, used to record and replay events.
+	//        Empty for event types that are not SerializableEvent.
+	struct EventSerializer
 	{
-		None = 0,
-		KeyReleased, KeyPressed, KeyTyped,										// Keyboard
-		MouseButtonPressed, MouseButtonReleased, MouseMoved, MouseScrolled,		// Mouse
-		WindowClose, WindowResize, WindowMoved, WindowFocus, WindowLostFocus	// Window
+		size_t Size{ 0 };														// 0 when registered by name only
+		size_t Alignment{ 0 };
+		Event* (*Construct)(void* memory){ nullptr };							// Default-constructs in place
+		void (*Serialize)(const Event& event, EventArchive& archive){ nullptr };	// Writes the fields
+		void (*Deserialize)(Event& event, EventArchive& archive){ nullptr };		// Reads the fields
+
+		[[nodiscard]] bool IsValid() const { return Construct != nullptr; }
+	};
+
+	// @brief Process-wide registry that hands out dense event type ids by qualified type name.
+	//        Lives in GojoEngine so the engine and client modules agree on every id.
+	class GOJO_API EventTypeRegistry final
+	{
+	public:
+		// @brief Returns the id of "name", registering it on first use. Thread-safe.
+		//        Aborts, also in release, when the name is taken by a type of another size or serializability.
+		static EventTypeId Register(std::string_view name, const EventSerializer& serializer = {});
+
+		// @brief Returns the id of an already registered name (cInvalidEventTypeId if unknown).
+		static EventTypeId Find(std::string_view name);
+
+		// @brief Returns the registered name of an id (empty for unknown ids).
+		static std::string_view GetName(EventTypeId id);
+
+		// @brief Returns the serializer of an id (nullptr if unknown or not serializable).
+		static const EventSerializer* GetSerializer(EventTypeId id);
+
+		// @brief Upper bound (exclusive) of all ids registered so far.
+		static EventTypeId GetCount();
 	};
 
 	// ====================================================================================================
@@ -30,24 +70,122 @@ namespace GojoEngine
 		virtual ~Event() = default;
 
 		[[nodiscard]] virtual std::string ToString() const = 0;
-		[[nodiscard]] virtual EventType GetType() const = 0;
+		[[nodiscard]] virtual std::string_view GetName() const = 0;
+		[[nodiscard]] virtual EventTypeId GetTypeId() const = 0;
+
+		/**
+		 * @brief Heap events (queue overflow, delayed events, ...) come from size-class pools tagged
+		 * MemoryTag::Events, copying an event to the heap costs no malloc once the pools are warm.
+		 */
+		static void* operator new(size_t size);
+		static void* operator new(size_t size, std::align_val_t alignment);
+		static void operator delete(void* memory, size_t size) noexcept;
+		static void operator delete(void* memory, size_t size, std::align_val_t alignment) noexcept;
+
+		// @brief Returns the pool chunks to the heap once no heap event is alive anymore.
+		static void ReleaseUnusedMemory();
+	};
+
+	// ====================================================================================================
+	// Concepts
+	// ====================================================================================================
+
+	// @brief Ensures the type is derived from the base Event class.
+	template<typename T>
+	concept DerivedFromEvent = std::derived_from<T, Event>;
+
+	// @brief Ensures the type declares its identity through EVENT_TYPE.
+	template<typename T>
+	concept IdentifiableEvent = DerivedFromEvent<T> && requires
+	{
+		{ T::GetStaticName() } -> std::convertible_to<std::string_view>;
 	};
 
+	// @brief Ensures the type is a valid event (derived from Event and copy constructible for queueing).
+	template<typename T>
+	concept ValidEvent = DerivedFromEvent<T> && std::copy_constructible<T>;
+
+	// @brief Ensures the event can be recorded and replayed (default constructible + Serialize(EventArchive&)).
+	template<typename T>
+	concept SerializableEvent = DerivedFromEvent<T> && std::default_initializable<T> && requires(T event, EventArchive& archive)
+	{
+		event.Serialize(archive);
+	};
+
+	// @brief Builds the serializer registered alongside the type id of EventT.
+	template<typename EventT>
+		requires DerivedFromEvent<EventT>
+	constexpr EventSerializer MakeEventSerializer()
+	{
+		if constexpr (SerializableEvent<EventT>)
+		{
+			return EventSerializer
+			{
+				sizeof(EventT),
+				alignof(EventT),
+				[](void* memory) -> Event* { return ::new (memory) EventT(); },
+				// Serialize() only reads the fields while the archive is writing
+				[](const Event& event, EventArchive& archive) { const_cast<EventT&>(static_cast<const EventT&>(event)).Serialize(archive); },
+				[](Event& event, EventArchive& archive) { static_cast<EventT&>(event).Serialize(archive); }
+			};
+		}
+		else
+		{
+			// The layout is still known, the registry checks it against other types of the same name
+			return EventSerializer{ sizeof(EventT), alignof(EventT) };
+		}
+	}
+
+	// ====================================================================================================
+	// Event Type ID Lookup
+	// ====================================================================================================
+
+	// @brief Dense id of EventT. Resolved once per type and module, then a plain static read.
+	//        Any type using EVENT_TYPE gets an id, including event types defined by client code.
+	//        Keyed on the qualified type name, so event classes of the same name in different namespaces stay apart.
+	template<typename EventT>
+		requires IdentifiableEvent<EventT>
+	inline EventTypeId GetEventTypeId()
+	{
+		static const EventTypeId sTypeId = EventTypeRegistry::Register(GetTypeName<EventT>(), MakeEventSerializer<EventT>());
+		return sTypeId;
+	}
+
+	// @brief Dense id of an event instance, statically resolved when the concrete type is known.
+	template<typename EventT>
+		requires DerivedFromEvent<EventT>
+	inline EventTypeId GetEventTypeId(const EventT& event)
+	{
+		if constexpr (IdentifiableEvent<EventT>)
+		{
+			return GetEventTypeId<EventT>();
+		}
+		else
+		{
+			return event.GetTypeId();
+		}
+	}
+
 }
 
 // ====================================================================================================
 // Event Generation Macros
 // ====================================================================================================
 
-#define EVENT_TYPE(eventType, toStringFormat, ...)						\
-	static EventType GetStaticType()									\
+#define EVENT_TYPE(eventName, toStringFormat, ...)						\
+	static constexpr std::string_view GetStaticName()					\
+	{																	\
+		return #eventName;												\
+	}																	\
+																		\
+	virtual std::string_view GetName() const override					\
 	{																	\
-		return EventType::eventType;									\
+		return GetStaticName();											\
 	}																	\
 																		\
-	virtual EventType GetType() const override							\
+	virtual GojoEngine::EventTypeId GetTypeId() const override			\
 	{																	\
-		return GetStaticType();											\
+		return GojoEngine::GetEventTypeId<std::remove_cvref_t<decltype(*this)>>(); \
 	}																	\
 																		\
 	virtual std::string ToString() const override						\
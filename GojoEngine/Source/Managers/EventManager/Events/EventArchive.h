@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Core/Macros.h"
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Event Archive
+	// ====================================================================================================
+
+	/**
+	 * @brief Minimal bidirectional binary archive used to record and replay events.
+	 *
+	 * Events implement a single "void Serialize(EventArchive& archive)" that lists their fields,
+	 * the same function is used for writing and reading:
+	 *     void Serialize(EventArchive& archive) { archive(mWindowId, mMouseX, mMouseY); }
+	 * Only trivially copyable fields are supported, values are stored in host byte order.
+	 */
+	class EventArchive final
+	{
+	public:
+		// @brief Creates a writing archive that appends to "output".
+		explicit EventArchive(std::vector<std::byte>& output)
+			: mOutput(&output) {}
+
+		// @brief Creates a reading archive over "input".
+		explicit EventArchive(std::span<const std::byte> input)
+			: mInput(input) {}
+
+		template<typename... ValuesT>
+			requires (std::is_trivially_copyable_v<ValuesT> && ...)
+		EventArchive& operator()(ValuesT&... values)
+		{
+			(Process(values), ...);
+			return *this;
+		}
+
+		[[nodiscard]] bool IsReading() const { return mOutput == nullptr; }
+		[[nodiscard]] bool HasFailed() const { return mFailed; }
+
+	private:
+		template<typename ValueT>
+		void Process(ValueT& value)
+		{
+			if (mOutput)
+			{
+				const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+				mOutput->insert(mOutput->end(), bytes, bytes + sizeof(ValueT));
+			}
+			else if (!mFailed && mInput.size() >= sizeof(ValueT))
+			{
+				std::memcpy(&value, mInput.data(), sizeof(ValueT));
+				mInput = mInput.subspan(sizeof(ValueT));
+			}
+			else
+			{
+				mFailed = true;
+			}
+		}
+
+	private:
+		std::vector<std::byte>* mOutput{ nullptr };
+		std::span<const std::byte> mInput;
+		bool mFailed{ false };
+	};
+}
\ No newline at end of file
@@ -17,7 +17,11 @@ namespace GojoEngine
 		// @brief Returns the ID of the window where the key event occurred.
 		[[nodiscard]] WindowId GetWindowId() const { return mWindowId; }
 
+		// @brief Lists the recorded fields (see EventArchive).
+		void Serialize(EventArchive& archive) { archive(mWindowId, mKeyCode); }
+
 	protected:
+		KeyEvent() = default;
 		explicit KeyEvent(WindowId id, int keyCode)
 			: mWindowId(id), mKeyCode(keyCode) {}
 
@@ -30,8 +34,9 @@ namespace GojoEngine
 	class GOJO_API KeyReleasedEvent final : public KeyEvent
 	{
 	public:
+		KeyReleasedEvent() = default;
 		explicit KeyReleasedEvent(WindowId id, int keyCode) : KeyEvent(id, keyCode) {}
-		EVENT_TYPE(KeyReleased, "KeyReleased: ID[{}] Key[{}]", mWindowId.mId, mKeyCode);
+		EVENT_TYPE(KeyReleased, "KeyReleased: ID[{}] Key[{}]", mWindowId.Index, mKeyCode);
 	};
 
 
@@ -39,8 +44,9 @@ namespace GojoEngine
 	class GOJO_API KeyPressedEvent final : public KeyEvent
 	{
 	public:
+		KeyPressedEvent() = default;
 		explicit KeyPressedEvent(WindowId id, int keyCode) : KeyEvent(id, keyCode) {}
-		EVENT_TYPE(KeyPressed, "KeyPressed: ID[{}] Key[{}]", mWindowId.mId, mKeyCode);
+		EVENT_TYPE(KeyPressed, "KeyPressed: ID[{}] Key[{}]", mWindowId.Index, mKeyCode);
 	};
 
 
@@ -48,7 +54,8 @@ namespace GojoEngine
 	class GOJO_API KeyTypedEvent final : public KeyEvent
 	{
 	public:
+		KeyTypedEvent() = default;
 		explicit KeyTypedEvent(WindowId id, int keyCode) : KeyEvent(id, keyCode) {}
-		EVENT_TYPE(KeyTyped, "KeyTyped: ID[{}] Key[{}]", mWindowId.mId, mKeyCode);
+		EVENT_TYPE(KeyTyped, "KeyTyped: ID[{}] Key[{}]", mWindowId.Index, mKeyCode);
 	};
 }
\ No newline at end of file
@@ -11,6 +11,7 @@ namespace GojoEngine
 	class GOJO_API MouseMovedEvent final : public Event
 	{
 	public:
+		MouseMovedEvent() = default;
 		explicit MouseMovedEvent(WindowId id, float x, float y)
 			: mWindowId(id), mMouseX(x), mMouseY(y) {}
 
@@ -18,7 +19,13 @@ namespace GojoEngine
 		[[nodiscard]] float GetY() const { return mMouseY; }
 		[[nodiscard]] WindowId GetWindowId() const { return mWindowId; }
 
-		EVENT_TYPE(MouseMoved, "MouseMoved: ID[{}] Pos[{}, {}]", mWindowId.mId, mMouseX, mMouseY);
+		// @brief Merges a newer queued move of the same window (last position wins).
+		void Coalesce(const MouseMovedEvent& newer) { mMouseX = newer.mMouseX; mMouseY = newer.mMouseY; }
+
+		// @brief Lists the recorded fields (see EventArchive).
+		void Serialize(EventArchive& archive) { archive(mWindowId, mMouseX, mMouseY); }
+
+		EVENT_TYPE(MouseMoved, "MouseMoved: ID[{}] Pos[{}, {}]", mWindowId.Index, mMouseX, mMouseY);
 
 	private:
 		WindowId mWindowId;
@@ -30,6 +37,7 @@ namespace GojoEngine
 	class GOJO_API MouseScrolledEvent final : public Event
 	{
 	public:
+		MouseScrolledEvent() = default;
 		explicit MouseScrolledEvent(WindowId id, float xOffset, float yOffset)
 			: mWindowId(id), mXOffset(xOffset), mYOffset(yOffset) {}
 
@@ -37,7 +45,13 @@ namespace GojoEngine
 		[[nodiscard]] float GetYOffset() const { return mYOffset; }
 		[[nodiscard]] WindowId GetWindowId() const { return mWindowId; }
 
-		EVENT_TYPE(MouseScrolled, "MouseScrolled: ID[{}] Offset[{}, {}]", mWindowId.mId, mXOffset, mYOffset);
+		// @brief Merges a newer queued scroll of the same window (deltas are summed).
+		void Coalesce(const MouseScrolledEvent& newer) { mXOffset += newer.mXOffset; mYOffset += newer.mYOffset; }
+
+		// @brief Lists the recorded fields (see EventArchive).
+		void Serialize(EventArchive& archive) { archive(mWindowId, mXOffset, mYOffset); }
+
+		EVENT_TYPE(MouseScrolled, "MouseScrolled: ID[{}] Offset[{}, {}]", mWindowId.Index, mXOffset, mYOffset);
 
 	private:
 		WindowId mWindowId;
@@ -52,7 +66,11 @@ namespace GojoEngine
 		[[nodiscard]] int GetButton() const { return mButton; }
 		[[nodiscard]] WindowId GetWindowId() const { return mWindowId; }
 
+		// @brief Lists the recorded fields (see EventArchive).
+		void Serialize(EventArchive& archive) { archive(mWindowId, mButton); }
+
 	protected:
+		MouseButtonEvent() = default;
 		explicit MouseButtonEvent(WindowId id, int button)
 			: mWindowId(id), mButton(button) {}
 
@@ -65,10 +83,11 @@ namespace GojoEngine
 	class GOJO_API MouseButtonPressedEvent final : public MouseButtonEvent
 	{
 	public:
+		MouseButtonPressedEvent() = default;
 		explicit MouseButtonPressedEvent(WindowId id, int button)
 			: MouseButtonEvent(id, button) {}
 
-		EVENT_TYPE(MouseButtonPressed, "MouseButtonPressed: ID[{}] Button[{}]", mWindowId.mId, mButton);
+		EVENT_TYPE(MouseButtonPressed, "MouseButtonPressed: ID[{}] Button[{}]", mWindowId.Index, mButton);
 	};
 
 
@@ -76,9 +95,10 @@ namespace GojoEngine
 	class GOJO_API MouseButtonReleasedEvent final : public MouseButtonEvent
 	{
 	public:
+		MouseButtonReleasedEvent() = default;
 		explicit MouseButtonReleasedEvent(WindowId id, int button)
 			: MouseButtonEvent(id, button) {}
 
-		EVENT_TYPE(MouseButtonReleased, "MouseButtonReleased: ID[{}] Button[{}]", mWindowId.mId, mButton);
+		EVENT_TYPE(MouseButtonReleased, "MouseButtonReleased: ID[{}] Button[{}]", mWindowId.Index, mButton);
 	};
 }
\ No newline at end of file
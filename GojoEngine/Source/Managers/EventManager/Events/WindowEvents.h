@@ -14,7 +14,11 @@ namespace GojoEngine
 		// @brief Returns the ID of the window that generated this event.
 		[[nodiscard]] WindowId GetWindowId() const { return mWindowId; }
 
+		// @brief Lists the recorded fields (see EventArchive).
+		void Serialize(EventArchive& archive) { archive(mWindowId); }
+
 	protected:
+		WindowEvent() = default;
 		explicit WindowEvent(WindowId id) : mWindowId(id) {}
 
 		WindowId mWindowId;
@@ -25,13 +29,20 @@ namespace GojoEngine
 	class WindowResizeEvent : public WindowEvent
 	{
 	public:
+		WindowResizeEvent() = default;
 		explicit WindowResizeEvent(WindowId id, int width, int height)
 			: WindowEvent(id), mWidth(width), mHeight(height) {}
 
 		[[nodiscard]] int GetWidth() const { return mWidth; }
 		[[nodiscard]] int GetHeight() const { return mHeight; }
 
-		EVENT_TYPE(WindowResize, "WindowResize: ID[{}] Size[{} - {}]", mWindowId.mId, mWidth, mHeight)
+		// @brief Merges a newer queued resize of the same window (last size wins).
+		void Coalesce(const WindowResizeEvent& newer) { mWidth = newer.mWidth; mHeight = newer.mHeight; }
+
+		// @brief Lists the recorded fields (see EventArchive).
+		void Serialize(EventArchive& archive) { archive(mWindowId, mWidth, mHeight); }
+
+		EVENT_TYPE(WindowResize, "WindowResize: ID[{}] Size[{} - {}]", mWindowId.Index, mWidth, mHeight)
 
 	private:
 		int mWidth{ 0 }, mHeight{ 0 };
@@ -42,9 +53,10 @@ namespace GojoEngine
 	class GOJO_API WindowCloseEvent final : public WindowEvent
 	{
 	public:
+		WindowCloseEvent() = default;
 		explicit WindowCloseEvent(WindowId id) : WindowEvent(id) {}
 
-		EVENT_TYPE(WindowClose, "WindowClose: ID[{}]", mWindowId.mId);
+		EVENT_TYPE(WindowClose, "WindowClose: ID[{}]", mWindowId.Index);
 	};
 
 
@@ -52,9 +64,10 @@ namespace GojoEngine
 	class GOJO_API WindowFocusEvent final : public WindowEvent
 	{
 	public:
+		WindowFocusEvent() = default;
 		explicit WindowFocusEvent(WindowId id) : WindowEvent(id) {}
 
-		EVENT_TYPE(WindowFocus, "WindowFocus: ID[{}]", mWindowId.mId);
+		EVENT_TYPE(WindowFocus, "WindowFocus: ID[{}]", mWindowId.Index);
 	};
 
 
@@ -62,9 +75,10 @@ namespace GojoEngine
 	class GOJO_API WindowLostFocusEvent final : public WindowEvent
 	{
 	public:
+		WindowLostFocusEvent() = default;
 		explicit WindowLostFocusEvent(WindowId id) : WindowEvent(id) {}
 
-		EVENT_TYPE(WindowLostFocus, "WindowLostFocus: ID[{}]", mWindowId.mId);
+		EVENT_TYPE(WindowLostFocus, "WindowLostFocus: ID[{}]", mWindowId.Index);
 	};
 
 
@@ -72,13 +86,20 @@ namespace GojoEngine
 	class GOJO_API WindowMovedEvent final : public WindowEvent
 	{
 	public:
+		WindowMovedEvent() = default;
 		explicit WindowMovedEvent(WindowId id, int x, int y)
 			: WindowEvent(id), mX(x), mY(y) {}
 
 		[[nodiscard]] int GetX() const { return mX; }
 		[[nodiscard]] int GetY() const { return mY; }
 
-		EVENT_TYPE(WindowMoved, "WindowMoved: ID[{}] Moved[{}, {}]", mWindowId.mId, mX, mY);
+		// @brief Merges a newer queued move of the same window (last position wins).
+		void Coalesce(const WindowMovedEvent& newer) { mX = newer.mX; mY = newer.mY; }
+
+		// @brief Lists the recorded fields (see EventArchive).
+		void Serialize(EventArchive& archive) { archive(mWindowId, mX, mY); }
+
+		EVENT_TYPE(WindowMoved, "WindowMoved: ID[{}] Moved[{}, {}]", mWindowId.Index, mX, mY);
 
 	private:
 		int mX{ 0 }, mY{ 0 };
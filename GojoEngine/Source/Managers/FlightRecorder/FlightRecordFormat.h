@@ -0,0 +1,159 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Managers/LogManager/LogSite.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Flight Record Format
+	// ====================================================================================================
+
+	/**
+	 * Layout of the region mapped from "FlightRecorder.gjfr" (host byte order, 64-byte aligned sections).
+	 *
+	 *     FlightRecordHeader
+	 *     FlightRecordRing[RingCount]
+	 *     FlightRecord[RingCount * RecordsPerRing]		ring by ring
+	 *     FlightRecordSite[SiteCapacity]				indexed by the site id of log records
+	 *     FlightRecordEventType[EventTypeCapacity]		indexed by the event type id of event records
+	 *     char[StringCapacity]							categories, formats, files and event names
+	 *
+	 * The region is self-describing: records only hold ids into the tables of the same file, so a
+	 * region left behind by a crashed process can be decoded by the next run or by the decoder tool.
+	 */
+	constexpr char cFlightRecordMagic[4] = { 'G', 'J', 'F', 'R' };
+	constexpr uint32_t cFlightRecordVersion = 2;
+	constexpr const char* cFlightRecordExtension = ".gjfr";
+	constexpr size_t cFlightRecordMaxArgs = 16;			// Sites with more arguments keep their format only
+
+	enum class FlightRecordType : uint8_t
+	{
+		Log,
+		Event,
+		Frame
+	};
+
+	enum class FlightRecordState : uint32_t
+	{
+		Running = 1,
+		ShutDown = 2,				// Clean shutdown, nothing to report on the next start
+		Crashed = 3					// Marked by a crash handler, "CrashReason" holds the reason
+	};
+
+	enum FlightRecordFlags : uint8_t
+	{
+		cFlightRecordTruncated = 1 << 0					// The log arguments did not fit in the payload
+	};
+
+	struct alignas(64) FlightRecordHeader
+	{
+		char Magic[4];
+		uint32_t Version;
+		uint32_t RingCount;
+		uint32_t RecordsPerRing;
+		uint32_t SiteCapacity;
+		uint32_t EventTypeCapacity;
+		uint32_t StringCapacity;
+		std::atomic<uint32_t> StringSize;				// Bytes of the string area in use (may overshoot the capacity)
+		std::atomic<FlightRecordState> State;
+		char CrashReason[28];							// Not null-terminated when full
+		uint64_t StartTicks;
+		int64_t StartTime;								// Nanoseconds since the Unix epoch at StartTicks
+		std::atomic<uint64_t> CalibrationTicks;			// Refreshed every frame, maps ticks to wall time offline
+		std::atomic<int64_t> CalibrationTime;
+		std::atomic<uint64_t> FrameIndex;
+	};
+
+	struct alignas(64) FlightRecordRing
+	{
+		std::atomic<uint64_t> WriteIndex;				// Written by the owner thread only
+		std::atomic<uint64_t> Owner;					// Thread id hash, 0 while free
+		std::atomic<uint64_t> LastOwner;				// Kept after the thread exited, for the dump
+	};
+
+	// @brief Everything but the sequence number, copied out as a whole by the decoder.
+	struct FlightRecordData
+	{
+		uint64_t Ticks;
+		uint64_t Value;									// Site id, event type id, frame index
+		uint32_t Extra;									// Event dispatch depth, 1 for idle frames
+		FlightRecordType Type;
+		uint8_t Flags;
+		uint16_t PayloadSize;
+		std::byte Payload[96];							// Captured log arguments, frame duration
+	};
+
+	/**
+	 * @brief One ring slot. "Sequence" works as a per-record seqlock: 0 while the owner writes,
+	 * ring index + 1 once complete, so the decoder can skip records torn by a concurrent write or a crash.
+	 */
+	struct alignas(64) FlightRecord
+	{
+		std::atomic<uint64_t> Sequence;
+		FlightRecordData Data;
+	};
+	static_assert(sizeof(FlightRecord) == 128, "Flight records should stay two cache lines");
+
+	// @brief String in the string area of the region.
+	struct FlightRecordString
+	{
+		uint32_t Offset;
+		uint32_t Length;
+	};
+
+	struct FlightRecordSite
+	{
+		std::atomic<uint32_t> IsReady;					// Set once the entry is complete
+		uint32_t Line;
+		uint8_t Level;									// LogLevel
+		uint8_t ArgCount;								// Greater than cFlightRecordMaxArgs: arguments are not decoded
+		LogArgType ArgTypes[cFlightRecordMaxArgs];
+		FlightRecordString Category;					// Empty for runtime categories (LogMessage)
+		FlightRecordString Format;
+		FlightRecordString File;
+	};
+
+	struct FlightRecordEventType
+	{
+		std::atomic<uint32_t> State;					// 0 unknown, 1 being written, 2 ready
+		FlightRecordString Name;
+	};
+
+	// @brief Byte offsets of the sections, derived from the header.
+	struct FlightRecordLayout
+	{
+		size_t Rings;
+		size_t Records;
+		size_t Sites;
+		size_t EventTypes;
+		size_t Strings;
+		size_t Size;
+
+		static constexpr FlightRecordLayout Compute(uint32_t ringCount, uint32_t recordsPerRing, uint32_t siteCapacity, uint32_t eventTypeCapacity, uint32_t stringCapacity)
+		{
+			FlightRecordLayout layout{};
+			layout.Rings = sizeof(FlightRecordHeader);
+			layout.Records = layout.Rings + size_t{ ringCount } * sizeof(FlightRecordRing);
+			layout.Sites = layout.Records + size_t{ ringCount } * recordsPerRing * sizeof(FlightRecord);
+			layout.EventTypes = layout.Sites + size_t{ siteCapacity } * sizeof(FlightRecordSite);
+			layout.Strings = layout.EventTypes + size_t{ eventTypeCapacity } * sizeof(FlightRecordEventType);
+			layout.Size = layout.Strings + stringCapacity;
+			return layout;
+		}
+	};
+
+	/**
+	 * @brief Formats every complete record of a flight recorder region as time-sorted text.
+	 * Works on the live region and on a file left behind by an earlier run.
+	 * @return False if "region" is not a flight recorder region of this version.
+	 */
+	GOJO_API bool FormatFlightRecord(std::span<const std::byte> region, std::string_view reason, std::string& output);
+}
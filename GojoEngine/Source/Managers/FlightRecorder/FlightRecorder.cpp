@@ -0,0 +1,765 @@
+#include "Managers/FlightRecorder/FlightRecorder.h"
+#include "Managers/FlightRecorder/FlightRecordFormat.h"
+#include "Managers/LogManager/LogManager.h"
+#include "Managers/EventManager/Events/Event.h"
+#include "Core/MappedFile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cctype>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#endif
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		constexpr uint32_t cMaxHitchDumps = 8;			// Per run, a stuttering game must not fill the disk
+		constexpr uint32_t cInvalidSiteId = UINT32_MAX;
+		constexpr int cCrashSignals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+		constexpr std::string_view cRegionName = "FlightRecorder";
+		constexpr std::string_view cPreviousRegionName = "FlightRecorder.previous";
+
+		// @brief Cycle counter where available: a few nanoseconds, converted to wall time only by the decoder.
+		uint64_t ReadTicks()
+		{
+#if defined(_M_X64) || defined(__x86_64__)
+			return __rdtsc();
+#else
+			return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+		}
+
+		int64_t GetSystemTime()
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		}
+
+		uint64_t GetThreadIdHash()
+		{
+			const uint64_t hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+			return hash != 0 ? hash : 1;
+		}
+
+		std::string_view GetSignalName(int signal)
+		{
+			switch (signal)
+			{
+			case SIGSEGV:	return "SIGSEGV";
+			case SIGABRT:	return "SIGABRT";
+			case SIGFPE:	return "SIGFPE";
+			case SIGILL:	return "SIGILL";
+			default:		return "Signal";
+			}
+		}
+
+		using SignalHandler = void(*)(int);
+		SignalHandler sPreviousSignalHandlers[std::size(cCrashSignals)] = {};
+
+		// @brief Only marks the region (async-signal-safe), the next StartUp writes the dump.
+		void HandleCrashSignal(int signal)
+		{
+			if (auto* recorder = FlightRecorder::GetPtr())
+			{
+				recorder->MarkCrashed(GetSignalName(signal));
+			}
+
+			std::signal(signal, SIG_DFL);
+			std::raise(signal);
+		}
+
+#ifdef _WIN32
+		LPTOP_LEVEL_EXCEPTION_FILTER sPreviousExceptionFilter = nullptr;
+
+		LONG WINAPI HandleUnhandledException(EXCEPTION_POINTERS* exceptionInfo)
+		{
+			// The heap may be corrupt, the dump is written by the next StartUp as for signals
+			if (auto* recorder = FlightRecorder::GetPtr())
+			{
+				recorder->MarkCrashed("UnhandledException");
+			}
+
+			return sPreviousExceptionFilter ? sPreviousExceptionFilter(exceptionInfo) : EXCEPTION_CONTINUE_SEARCH;
+		}
+#endif
+
+		// @brief Identifies the recorder instance, thread-local ring bindings of a previous instance are stale.
+		std::atomic<uint64_t> sActiveGeneration{ 0 };
+		std::atomic<uint64_t> sGenerationCounter{ 0 };
+	}
+
+	// ====================================================================================================
+	// Thread Rings
+	// ====================================================================================================
+	namespace
+	{
+		/**
+		 * @brief Binding of the calling thread to its ring. The ring is released when the thread exits,
+		 * its records stay in place until another thread claims it.
+		 */
+		struct ThreadRing
+		{
+			uint64_t Generation{ 0 };
+			FlightRecordRing* Header{ nullptr };
+			FlightRecord* Records{ nullptr };
+
+			~ThreadRing()
+			{
+				if (Header && Generation == sActiveGeneration.load(std::memory_order_acquire))
+				{
+					Header->Owner.store(0, std::memory_order_release);
+				}
+			}
+		};
+
+		thread_local ThreadRing tThreadRing;
+	}
+
+	// ====================================================================================================
+	// Flight Record Decoding
+	// ====================================================================================================
+
+	bool FormatFlightRecord(std::span<const std::byte> region, std::string_view reason, std::string& output)
+	{
+		if (region.size() < sizeof(FlightRecordHeader))
+			return false;
+
+		const auto* header = reinterpret_cast<const FlightRecordHeader*>(region.data());
+		if (std::memcmp(header->Magic, cFlightRecordMagic, sizeof(cFlightRecordMagic)) != 0 || header->Version != cFlightRecordVersion || header->RecordsPerRing == 0)
+			return false;
+
+		const FlightRecordLayout layout = FlightRecordLayout::Compute(header->RingCount, header->RecordsPerRing, header->SiteCapacity, header->EventTypeCapacity, header->StringCapacity);
+		if (layout.Size > region.size())
+			return false;
+
+		const auto* rings = reinterpret_cast<const FlightRecordRing*>(region.data() + layout.Rings);
+		const auto* records = reinterpret_cast<const FlightRecord*>(region.data() + layout.Records);
+		const auto* sites = reinterpret_cast<const FlightRecordSite*>(region.data() + layout.Sites);
+		const auto* eventTypes = reinterpret_cast<const FlightRecordEventType*>(region.data() + layout.EventTypes);
+		const auto* strings = reinterpret_cast<const char*>(region.data() + layout.Strings);
+
+		const auto getString = [&](const FlightRecordString& text)
+			{
+				return uint64_t{ text.Offset } + text.Length <= header->StringCapacity ? std::string_view(strings + text.Offset, text.Length) : std::string_view();
+			};
+
+		// Complete records only, a record torn by a concurrent write or a crash fails its sequence check
+		struct Entry
+		{
+			FlightRecordData Data;
+			uint64_t Thread;
+		};
+
+		std::vector<Entry> entries;
+		for (uint32_t ringIndex = 0; ringIndex < header->RingCount; ++ringIndex)
+		{
+			const FlightRecordRing& ring = rings[ringIndex];
+			const uint64_t writeIndex = ring.WriteIndex.load(std::memory_order_acquire);
+			const uint64_t count = std::min<uint64_t>(writeIndex, header->RecordsPerRing);
+			const uint64_t thread = ring.LastOwner.load(std::memory_order_relaxed);
+			const FlightRecord* ringRecords = &records[size_t{ ringIndex } * header->RecordsPerRing];
+
+			for (uint64_t index = writeIndex - count; index < writeIndex; ++index)
+			{
+				const FlightRecord& record = ringRecords[index % header->RecordsPerRing];
+				if (record.Sequence.load(std::memory_order_acquire) != index + 1)
+					continue;
+
+				Entry entry{ {}, thread };
+				std::memcpy(&entry.Data, &record.Data, sizeof(FlightRecordData));
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (record.Sequence.load(std::memory_order_relaxed) != index + 1)
+					continue;
+
+				entries.push_back(entry);
+			}
+		}
+		std::ranges::sort(entries, {}, [](const Entry& entry) { return entry.Data.Ticks; });
+
+		// Ticks are mapped to wall time with the rate measured between StartUp and the last frame
+		const uint64_t calibrationTicks = header->CalibrationTicks.load(std::memory_order_relaxed);
+		const int64_t calibrationTime = header->CalibrationTime.load(std::memory_order_relaxed);
+		const double nsPerTick = calibrationTicks > header->StartTicks && calibrationTime > header->StartTime
+			? static_cast<double>(calibrationTime - header->StartTime) / static_cast<double>(calibrationTicks - header->StartTicks) : 1.0;
+		const auto toSystemTime = [&](uint64_t ticks)
+			{
+				const auto elapsed = static_cast<int64_t>(static_cast<double>(static_cast<int64_t>(ticks - header->StartTicks)) * nsPerTick);
+				return std::chrono::sys_time<std::chrono::nanoseconds>(std::chrono::nanoseconds(header->StartTime + elapsed));
+			};
+
+		std::format_to(std::back_inserter(output), "Flight record: {}\nFrame: {}\nRecords: {}\n\n", reason, header->FrameIndex.load(std::memory_order_relaxed), entries.size());
+
+		std::vector<DecodedLogArg> arguments;
+		for (const Entry& entry : entries)
+		{
+			const FlightRecordData& data = entry.Data;
+			std::format_to(std::back_inserter(output), "[{:%F %T}] [{:016x}] ", std::chrono::floor<std::chrono::microseconds>(toSystemTime(data.Ticks)), entry.Thread);
+
+			switch (data.Type)
+			{
+			case FlightRecordType::Log:
+			{
+				const FlightRecordSite* site = data.Value < header->SiteCapacity ? &sites[data.Value] : nullptr;
+				if (!site || !site->IsReady.load(std::memory_order_acquire))
+				{
+					std::format_to(std::back_inserter(output), "[log] <unknown site {}>", data.Value);
+					break;
+				}
+
+				const std::string_view category = getString(site->Category);
+				const std::string_view format = getString(site->Format);
+				std::format_to(std::back_inserter(output), "[{}] ", GetLogLevelName(static_cast<LogLevel>(site->Level)));
+				if (!category.empty())
+				{
+					output.append("[").append(category).append("] ");
+				}
+
+				const bool isDecoded = !(data.Flags & cFlightRecordTruncated) && site->ArgCount <= cFlightRecordMaxArgs
+					&& DecodeLogArgs(std::span(site->ArgTypes, site->ArgCount), std::span(data.Payload, std::min<size_t>(data.PayloadSize, sizeof(data.Payload))), arguments);
+				if (isDecoded)
+				{
+					FormatDecodedLogArgs(output, format, arguments);
+				}
+				else
+				{
+					output.append(format).append(" <arguments not recorded>");
+				}
+				break;
+			}
+			case FlightRecordType::Event:
+			{
+				const FlightRecordEventType* eventType = data.Value < header->EventTypeCapacity ? &eventTypes[data.Value] : nullptr;
+				if (eventType && eventType->State.load(std::memory_order_acquire) == 2)
+				{
+					std::format_to(std::back_inserter(output), "[event] {} (depth {})", getString(eventType->Name), data.Extra);
+				}
+				else
+				{
+					std::format_to(std::back_inserter(output), "[event] #{} (depth {})", data.Value, data.Extra);
+				}
+				break;
+			}
+			case FlightRecordType::Frame:
+			{
+				int64_t durationNs = 0;
+				std::memcpy(&durationNs, data.Payload, sizeof(durationNs));
+				std::format_to(std::back_inserter(output), "[frame] {} (previous frame {:.3f} ms{})", data.Value, static_cast<double>(durationNs) / 1e6, data.Extra ? ", idle" : "");
+				break;
+			}
+			}
+
+			output.push_back('\n');
+		}
+
+		return true;
+	}
+
+	// ====================================================================================================
+	// FlightRecorder Implementation (PIMPL)
+	// ====================================================================================================
+
+	class FlightRecorder::Impl
+	{
+	public:
+		explicit Impl(const FlightRecorderSettings& settings)
+			: mDirectory(settings.Directory)
+			, mRecordsPerRing(std::bit_ceil(std::max(settings.RecordsPerThread, 16u)))
+			, mRingCount(std::max(settings.MaxThreads, 1u))
+			, mSiteCapacity(std::max(settings.SiteCapacity, 1u))
+			, mEventTypeCapacity(settings.EventTypeCapacity)
+			, mHitchThreshold(std::chrono::milliseconds(settings.HitchThresholdMs))
+			, mGeneration(sGenerationCounter.fetch_add(1, std::memory_order_relaxed) + 1)
+		{
+			const FlightRecordLayout layout = FlightRecordLayout::Compute(mRingCount, mRecordsPerRing, mSiteCapacity, mEventTypeCapacity, settings.StringCapacity);
+			mRegionSize = layout.Size;
+
+			// The region of the previous run is kept, and dumped if that run did not shut down
+			std::error_code error;
+			std::filesystem::create_directories(mDirectory, error);
+			const std::filesystem::path regionPath = mDirectory / std::format("{}{}", cRegionName, cFlightRecordExtension);
+			RotatePreviousRegion(regionPath);
+
+			// Backed by a file mapping when possible: the OS writes the pages back even after a hard crash
+			if (mMappedRegion.Open(regionPath, MappedFile::Access::ReadWrite, mRegionSize))
+			{
+				mRegion = mMappedRegion.GetData();
+				std::memset(mRegion, 0, mRegionSize);
+			}
+			else
+			{
+				mHeapRegion = std::make_unique<FlightRecord[]>(mRegionSize / sizeof(FlightRecord) + 1);
+				mRegion = reinterpret_cast<std::byte*>(mHeapRegion.get());
+			}
+
+			mHeader = new (mRegion) FlightRecordHeader{};
+			std::memcpy(mHeader->Magic, cFlightRecordMagic, sizeof(cFlightRecordMagic));
+			mHeader->Version = cFlightRecordVersion;
+			mHeader->RingCount = mRingCount;
+			mHeader->RecordsPerRing = mRecordsPerRing;
+			mHeader->SiteCapacity = mSiteCapacity;
+			mHeader->EventTypeCapacity = mEventTypeCapacity;
+			mHeader->StringCapacity = settings.StringCapacity;
+			mHeader->StartTicks = ReadTicks();
+			mHeader->StartTime = GetSystemTime();
+			mHeader->State.store(FlightRecordState::Running, std::memory_order_relaxed);
+
+			mRings = reinterpret_cast<FlightRecordRing*>(mRegion + layout.Rings);
+			mRecords = reinterpret_cast<FlightRecord*>(mRegion + layout.Records);
+			mSites = reinterpret_cast<FlightRecordSite*>(mRegion + layout.Sites);
+			mEventTypes = reinterpret_cast<FlightRecordEventType*>(mRegion + layout.EventTypes);
+			mStrings = reinterpret_cast<char*>(mRegion + layout.Strings);
+			for (uint32_t i = 0; i < mRingCount; ++i)
+			{
+				new (&mRings[i]) FlightRecordRing{};
+			}
+			for (size_t i = 0; i < size_t{ mRingCount } * mRecordsPerRing; ++i)
+			{
+				new (&mRecords[i]) FlightRecord{};
+			}
+			for (uint32_t i = 0; i < mSiteCapacity; ++i)
+			{
+				new (&mSites[i]) FlightRecordSite{};
+			}
+			for (uint32_t i = 0; i < mEventTypeCapacity; ++i)
+			{
+				new (&mEventTypes[i]) FlightRecordEventType{};
+			}
+
+			// Open addressing from site address to site id, kept at most half full
+			mSiteSlotMask = std::bit_ceil(size_t{ mSiteCapacity } * 2) - 1;
+			mSiteKeys = std::make_unique<std::atomic<const LogSite*>[]>(mSiteSlotMask + 1);
+			mSiteIds = std::make_unique<std::atomic<uint32_t>[]>(mSiteSlotMask + 1);
+
+			sActiveGeneration.store(mGeneration, std::memory_order_release);
+
+			if (settings.InstallCrashHandlers)
+			{
+				InstallCrashHandlers();
+			}
+		}
+
+		~Impl()
+		{
+			if (mCrashHandlersInstalled)
+			{
+				UninstallCrashHandlers();
+			}
+
+			sActiveGeneration.store(0, std::memory_order_release);
+
+			// A crash marked before ShutDown is still reported by the next run
+			FlightRecordState expected = FlightRecordState::Running;
+			mHeader->State.compare_exchange_strong(expected, FlightRecordState::ShutDown, std::memory_order_acq_rel);
+			mMappedRegion.Close();
+		}
+
+		void RecordLog(const LogSite& site, const LogArgsLayout& layout, size_t argumentsSize, LogArgsWriter writer, const void* context)
+		{
+			const uint32_t siteId = GetSiteId(site, layout);
+
+			uint64_t index = 0;
+			FlightRecord* record = BeginRecord(index);
+			if (!record) return;
+
+			FlightRecordData& data = record->Data;
+			data.Type = FlightRecordType::Log;
+			data.Value = siteId;
+			if (argumentsSize <= sizeof(data.Payload))
+			{
+				writer(data.Payload, context);
+				data.PayloadSize = static_cast<uint16_t>(argumentsSize);
+				data.Flags = 0;
+			}
+			else
+			{
+				data.PayloadSize = 0;
+				data.Flags = cFlightRecordTruncated;
+			}
+
+			EndRecord(record, index);
+		}
+
+		void RecordEvent(uint32_t eventTypeId, uint32_t depth)
+		{
+			if (eventTypeId < mEventTypeCapacity && mEventTypes[eventTypeId].State.load(std::memory_order_acquire) != 2)
+			{
+				DeclareEventType(eventTypeId);
+			}
+
+			uint64_t index = 0;
+			FlightRecord* record = BeginRecord(index);
+			if (!record) return;
+
+			FlightRecordData& data = record->Data;
+			data.Type = FlightRecordType::Event;
+			data.Value = eventTypeId;
+			data.Extra = depth;
+			data.PayloadSize = 0;
+
+			EndRecord(record, index);
+		}
+
+		void MarkFrame()
+		{
+			const auto now = std::chrono::steady_clock::now();
+			const uint64_t frameIndex = mHeader->FrameIndex.fetch_add(1, std::memory_order_relaxed);
+			const auto duration = frameIndex > 0 ? now - mLastFrameStart : std::chrono::steady_clock::duration::zero();
+			const bool wasIdleFrame = std::exchange(mIsIdleFrame, false);
+			mLastFrameStart = now;
+
+			uint64_t index = 0;
+			if (FlightRecord* record = BeginRecord(index))
+			{
+				const int64_t durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+
+				FlightRecordData& data = record->Data;
+				data.Type = FlightRecordType::Frame;
+				data.Value = frameIndex;
+				data.Extra = wasIdleFrame ? 1 : 0;
+				std::memcpy(data.Payload, &durationNs, sizeof(durationNs));
+				data.PayloadSize = sizeof(durationNs);
+
+				// Lets the decoder map ticks to wall time without running code at crash time
+				mHeader->CalibrationTicks.store(data.Ticks, std::memory_order_relaxed);
+				mHeader->CalibrationTime.store(GetSystemTime(), std::memory_order_relaxed);
+
+				EndRecord(record, index);
+			}
+
+			if (mHitchThreshold.count() > 0 && duration > mHitchThreshold && !wasIdleFrame && mHitchDumpCount < cMaxHitchDumps)
+			{
+				++mHitchDumpCount;
+				Dump("Hitch");
+			}
+		}
+
+		void MarkIdleFrame()
+		{
+			mIsIdleFrame = true;
+		}
+
+		void MarkCrashed(std::string_view reason)
+		{
+			// Async-signal-safe: lock-free atomics and plain stores into the mapped pages only
+			if (mHeader->State.load(std::memory_order_acquire) != FlightRecordState::Running)
+				return;
+
+			for (size_t i = 0; i < sizeof(mHeader->CrashReason); ++i)
+			{
+				mHeader->CrashReason[i] = i < reason.size() ? reason[i] : '\0';
+			}
+			mHeader->State.store(FlightRecordState::Crashed, std::memory_order_release);
+		}
+
+		std::filesystem::path Dump(std::string_view reason)
+		{
+			bool expected = false;
+			if (!mDumping.compare_exchange_strong(expected, true, std::memory_order_acquire))
+				return {};
+
+			// The raw rings first, in case writing the text dump crashes as well
+			mMappedRegion.Flush();
+
+			const std::filesystem::path path = WriteDump(std::span<const std::byte>(mRegion, mRegionSize), reason);
+			mDumping.store(false, std::memory_order_release);
+			return path;
+		}
+
+		[[nodiscard]] uint64_t GetFrameIndex() const
+		{
+			return mHeader->FrameIndex.load(std::memory_order_relaxed);
+		}
+
+	private:
+		FlightRecord* BeginRecord(uint64_t& index)
+		{
+			ThreadRing& ring = tThreadRing;
+			if (ring.Generation != mGeneration)
+			{
+				ClaimRing(ring);
+			}
+			if (!ring.Records) return nullptr;
+
+			index = ring.Header->WriteIndex.load(std::memory_order_relaxed);
+			FlightRecord* record = &ring.Records[index & (mRecordsPerRing - 1)];
+			record->Sequence.store(0, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			record->Data.Ticks = ReadTicks();
+			return record;
+		}
+
+		void EndRecord(FlightRecord* record, uint64_t index)
+		{
+			record->Sequence.store(index + 1, std::memory_order_release);
+			tThreadRing.Header->WriteIndex.store(index + 1, std::memory_order_release);
+		}
+
+		void ClaimRing(ThreadRing& ring)
+		{
+			ring.Generation = mGeneration;
+			ring.Header = nullptr;
+			ring.Records = nullptr;
+
+			const uint64_t thread = GetThreadIdHash();
+			for (uint32_t i = 0; i < mRingCount; ++i)
+			{
+				uint64_t expected = 0;
+				if (mRings[i].Owner.compare_exchange_strong(expected, thread, std::memory_order_acq_rel))
+				{
+					mRings[i].LastOwner.store(thread, std::memory_order_relaxed);
+					ring.Header = &mRings[i];
+					ring.Records = &mRecords[size_t{ i } * mRecordsPerRing];
+					return;
+				}
+			}
+			// Every ring is taken, this thread stays unrecorded
+		}
+
+		// @brief Returns the id of "site" in the region's site table, declaring it on first use. Lock-free.
+		uint32_t GetSiteId(const LogSite& site, const LogArgsLayout& layout)
+		{
+			const auto address = reinterpret_cast<uintptr_t>(&site);
+			size_t slot = static_cast<size_t>((address >> 3) * 0x9E3779B97F4A7C15ull) & mSiteSlotMask;
+			for (size_t probe = 0; probe <= mSiteSlotMask; ++probe, slot = (slot + 1) & mSiteSlotMask)
+			{
+				const LogSite* key = mSiteKeys[slot].load(std::memory_order_acquire);
+				if (!key && mSiteKeys[slot].compare_exchange_strong(key, &site, std::memory_order_acq_rel))
+				{
+					const uint32_t siteId = DeclareSite(site, layout);
+					mSiteIds[slot].store(siteId != cInvalidSiteId ? siteId + 1 : cInvalidSiteId, std::memory_order_release);
+					return siteId;
+				}
+
+				if (key == &site)
+				{
+					// Another thread is declaring the site right now
+					uint32_t value = 0;
+					while ((value = mSiteIds[slot].load(std::memory_order_acquire)) == 0)
+					{
+						std::this_thread::yield();
+					}
+					return value != cInvalidSiteId ? value - 1 : cInvalidSiteId;
+				}
+			}
+			return cInvalidSiteId;
+		}
+
+		uint32_t DeclareSite(const LogSite& site, const LogArgsLayout& layout)
+		{
+			const uint32_t siteId = mSiteCount.fetch_add(1, std::memory_order_relaxed);
+			if (siteId >= mSiteCapacity)
+				return cInvalidSiteId;
+
+			FlightRecordSite& entry = mSites[siteId];
+			entry.Line = site.Line;
+			entry.Level = static_cast<uint8_t>(site.Level);
+			entry.ArgCount = static_cast<uint8_t>(std::min<uint32_t>(layout.Count, UINT8_MAX));
+			std::copy_n(layout.Types, std::min<size_t>(layout.Count, cFlightRecordMaxArgs), entry.ArgTypes);
+			entry.Category = StoreString(site.Category);
+			entry.Format = StoreString(site.Format);
+			entry.File = StoreString(site.File);
+			entry.IsReady.store(1, std::memory_order_release);
+			return siteId;
+		}
+
+		void DeclareEventType(uint32_t eventTypeId)
+		{
+			FlightRecordEventType& entry = mEventTypes[eventTypeId];
+			uint32_t expected = 0;
+			if (!entry.State.compare_exchange_strong(expected, 1, std::memory_order_acq_rel))
+				return;
+
+			entry.Name = StoreString(EventTypeRegistry::GetName(static_cast<EventTypeId>(eventTypeId)));
+			entry.State.store(2, std::memory_order_release);
+		}
+
+		// @brief Copies "text" into the string area, an empty string once the area is full.
+		FlightRecordString StoreString(std::string_view text)
+		{
+			const auto length = static_cast<uint32_t>(text.size());
+			const uint32_t offset = mHeader->StringSize.fetch_add(length, std::memory_order_relaxed);
+			if (uint64_t{ offset } + length > mHeader->StringCapacity)
+				return FlightRecordString{ 0, 0 };
+
+			std::memcpy(mStrings + offset, text.data(), length);
+			return FlightRecordString{ offset, length };
+		}
+
+		// @brief Keeps the region of the previous run as "FlightRecorder.previous.gjfr", dumps it if that run crashed or was killed.
+		void RotatePreviousRegion(const std::filesystem::path& regionPath)
+		{
+			std::error_code error;
+			if (!std::filesystem::exists(regionPath, error))
+				return;
+
+			{
+				MappedFile previousRegion;
+				if (previousRegion.Open(regionPath, MappedFile::Access::ReadOnly) && previousRegion.GetSize() >= sizeof(FlightRecordHeader))
+				{
+					const auto* header = reinterpret_cast<const FlightRecordHeader*>(previousRegion.GetData());
+					const FlightRecordState state = header->State.load(std::memory_order_acquire);
+					if (state != FlightRecordState::ShutDown)
+					{
+						const std::string_view crashReason(header->CrashReason, std::ranges::find(header->CrashReason, '\0') - std::begin(header->CrashReason));
+						const std::string reason = std::format("PreviousRun-{}", state == FlightRecordState::Crashed ? crashReason : "Unterminated");
+						WriteDump(std::span<const std::byte>(previousRegion.GetData(), previousRegion.GetSize()), reason);
+					}
+				}
+			}
+
+			std::filesystem::rename(regionPath, mDirectory / std::format("{}{}", cPreviousRegionName, cFlightRecordExtension), error);
+		}
+
+		std::filesystem::path WriteDump(std::span<const std::byte> region, std::string_view reason)
+		{
+			std::string text;
+			if (!FormatFlightRecord(region, reason, text))
+				return {};
+
+			std::string safeReason;
+			for (char character : reason)
+			{
+				safeReason.push_back(std::isalnum(static_cast<unsigned char>(character)) ? character : '_');
+			}
+
+			const auto timestamp = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+			const std::filesystem::path path = mDirectory / std::format("FlightRecord_{:%Y%m%d-%H%M%S}_{}_{}.txt", timestamp, safeReason, mDumpCount++);
+
+			std::ofstream file(path, std::ios::trunc);
+			if (!file.is_open())
+				return {};
+
+			file.write(text.data(), static_cast<std::streamsize>(text.size()));
+			return path;
+		}
+
+		void InstallCrashHandlers()
+		{
+			for (size_t i = 0; i < std::size(cCrashSignals); ++i)
+			{
+				sPreviousSignalHandlers[i] = std::signal(cCrashSignals[i], &HandleCrashSignal);
+			}
+#ifdef _WIN32
+			sPreviousExceptionFilter = SetUnhandledExceptionFilter(&HandleUnhandledException);
+#endif
+			mCrashHandlersInstalled = true;
+		}
+
+		void UninstallCrashHandlers()
+		{
+			for (size_t i = 0; i < std::size(cCrashSignals); ++i)
+			{
+				std::signal(cCrashSignals[i], sPreviousSignalHandlers[i] != SIG_ERR ? sPreviousSignalHandlers[i] : SIG_DFL);
+			}
+#ifdef _WIN32
+			SetUnhandledExceptionFilter(sPreviousExceptionFilter);
+#endif
+			mCrashHandlersInstalled = false;
+		}
+
+	private:
+		std::filesystem::path mDirectory;
+		const uint32_t mRecordsPerRing;
+		const uint32_t mRingCount;
+		const uint32_t mSiteCapacity;
+		const uint32_t mEventTypeCapacity;
+		const std::chrono::steady_clock::duration mHitchThreshold;
+		const uint64_t mGeneration;
+
+		MappedFile mMappedRegion;
+		std::unique_ptr<FlightRecord[]> mHeapRegion;		// Fallback when the region file cannot be mapped
+		std::byte* mRegion{ nullptr };
+		size_t mRegionSize{ 0 };
+		FlightRecordHeader* mHeader{ nullptr };
+		FlightRecordRing* mRings{ nullptr };
+		FlightRecord* mRecords{ nullptr };
+		FlightRecordSite* mSites{ nullptr };
+		FlightRecordEventType* mEventTypes{ nullptr };
+		char* mStrings{ nullptr };
+
+		// Site address -> id + 1 (0 while being declared), the ids index the site table of the region
+		std::unique_ptr<std::atomic<const LogSite*>[]> mSiteKeys;
+		std::unique_ptr<std::atomic<uint32_t>[]> mSiteIds;
+		size_t mSiteSlotMask{ 0 };
+		std::atomic<uint32_t> mSiteCount{ 0 };
+
+		std::chrono::steady_clock::time_point mLastFrameStart;	// Main thread only
+		bool mIsIdleFrame{ false };							// Main thread only
+		uint32_t mHitchDumpCount{ 0 };
+
+		std::atomic<bool> mDumping{ false };
+		uint32_t mDumpCount{ 0 };							// Guarded by mDumping, or the constructor
+		bool mCrashHandlersInstalled{ false };
+	};
+
+	// ====================================================================================================
+	// FlightRecorder Public API
+	// ====================================================================================================
+
+	FlightRecorder::FlightRecorder(const FlightRecorderSettings& settings)
+		: pImpl(std::make_unique<Impl>(settings))
+	{
+	}
+
+	FlightRecorder::~FlightRecorder() = default;
+
+	void FlightRecorder::RecordLog(const LogSite& site, const LogArgsLayout& layout, size_t argumentsSize, LogArgsWriter writer, const void* context)
+	{
+		pImpl->RecordLog(site, layout, argumentsSize, writer, context);
+	}
+
+	void FlightRecorder::RecordEvent(uint32_t eventTypeId, uint32_t depth)
+	{
+		pImpl->RecordEvent(eventTypeId, depth);
+	}
+
+	void FlightRecorder::MarkFrame()
+	{
+		pImpl->MarkFrame();
+	}
+
+	void FlightRecorder::MarkIdleFrame()
+	{
+		pImpl->MarkIdleFrame();
+	}
+
+	void FlightRecorder::MarkCrashed(std::string_view reason)
+	{
+		pImpl->MarkCrashed(reason);
+	}
+
+	std::filesystem::path FlightRecorder::Dump(std::string_view reason)
+	{
+		return pImpl->Dump(reason);
+	}
+
+	uint64_t FlightRecorder::GetFrameIndex() const
+	{
+		return pImpl->GetFrameIndex();
+	}
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Managers/Manager.h"
+#include "Managers/FlightRecorder/FlightRecordFormat.h"
+#include "Managers/LogManager/LogSite.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Flight Recorder Settings
+	// ====================================================================================================
+
+	struct FlightRecorderSettings
+	{
+		std::filesystem::path Directory{ "FlightRecords" };	// Holds the shared ring region and the dumps
+		uint32_t RecordsPerThread{ 2048 };						// Rounded up to a power of two
+		uint32_t MaxThreads{ 32 };								// Threads beyond this are not recorded
+		uint32_t SiteCapacity{ 4096 };							// Distinct log call sites, later ones are recorded without their site
+		uint32_t EventTypeCapacity{ 1024 };					// Event types recorded with their name
+		uint32_t StringCapacity{ 1024 * 1024 };				// Bytes for the categories, formats, files and event names
+		uint32_t HitchThresholdMs{ 0 };						// Frames longer than this are dumped, 0 disables
+		bool InstallCrashHandlers{ true };						// Mark the region on fatal signals and unhandled exceptions
+	};
+
+	// ====================================================================================================
+	// Flight Recorder Interface
+	// ====================================================================================================
+
+	/**
+	 * @brief Always-on history of the last log records, dispatched events and frames of every thread.
+	 *
+	 * Each thread owns a lock-free ring of fixed-size records inside one region mapped from
+	 * "Directory/FlightRecorder.gjfr", so the raw history also reaches the disk if the process dies
+	 * without running any handler. Recording is a thread-local lookup, a cycle counter read and a
+	 * 128-byte store: log arguments are kept in their captured binary form, sites and event types are
+	 * stored once in tables of the same region (see FlightRecordFormat.h).
+	 *
+	 * Dump() writes a readable, time-sorted text file. It is called on GOJO_LOG_FATAL, on assertion
+	 * failures (GOJO_LOG_ASSERT), on hitches and on demand. Crash handlers only mark the region:
+	 * StartUp keeps the region of the previous run as "FlightRecorder.previous.gjfr" and dumps it if
+	 * that run crashed or never shut down. The FlightRecordDecoder tool decodes any region file.
+	 */
+	class GOJO_API FlightRecorder final : public Manager<FlightRecorder>
+	{
+		friend class Manager<FlightRecorder>;
+
+	public:
+		// @brief Records a log call (same arguments as LogManager::SubmitRecord).
+		//        Arguments that do not fit in a record are dropped, the site is kept.
+		void RecordLog(const LogSite& site, const LogArgsLayout& layout, size_t argumentsSize, LogArgsWriter writer, const void* context);
+
+		// @brief Records a dispatched event. "depth" is the dispatch nesting level (0 for queued events).
+		void RecordEvent(uint32_t eventTypeId, uint32_t depth);
+
+		// @brief Marks the start of a frame, checks the previous frame against the hitch threshold.
+		void MarkFrame();
+
+		// @brief The current frame waits on purpose (idle, blocked on window events), it is not checked for a hitch.
+		void MarkIdleFrame();
+
+		// @brief Marks the region as crashed with "reason" (truncated), the next StartUp writes the dump.
+		//        Async-signal-safe, used by the crash handlers.
+		void MarkCrashed(std::string_view reason);
+
+		// @brief Writes the content of every ring to "Directory/FlightRecord_<time>_<reason>.txt".
+		//        Thread-safe, concurrent and re-entrant calls (a crash inside a dump) are ignored.
+		// @return The path of the dump, empty if nothing was written.
+		std::filesystem::path Dump(std::string_view reason);
+
+		[[nodiscard]] uint64_t GetFrameIndex() const;
+
+	private:
+		explicit FlightRecorder(const FlightRecorderSettings& settings = {});
+		~FlightRecorder();
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+	};
+}
@@ -0,0 +1,503 @@
+#include "Managers/JobSystem/JobSystem.h"
+#include "Managers/LogManager/LogManager.h"
+#include "Core/Containers/WorkStealingDeque.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiler/Profiler.h"
+
+#include <deque>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#endif
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		constexpr uint32_t cJobBlockSize = 256;
+		constexpr uint32_t cIdleSpinCount = 64;			// Failed searches before a worker goes to sleep
+		constexpr uint32_t cParallelForBatchesPerThread = 4;
+
+		struct JobPool;
+
+		struct alignas(cCacheLineSize) Job
+		{
+			JobFunction Function;
+			JobCounter* Counter{ nullptr };
+			Job* Next{ nullptr };						// Free list or continuation list
+			JobPool* Owner{ nullptr };					// nullptr for jobs started outside the job system threads
+
+			// Pool blocks and foreign-thread jobs are accounted to MemoryTag::Jobs
+			static void* operator new(size_t size, std::align_val_t alignment) { return MemoryTracker::Allocate(size, static_cast<size_t>(alignment), GOJO_MEMORY_SITE(MemoryTag::Jobs)); }
+			static void* operator new[](size_t size, std::align_val_t alignment) { return MemoryTracker::Allocate(size, static_cast<size_t>(alignment), GOJO_MEMORY_SITE(MemoryTag::Jobs)); }
+			static void operator delete(void* memory, std::align_val_t) noexcept { MemoryTracker::Free(memory); }
+			static void operator delete[](void* memory, std::align_val_t) noexcept { MemoryTracker::Free(memory); }
+		};
+
+		/**
+		 * @brief Job storage of one thread. The owner allocates and frees without atomics, jobs finished on
+		 * other threads come back through a lock-free stack the owner empties as a whole (no ABA).
+		 */
+		struct JobPool
+		{
+			Job* Allocate()
+			{
+				if (!LocalFree)
+				{
+					LocalFree = RemoteFree.exchange(nullptr, std::memory_order_acquire);
+				}
+
+				if (!LocalFree)
+				{
+					Blocks.push_back(std::make_unique<Job[]>(cJobBlockSize));
+					Job* block = Blocks.back().get();
+					for (uint32_t index = 0; index < cJobBlockSize; ++index)
+					{
+						block[index].Owner = this;
+						block[index].Next = index + 1 < cJobBlockSize ? &block[index + 1] : nullptr;
+					}
+					LocalFree = block;
+				}
+
+				Job* job = LocalFree;
+				LocalFree = job->Next;
+				job->Next = nullptr;
+				return job;
+			}
+
+			void FreeLocal(Job* job)
+			{
+				job->Next = LocalFree;
+				LocalFree = job;
+			}
+
+			void FreeRemote(Job* job)
+			{
+				Job* head = RemoteFree.load(std::memory_order_relaxed);
+				do
+				{
+					job->Next = head;
+				} while (!RemoteFree.compare_exchange_weak(head, job, std::memory_order_release, std::memory_order_relaxed));
+			}
+
+			Job* LocalFree{ nullptr };
+			std::atomic<Job*> RemoteFree{ nullptr };
+			std::vector<std::unique_ptr<Job[]>> Blocks;
+		};
+
+		struct alignas(cCacheLineSize) ThreadContext
+		{
+			ThreadContext(uint32_t index, size_t queueCapacity)
+				: Queue(queueCapacity), Index(index), RandomState(index * 0x9E3779B9u + 1)
+			{
+			}
+
+			WorkStealingDeque<Job*> Queue;
+			JobPool Pool;
+			uint32_t Index;
+			uint32_t RandomState;						// Picks the first steal victim
+		};
+
+		thread_local ThreadContext* tThreadContext = nullptr;
+
+		uint32_t NextRandom(uint32_t& state)
+		{
+			// xorshift32
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return state;
+		}
+
+		void CpuPause()
+		{
+#if defined(_M_X64) || defined(__x86_64__)
+			_mm_pause();
+#else
+			std::this_thread::yield();
+#endif
+		}
+
+		void SetCurrentThreadName(uint32_t workerIndex)
+		{
+			Profiler::SetThreadName("Gojo Worker " + std::to_string(workerIndex));
+
+#ifdef _WIN32
+			const std::wstring name = L"Gojo Worker " + std::to_wstring(workerIndex);
+			SetThreadDescription(GetCurrentThread(), name.c_str());
+#else
+			(void)workerIndex;
+#endif
+		}
+	}
+
+	// ====================================================================================================
+	// JobSystem Implementation (PIMPL)
+	// ====================================================================================================
+
+	class JobSystem::Impl
+	{
+	public:
+		explicit Impl(const JobSystemSettings& settings)
+		{
+			const uint32_t coreCount = std::max(std::thread::hardware_concurrency(), 2u);
+			const uint32_t workerCount = settings.WorkerCount > 0 ? settings.WorkerCount : coreCount - 1;
+
+			// Context 0 belongs to the thread that starts the system, it runs jobs while it waits
+			mContexts.reserve(workerCount + 1);
+			for (uint32_t index = 0; index <= workerCount; ++index)
+			{
+				mContexts.push_back(std::make_unique<ThreadContext>(index, settings.InitialQueueCapacity));
+			}
+			tThreadContext = mContexts[0].get();
+
+			mWorkers.reserve(workerCount);
+			for (uint32_t index = 1; index <= workerCount; ++index)
+			{
+				mWorkers.emplace_back([this, index]() { WorkerLoop(*mContexts[index]); });
+			}
+		}
+
+		~Impl()
+		{
+			mIsRunning.store(false, std::memory_order_release);
+			mWorkEpoch.fetch_add(1, std::memory_order_seq_cst);
+			mWorkEpoch.notify_all();
+
+			for (std::thread& worker : mWorkers)
+			{
+				worker.join();
+			}
+
+			if (tThreadContext == mContexts[0].get())
+			{
+				tThreadContext = nullptr;
+			}
+
+			// Jobs from outside the job system threads are the only heap-allocated ones
+			for (Job* job : mSharedJobs)
+			{
+				if (!job->Owner)
+				{
+					delete job;
+				}
+			}
+		}
+
+		void Run(JobFunction&& function, JobCounter* counter)
+		{
+			Schedule(CreateJob(std::move(function), counter));
+		}
+
+		void RunAfter(JobCounter& dependency, JobFunction&& function, JobCounter* counter)
+		{
+			Job* job = CreateJob(std::move(function), counter);
+
+			LockCounter(dependency);
+			const bool isDependencyDone = dependency.mValue.load(std::memory_order_acquire) == 0;
+			if (!isDependencyDone)
+			{
+				job->Next = static_cast<Job*>(dependency.mContinuations);
+				dependency.mContinuations = job;
+			}
+			UnlockCounter(dependency);
+
+			if (isDependencyDone)
+			{
+				Schedule(job);
+			}
+		}
+
+		void Wait(const JobCounter& counter)
+		{
+			ThreadContext* context = tThreadContext;
+			uint32_t randomState = context ? context->RandomState : static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+
+			uint32_t idleCount = 0;
+			while (!counter.IsDone())
+			{
+				if (Job* job = FindJob(context, randomState))
+				{
+					Execute(job);
+					idleCount = 0;
+				}
+				else if (++idleCount < cIdleSpinCount)
+				{
+					CpuPause();
+				}
+				else
+				{
+					// The remaining jobs run elsewhere, give their threads the core
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		[[nodiscard]] uint32_t GetWorkerCount() const { return static_cast<uint32_t>(mWorkers.size()); }
+
+	private:
+		Job* CreateJob(JobFunction&& function, JobCounter* counter)
+		{
+			Job* job = tThreadContext ? tThreadContext->Pool.Allocate() : new Job();
+			job->Function = std::move(function);
+			job->Counter = counter;
+
+			if (counter)
+			{
+				counter->mValue.fetch_add(1, std::memory_order_relaxed);
+			}
+			return job;
+		}
+
+		void Schedule(Job* job)
+		{
+			if (ThreadContext* context = tThreadContext)
+			{
+				context->Queue.Push(job);
+			}
+			else
+			{
+				std::lock_guard lock(mSharedJobsMutex);
+				mSharedJobs.push_back(job);
+				mSharedJobCount.fetch_add(1, std::memory_order_release);
+			}
+
+			// A sleeping worker registers itself before its last search, so it either finds the job or sees the new epoch
+			mWorkEpoch.fetch_add(1, std::memory_order_seq_cst);
+			if (mSleepingWorkerCount.load(std::memory_order_seq_cst) > 0)
+			{
+				mWorkEpoch.notify_one();
+			}
+		}
+
+		Job* FindJob(ThreadContext* context, uint32_t& randomState)
+		{
+			if (context)
+			{
+				if (Job* job = context->Queue.Pop())
+					return job;
+			}
+
+			if (mSharedJobCount.load(std::memory_order_acquire) > 0)
+			{
+				std::lock_guard lock(mSharedJobsMutex);
+				if (!mSharedJobs.empty())
+				{
+					Job* job = mSharedJobs.front();
+					mSharedJobs.pop_front();
+					mSharedJobCount.fetch_sub(1, std::memory_order_relaxed);
+					return job;
+				}
+			}
+
+			const size_t contextCount = mContexts.size();
+			const size_t firstVictim = NextRandom(randomState) % contextCount;
+			for (size_t offset = 0; offset < contextCount; ++offset)
+			{
+				ThreadContext& victim = *mContexts[(firstVictim + offset) % contextCount];
+				if (&victim == context)
+					continue;
+
+				if (Job* job = victim.Queue.Steal())
+					return job;
+			}
+
+			return nullptr;
+		}
+
+		void Execute(Job* job)
+		{
+			{
+				GOJO_PROFILE_SCOPE("Job");
+				job->Function();
+			}
+
+			JobCounter* counter = job->Counter;
+			FreeJob(job);
+
+			if (counter)
+			{
+				FinishCounterJob(*counter);
+			}
+		}
+
+		void FinishCounterJob(JobCounter& counter)
+		{
+			// Not the last job: a plain decrement, the counter cannot reach zero here
+			uint32_t value = counter.mValue.load(std::memory_order_relaxed);
+			while (value > 1)
+			{
+				if (counter.mValue.compare_exchange_weak(value, value - 1, std::memory_order_release, std::memory_order_relaxed))
+					return;
+			}
+
+			// Possibly the last job: decrement and take the continuations under the lock
+			LockCounter(counter);
+			Job* continuations = nullptr;
+			if (counter.mValue.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				continuations = static_cast<Job*>(counter.mContinuations);
+				counter.mContinuations = nullptr;
+			}
+			UnlockCounter(counter);
+
+			while (continuations)
+			{
+				Job* next = continuations->Next;
+				continuations->Next = nullptr;
+				Schedule(continuations);
+				continuations = next;
+			}
+		}
+
+		static void LockCounter(JobCounter& counter)
+		{
+			while (counter.mIsLocked.exchange(true, std::memory_order_acquire))
+			{
+				while (counter.mIsLocked.load(std::memory_order_relaxed))
+				{
+					CpuPause();
+				}
+			}
+		}
+
+		static void UnlockCounter(JobCounter& counter)
+		{
+			counter.mIsLocked.store(false, std::memory_order_release);
+		}
+
+		void FreeJob(Job* job)
+		{
+			job->Function.Reset();
+			job->Counter = nullptr;
+
+			if (!job->Owner)
+			{
+				delete job;
+			}
+			else if (tThreadContext && &tThreadContext->Pool == job->Owner)
+			{
+				job->Owner->FreeLocal(job);
+			}
+			else
+			{
+				job->Owner->FreeRemote(job);
+			}
+		}
+
+		void WorkerLoop(ThreadContext& context)
+		{
+			tThreadContext = &context;
+			SetCurrentThreadName(context.Index);
+
+			uint32_t idleCount = 0;
+			while (mIsRunning.load(std::memory_order_acquire))
+			{
+				if (Job* job = FindJob(&context, context.RandomState))
+				{
+					Execute(job);
+					idleCount = 0;
+					continue;
+				}
+
+				if (++idleCount < cIdleSpinCount)
+				{
+					CpuPause();
+					continue;
+				}
+
+				mSleepingWorkerCount.fetch_add(1, std::memory_order_seq_cst);
+				const uint32_t epoch = mWorkEpoch.load(std::memory_order_seq_cst);
+				if (Job* job = FindJob(&context, context.RandomState))
+				{
+					mSleepingWorkerCount.fetch_sub(1, std::memory_order_relaxed);
+					Execute(job);
+				}
+				else
+				{
+					if (mIsRunning.load(std::memory_order_acquire))
+					{
+						mWorkEpoch.wait(epoch, std::memory_order_seq_cst);
+					}
+					mSleepingWorkerCount.fetch_sub(1, std::memory_order_relaxed);
+				}
+				idleCount = 0;
+			}
+
+			tThreadContext = nullptr;
+		}
+
+	private:
+		std::vector<std::unique_ptr<ThreadContext>> mContexts;
+		std::vector<std::thread> mWorkers;
+
+		std::mutex mSharedJobsMutex;
+		std::deque<Job*> mSharedJobs;						// Jobs started outside the job system threads
+		std::atomic<uint32_t> mSharedJobCount{ 0 };
+
+		alignas(cCacheLineSize) std::atomic<uint32_t> mWorkEpoch{ 0 };
+		std::atomic<uint32_t> mSleepingWorkerCount{ 0 };
+		std::atomic<bool> mIsRunning{ true };
+	};
+
+	// ====================================================================================================
+	// JobSystem
+	// ====================================================================================================
+
+	JobSystem::JobSystem(const JobSystemSettings& settings)
+		: pImpl(std::make_unique<Impl>(settings))
+	{
+		GOJO_LOG_INFO("JobSystem", "Started {} worker threads", pImpl->GetWorkerCount());
+	}
+
+	JobSystem::~JobSystem() = default;
+
+	void JobSystem::Run(JobFunction job, JobCounter* counter)
+	{
+		pImpl->Run(std::move(job), counter);
+	}
+
+	void JobSystem::RunAfter(JobCounter& dependency, JobFunction job, JobCounter* counter)
+	{
+		pImpl->RunAfter(dependency, std::move(job), counter);
+	}
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		pImpl->Wait(counter);
+	}
+
+	uint32_t JobSystem::GetWorkerCount() const
+	{
+		return pImpl->GetWorkerCount();
+	}
+
+	uint32_t JobSystem::GetCurrentThreadIndex()
+	{
+		return tThreadContext ? tThreadContext->Index : 0;
+	}
+
+	uint32_t JobSystem::GetParallelForBatchSize(uint32_t count, uint32_t minBatchSize) const
+	{
+		const uint32_t batchCount = (GetWorkerCount() + 1) * cParallelForBatchesPerThread;
+		return std::max({ minBatchSize, (count + batchCount - 1) / batchCount, 1u });
+	}
+}
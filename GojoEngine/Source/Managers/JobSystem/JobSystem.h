@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Core/Delegate.h"
+#include "Managers/Manager.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Job System Types
+	// ====================================================================================================
+
+	struct JobSystemSettings
+	{
+		uint32_t WorkerCount{ 0 };						// 0 uses one worker per core besides the main thread
+		uint32_t InitialQueueCapacity{ 1024 };			// Per thread, the queues grow on demand
+	};
+
+	using JobFunction = Delegate<void()>;
+
+	/**
+	 * @brief Counts the unfinished jobs started with it; jobs and waits depend on a counter, not on single jobs.
+	 *
+	 * Run() increments the counter, the end of the job decrements it. Must outlive its jobs: wait on it
+	 * before destroying it.
+	 */
+	class JobCounter final : public NonCopyable
+	{
+		friend class JobSystem;
+
+	public:
+		[[nodiscard]] bool IsDone() const
+		{
+			// The lock is released last when the counter reaches zero, a waiter may destroy it right after
+			return mValue.load(std::memory_order_acquire) == 0 && !mIsLocked.load(std::memory_order_acquire);
+		}
+
+		[[nodiscard]] uint32_t GetValue() const { return mValue.load(std::memory_order_relaxed); }
+
+	private:
+		std::atomic<uint32_t> mValue{ 0 };
+		std::atomic<bool> mIsLocked{ false };			// Guards the continuations and the final decrement
+		void* mContinuations{ nullptr };				// Intrusive list of the jobs started by RunAfter()
+	};
+
+	// ====================================================================================================
+	// Job System Interface
+	// ====================================================================================================
+
+	/**
+	 * @brief Work-stealing job scheduler.
+	 *
+	 * Every worker thread (and the thread that started the system) owns a Chase-Lev deque: jobs are
+	 * pushed to and popped from the deque of the running thread, idle workers steal the oldest jobs of
+	 * the others and sleep once there is nothing left to steal. Jobs started from other threads go
+	 * through a shared queue.
+	 *
+	 * Wait() never blocks while jobs are queued: the waiting thread runs jobs itself, so the main thread
+	 * helps instead of idling and a job may wait on the jobs it started without starving the workers.
+	 * Jobs still queued at ShutDown() are dropped, wait on their counters first.
+	 */
+	class GOJO_API JobSystem final : public Manager<JobSystem>
+	{
+		friend class Manager<JobSystem>;
+
+	public:
+		// @brief Queues a job. "counter" (optional) is incremented now and decremented when the job finished.
+		void Run(JobFunction job, JobCounter* counter = nullptr);
+
+		// @brief Queues a job once "dependency" reached zero (immediately if it already did).
+		void RunAfter(JobCounter& dependency, JobFunction job, JobCounter* counter = nullptr);
+
+		// @brief Runs queued jobs until "counter" reached zero.
+		void Wait(const JobCounter& counter);
+
+		/**
+		 * @brief Calls body(index) for every index in [0, count) across all threads and waits for the result.
+		 * @param minBatchSize Smallest number of indices per job, raise it for tiny bodies.
+		 *
+		 * The range is cut into a few batches per thread, which is enough for the stealing to even out
+		 * uneven bodies without paying a job per index.
+		 */
+		template<typename BodyT>
+			requires std::is_invocable_v<BodyT&, uint32_t>
+		void ParallelFor(uint32_t count, BodyT&& body, uint32_t minBatchSize = 1)
+		{
+			if (count == 0)
+				return;
+
+			const uint32_t batchSize = GetParallelForBatchSize(count, minBatchSize);
+			if (batchSize >= count)
+			{
+				for (uint32_t index = 0; index < count; ++index)
+				{
+					body(index);
+				}
+				return;
+			}
+
+			JobCounter counter;
+			for (uint32_t begin = 0; begin < count; begin += batchSize)
+			{
+				const uint32_t end = std::min(count, begin + batchSize);
+				Run([&body, begin, end]()
+					{
+						for (uint32_t index = begin; index < end; ++index)
+						{
+							body(index);
+						}
+					}, &counter);
+			}
+			Wait(counter);
+		}
+
+		// @brief Number of worker threads, the threads that call Wait() come on top.
+		[[nodiscard]] uint32_t GetWorkerCount() const;
+
+		// @brief 0 for threads that are not workers (the main thread included), worker index + 1 otherwise.
+		[[nodiscard]] static uint32_t GetCurrentThreadIndex();
+
+	private:
+		explicit JobSystem(const JobSystemSettings& settings = {});
+		~JobSystem();
+
+		[[nodiscard]] uint32_t GetParallelForBatchSize(uint32_t count, uint32_t minBatchSize) const;
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+	};
+}
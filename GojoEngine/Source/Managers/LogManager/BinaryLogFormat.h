@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Managers/LogManager/LogSite.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Binary Log Format
+	// ====================================================================================================
+
+	/**
+	 * Layout of the segment files written by the binary log sink (host byte order).
+	 *
+	 *     BinaryLogSegmentHeader
+	 *     Records, each starting with a BinaryLogRecordHeader and padded to cBinaryLogRecordAlignment:
+	 *         Site:     BinaryLogSiteRecord | LogArgType[ArgCount] | category | file | format
+	 *         Message:  BinaryLogMessageRecord | captured arguments (see LogSite.h)
+	 *     A zero-sized record header (or the end of the file) terminates the segment.
+	 *
+	 * Every segment is self-contained: a site is declared before its first message in each segment,
+	 * so any segment can be decoded on its own after older ones were rotated away.
+	 */
+	constexpr char cBinaryLogMagic[4] = { 'G', 'J', 'L', 'G' };
+	constexpr uint32_t cBinaryLogVersion = 1;
+	constexpr size_t cBinaryLogRecordAlignment = 8;
+	constexpr const char* cBinaryLogExtension = ".gjlog";
+
+	struct BinaryLogSegmentHeader
+	{
+		char Magic[4];
+		uint32_t Version;
+		uint64_t SegmentIndex;			// Increases by one with every rotation
+		int64_t StartTime;				// Nanoseconds since the Unix epoch
+	};
+
+	enum class BinaryLogRecordType : uint16_t
+	{
+		End = 0,
+		Site = 1,
+		Message = 2
+	};
+
+	struct BinaryLogRecordHeader
+	{
+		uint32_t Size;					// Whole record including this header and the padding
+		BinaryLogRecordType Type;
+		uint16_t Reserved;
+	};
+
+	struct BinaryLogSiteRecord
+	{
+		uint32_t SiteId;				// Unique per process run
+		uint32_t Line;
+		uint8_t Level;					// LogLevel
+		uint8_t ArgCount;
+		uint16_t CategoryLength;		// Empty for runtime categories (LogMessage), the category is then the first argument
+		uint16_t FileLength;
+		uint16_t FormatLength;
+	};
+
+	struct BinaryLogMessageRecord
+	{
+		int64_t Time;					// Nanoseconds since the Unix epoch
+		uint32_t SiteId;
+		uint32_t ArgumentsSize;
+	};
+
+	constexpr size_t AlignBinaryLogRecord(size_t size)
+	{
+		return (size + cBinaryLogRecordAlignment - 1) & ~(cBinaryLogRecordAlignment - 1);
+	}
+}
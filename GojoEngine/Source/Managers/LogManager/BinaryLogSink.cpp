@@ -0,0 +1,225 @@
+#include "Managers/LogManager/BinaryLogSink.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <system_error>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		constexpr std::string_view cSegmentBaseName = "Gojo_";
+		constexpr size_t cSegmentDataOffset = AlignBinaryLogRecord(sizeof(BinaryLogSegmentHeader));
+
+		// @brief Strings of a site record are stored with 16-bit lengths.
+		std::string_view ClampSiteString(std::string_view text)
+		{
+			return text.substr(0, std::min<size_t>(text.size(), UINT16_MAX));
+		}
+
+		size_t GetSiteRecordSize(const LogSite& site, const LogArgsLayout& layout)
+		{
+			return AlignBinaryLogRecord(sizeof(BinaryLogRecordHeader) + sizeof(BinaryLogSiteRecord)
+				+ layout.Count * sizeof(LogArgType)
+				+ ClampSiteString(site.Category).size()
+				+ ClampSiteString(site.File).size()
+				+ ClampSiteString(site.Format).size());
+		}
+
+		std::byte* Append(std::byte* destination, const void* source, size_t size)
+		{
+			if (size > 0)
+			{
+				std::memcpy(destination, source, size);
+			}
+			return destination + size;
+		}
+
+		// @brief Extracts <index> from "Gojo_<index>.gjlog", returns false for other files.
+		bool ParseSegmentIndex(const std::filesystem::path& path, uint64_t& segmentIndex)
+		{
+			if (path.extension() != cBinaryLogExtension)
+				return false;
+
+			const std::string stem = path.stem().string();
+			if (!stem.starts_with(cSegmentBaseName))
+				return false;
+
+			const char* first = stem.data() + cSegmentBaseName.size();
+			const char* last = stem.data() + stem.size();
+			const auto [end, error] = std::from_chars(first, last, segmentIndex);
+			return error == std::errc() && end == last;
+		}
+	}
+
+	// ====================================================================================================
+	// BinaryLogSink
+	// ====================================================================================================
+
+	bool BinaryLogSink::Open(const std::filesystem::path& directory, size_t segmentSize, uint32_t segmentCount)
+	{
+		Close();
+
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+
+		mDirectory = directory;
+		mSegmentSize = std::max(segmentSize, cSegmentDataOffset + 4096);
+		mSegmentCount = std::max(segmentCount, 1u);
+
+		// Continue numbering after the segments of previous runs and drop the ones beyond the budget
+		std::vector<uint64_t> existingSegments;
+		for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+		{
+			uint64_t segmentIndex = 0;
+			if (entry.is_regular_file(error) && ParseSegmentIndex(entry.path(), segmentIndex))
+			{
+				existingSegments.push_back(segmentIndex);
+			}
+		}
+		std::ranges::sort(existingSegments);
+
+		const uint64_t firstIndex = existingSegments.empty() ? 0 : existingSegments.back() + 1;
+		const size_t keptCount = std::min<size_t>(existingSegments.size(), mSegmentCount - 1);
+		for (size_t i = 0; i + keptCount < existingSegments.size(); ++i)
+		{
+			DeleteSegment(existingSegments[i]);
+		}
+
+		const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		return OpenSegment(firstIndex, now);
+	}
+
+	void BinaryLogSink::Close()
+	{
+		std::scoped_lock lock(mMutex);
+		mSegment.Close();
+		mSiteIds.clear();
+		mDeclaredSites.clear();
+	}
+
+	void BinaryLogSink::Write(const LogSite& site, const LogArgsLayout& layout, int64_t time, std::span<const std::byte> arguments)
+	{
+		std::scoped_lock lock(mMutex);
+		if (!mSegment.IsOpen())
+			return;
+
+		const auto [siteIt, isNewSite] = mSiteIds.try_emplace(&site, static_cast<uint32_t>(mSiteIds.size()));
+		const uint32_t siteId = siteIt->second;
+		if (siteId >= mDeclaredSites.size())
+		{
+			mDeclaredSites.resize(static_cast<size_t>(siteId) + 1, false);
+		}
+
+		const size_t siteSize = GetSiteRecordSize(site, layout);
+		const size_t messageSize = AlignBinaryLogRecord(sizeof(BinaryLogRecordHeader) + sizeof(BinaryLogMessageRecord) + arguments.size());
+
+		const size_t requiredSize = messageSize + (mDeclaredSites[siteId] ? 0 : siteSize);
+		if (mOffset + requiredSize > mSegmentSize)
+		{
+			// Even an empty segment would be too small
+			if (cSegmentDataOffset + siteSize + messageSize > mSegmentSize)
+			{
+				++mDroppedCount;
+				return;
+			}
+
+			const uint64_t nextIndex = mSegmentIndex + 1;
+			if (!OpenSegment(nextIndex, time))
+				return;
+
+			if (nextIndex >= mSegmentCount)
+			{
+				DeleteSegment(nextIndex - mSegmentCount);
+			}
+		}
+
+		std::byte* destination = mSegment.GetData() + mOffset;
+
+		if (!mDeclaredSites[siteId])
+		{
+			const std::string_view category = ClampSiteString(site.Category);
+			const std::string_view file = ClampSiteString(site.File);
+			const std::string_view format = ClampSiteString(site.Format);
+
+			const BinaryLogRecordHeader header{ static_cast<uint32_t>(siteSize), BinaryLogRecordType::Site, 0 };
+			const BinaryLogSiteRecord record
+			{
+				siteId,
+				site.Line,
+				static_cast<uint8_t>(site.Level),
+				static_cast<uint8_t>(layout.Count),
+				static_cast<uint16_t>(category.size()),
+				static_cast<uint16_t>(file.size()),
+				static_cast<uint16_t>(format.size())
+			};
+
+			std::byte* cursor = Append(destination, &header, sizeof(header));
+			cursor = Append(cursor, &record, sizeof(record));
+			cursor = Append(cursor, layout.Types, layout.Count * sizeof(LogArgType));
+			cursor = Append(cursor, category.data(), category.size());
+			cursor = Append(cursor, file.data(), file.size());
+			Append(cursor, format.data(), format.size());
+
+			destination += siteSize;
+			mOffset += siteSize;
+			mDeclaredSites[siteId] = true;
+		}
+
+		const BinaryLogRecordHeader header{ static_cast<uint32_t>(messageSize), BinaryLogRecordType::Message, 0 };
+		const BinaryLogMessageRecord record{ time, siteId, static_cast<uint32_t>(arguments.size()) };
+
+		std::byte* cursor = Append(destination, &header, sizeof(header));
+		cursor = Append(cursor, &record, sizeof(record));
+		Append(cursor, arguments.data(), arguments.size());
+
+		mOffset += messageSize;
+	}
+
+	void BinaryLogSink::Flush()
+	{
+		std::scoped_lock lock(mMutex);
+		mSegment.Flush();
+	}
+
+	bool BinaryLogSink::OpenSegment(uint64_t segmentIndex, int64_t time)
+	{
+		// A fresh file is zero filled, which doubles as the end marker of the segment
+		const std::filesystem::path path = GetSegmentPath(segmentIndex);
+		std::error_code error;
+		std::filesystem::remove(path, error);
+
+		mSegment.Close();
+		if (!mSegment.Open(path, MappedFile::Access::ReadWrite, mSegmentSize))
+			return false;
+
+		BinaryLogSegmentHeader header{};
+		std::memcpy(header.Magic, cBinaryLogMagic, sizeof(cBinaryLogMagic));
+		header.Version = cBinaryLogVersion;
+		header.SegmentIndex = segmentIndex;
+		header.StartTime = time;
+		std::memcpy(mSegment.GetData(), &header, sizeof(header));
+
+		mSegmentIndex = segmentIndex;
+		mOffset = cSegmentDataOffset;
+		std::fill(mDeclaredSites.begin(), mDeclaredSites.end(), false);
+		return true;
+	}
+
+	void BinaryLogSink::DeleteSegment(uint64_t segmentIndex) const
+	{
+		std::error_code error;
+		std::filesystem::remove(GetSegmentPath(segmentIndex), error);
+	}
+
+	std::filesystem::path BinaryLogSink::GetSegmentPath(uint64_t segmentIndex) const
+	{
+		return mDirectory / std::format("{}{:06}{}", cSegmentBaseName, segmentIndex, cBinaryLogExtension);
+	}
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Core/MappedFile.h"
+#include "Core/Utility.h"
+#include "Managers/LogManager/BinaryLogFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Binary Log Sink
+	// ====================================================================================================
+
+	/**
+	 * @brief Appends fixed-layout binary records to preallocated, memory-mapped, rotating segment files.
+	 *
+	 * Writing a message is a bounds check plus a memcpy of the already captured arguments into mapped
+	 * pages, nothing is formatted. The OS writes the pages back lazily, so records survive a crash of
+	 * the process. Segments are named "<BaseName>_<index>.gjlog", only the newest "segmentCount" are kept.
+	 * Decode them with the LogDecoder tool.
+	 */
+	class BinaryLogSink final : public NonCopyable
+	{
+	public:
+		bool Open(const std::filesystem::path& directory, size_t segmentSize, uint32_t segmentCount);
+		void Close();
+
+		void Write(const LogSite& site, const LogArgsLayout& layout, int64_t time, std::span<const std::byte> arguments);
+		void Flush();
+
+		[[nodiscard]] bool IsOpen() const { return mSegment.IsOpen(); }
+		[[nodiscard]] uint64_t GetDroppedRecordCount() const { return mDroppedCount; }
+
+	private:
+		bool OpenSegment(uint64_t segmentIndex, int64_t time);
+		void DeleteSegment(uint64_t segmentIndex) const;
+		[[nodiscard]] std::filesystem::path GetSegmentPath(uint64_t segmentIndex) const;
+
+	private:
+		std::mutex mMutex;											// Synchronous logging writes from several threads
+		MappedFile mSegment;
+		std::filesystem::path mDirectory;
+		size_t mSegmentSize{ 0 };
+		uint32_t mSegmentCount{ 0 };
+		uint64_t mSegmentIndex{ 0 };
+		size_t mOffset{ 0 };
+
+		std::unordered_map<const LogSite*, uint32_t> mSiteIds;		// Stable for the whole run
+		std::vector<bool> mDeclaredSites;							// Indexed by site id, reset on rotation
+		uint64_t mDroppedCount{ 0 };
+	};
+}
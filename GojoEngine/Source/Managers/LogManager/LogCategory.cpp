@@ -0,0 +1,159 @@
+#include "Managers/LogManager/LogCategory.h"
+#include "Managers/LogManager/LogManager.h"
+
+#include <algorithm>
+#include <cctype>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		struct LogCategoryRegistryData
+		{
+			std::mutex Mutex;
+			std::deque<std::string> Names;										// References are stable
+			std::deque<LogCategory> Categories;									// Index == LogCategoryId
+			std::unordered_map<std::string_view, LogCategory*> Lookup;			// Keys point into "Names"
+			std::unordered_map<std::string, LogLevel> ConfiguredLevels;			// Explicit "Name=Level" entries
+			LogLevel DefaultLevel{ MIN_LOG_LEVEL };
+		};
+
+		LogCategoryRegistryData& GetRegistryData()
+		{
+			static LogCategoryRegistryData data;
+			return data;
+		}
+
+		std::string_view Trim(std::string_view text)
+		{
+			while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) text.remove_prefix(1);
+			while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) text.remove_suffix(1);
+			return text;
+		}
+	}
+
+	// ====================================================================================================
+	// LogCategory
+	// ====================================================================================================
+
+	LogCategory& LogCategory::Get(std::string_view name)
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		if (auto it = data.Lookup.find(name); it != data.Lookup.end())
+		{
+			return *it->second;
+		}
+
+		GOJO_RUNTIME_ASSERT(data.Categories.size() < UINT16_MAX, "Too many log categories!");
+
+		const std::string& storedName = data.Names.emplace_back(name);
+		auto configured = data.ConfiguredLevels.find(storedName);
+		const LogLevel level = configured != data.ConfiguredLevels.end() ? configured->second : data.DefaultLevel;
+
+		LogCategory& category = data.Categories.emplace_back(storedName, static_cast<LogCategoryId>(data.Categories.size()), level);
+		data.Lookup.emplace(storedName, &category);
+		return category;
+	}
+
+	LogCategory* LogCategory::Find(std::string_view name)
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		auto it = data.Lookup.find(name);
+		return it != data.Lookup.end() ? it->second : nullptr;
+	}
+
+	LogCategory* LogCategory::GetById(LogCategoryId id)
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		return id < data.Categories.size() ? &data.Categories[id] : nullptr;
+	}
+
+	LogCategoryId LogCategory::GetCount()
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		return static_cast<LogCategoryId>(data.Categories.size());
+	}
+
+	bool LogCategory::Configure(std::string_view specification)
+	{
+		auto& data = GetRegistryData();
+		std::scoped_lock lock(data.Mutex);
+
+		bool isValid = true;
+		while (!specification.empty())
+		{
+			const size_t separator = specification.find(',');
+			const std::string_view entry = Trim(specification.substr(0, separator));
+			specification = separator == std::string_view::npos ? std::string_view() : specification.substr(separator + 1);
+
+			if (entry.empty())
+				continue;
+
+			const size_t assignment = entry.find('=');
+			const std::string_view name = assignment == std::string_view::npos ? std::string_view("*") : Trim(entry.substr(0, assignment));
+			const std::string_view levelName = assignment == std::string_view::npos ? entry : Trim(entry.substr(assignment + 1));
+
+			LogLevel level{};
+			if (name.empty() || !ParseLevel(levelName, level))
+			{
+				isValid = false;
+				continue;
+			}
+
+			if (name == "*")
+			{
+				data.DefaultLevel = level;
+				for (LogCategory& category : data.Categories)
+				{
+					if (!data.ConfiguredLevels.contains(std::string(category.GetName())))
+					{
+						category.SetLevel(level);
+					}
+				}
+			}
+			else
+			{
+				data.ConfiguredLevels.insert_or_assign(std::string(name), level);
+				if (auto it = data.Lookup.find(name); it != data.Lookup.end())
+				{
+					it->second->SetLevel(level);
+				}
+			}
+		}
+
+		return isValid;
+	}
+
+	bool LogCategory::ParseLevel(std::string_view text, LogLevel& level)
+	{
+		for (size_t index = 0; index < std::size(cLogLevelNames); ++index)
+		{
+			const bool matches = std::ranges::equal(text, cLogLevelNames[index], [](char lhs, char rhs)
+				{
+					return std::tolower(static_cast<unsigned char>(lhs)) == rhs;
+				});
+
+			if (matches)
+			{
+				level = static_cast<LogLevel>(index);
+				return true;
+			}
+		}
+		return false;
+	}
+}
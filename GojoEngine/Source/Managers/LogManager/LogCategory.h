@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Core/Macros.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+namespace GojoEngine
+{
+	enum class LogLevel : uint8_t;
+
+	// @brief Dense id of a log category, in registration order.
+	using LogCategoryId = uint16_t;
+
+	// ====================================================================================================
+	// Log Category
+	// ====================================================================================================
+
+	/**
+	 * @brief A named log category with its own runtime level.
+	 *
+	 * Categories are registered once (GOJO_LOG caches the reference in a per-site static) and live
+	 * until the process exits. The level is a relaxed atomic, so it can be changed from any thread while
+	 * logging and a disabled call costs a single load: the message arguments are never evaluated.
+	 */
+	class GOJO_API LogCategory final
+	{
+	public:
+		LogCategory(std::string_view name, LogCategoryId id, LogLevel level)
+			: mName(name), mId(id), mLevel(level) {}
+
+		LogCategory(const LogCategory&) = delete;
+		LogCategory& operator=(const LogCategory&) = delete;
+
+		// @brief Returns the category called "name", registering it on first use. Thread-safe.
+		static LogCategory& Get(std::string_view name);
+
+		// @brief Returns the category called "name" or nullptr if it was never registered.
+		static LogCategory* Find(std::string_view name);
+
+		// @brief Returns a category by id or nullptr if the id was never handed out.
+		static LogCategory* GetById(LogCategoryId id);
+
+		// @brief Number of registered categories (ids are 0..count-1).
+		static LogCategoryId GetCount();
+
+		/**
+		 * @brief Applies a level specification such as "Info,Vulkan=Trace,WindowManager=Off".
+		 * A bare level (or "*=Level") sets the default of every category without an explicit level,
+		 * "Name=Level" applies to that category, also if it is registered later.
+		 * @return False if part of the specification could not be parsed (valid parts are still applied).
+		 */
+		static bool Configure(std::string_view specification);
+
+		// @brief Parses a level name (case-insensitive), returns false for unknown names.
+		static bool ParseLevel(std::string_view text, LogLevel& level);
+
+		[[nodiscard]] bool IsEnabled(LogLevel level) const { return level >= mLevel.load(std::memory_order_relaxed); }
+
+		void SetLevel(LogLevel level) { mLevel.store(level, std::memory_order_relaxed); }
+		[[nodiscard]] LogLevel GetLevel() const { return mLevel.load(std::memory_order_relaxed); }
+
+		[[nodiscard]] std::string_view GetName() const { return mName; }
+		[[nodiscard]] LogCategoryId GetId() const { return mId; }
+
+	private:
+		std::string_view mName;					// Owned by the registry
+		LogCategoryId mId;
+		std::atomic<LogLevel> mLevel;
+	};
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Managers/LogManager/LogSite.h"
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Log Limiters
+	// ====================================================================================================
+
+	// @brief Coarse monotonic time used by the limiters.
+	inline int64_t GetLogLimiterTime()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/**
+	 * @brief Per call site rate limiter used by GOJO_LOG_RATE_LIMITED.
+	 *
+	 * Lets at most "maxPerSecond" messages through per one second window, the rest only bump a counter.
+	 * The first message of the next window reports how many were suppressed. Windows are reset with a CAS,
+	 * concurrent callers at a window boundary may let a message or two more through, which is fine for logging.
+	 */
+	class LogRateLimiter final
+	{
+	public:
+		constexpr explicit LogRateLimiter(uint32_t maxPerSecond)
+			: mMaxPerWindow(maxPerSecond) {}
+
+		// @param suppressedCount Receives the number of messages suppressed since the last one let through.
+		// @return True if the message should be logged.
+		bool TryAcquire(uint64_t& suppressedCount)
+		{
+			const int64_t now = GetLogLimiterTime();
+			int64_t windowStart = mWindowStart.load(std::memory_order_relaxed);
+			if (now - windowStart >= cWindowLength && mWindowStart.compare_exchange_strong(windowStart, now, std::memory_order_relaxed))
+			{
+				mCount.store(0, std::memory_order_relaxed);
+			}
+
+			if (mCount.fetch_add(1, std::memory_order_relaxed) >= mMaxPerWindow)
+			{
+				mSuppressedCount.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			suppressedCount = mSuppressedCount.exchange(0, std::memory_order_relaxed);
+			return true;
+		}
+
+	private:
+		static constexpr int64_t cWindowLength = 1000;		// Milliseconds
+
+		const uint32_t mMaxPerWindow;
+		std::atomic<int64_t> mWindowStart{ INT64_MIN / 2 };	// The first call always opens a window
+		std::atomic<uint32_t> mCount{ 0 };
+		std::atomic<uint64_t> mSuppressedCount{ 0 };
+	};
+
+	class LogDeduplicator;
+
+	// @brief Adds "deduplicator" to the list walked by LogManager::ReportPendingRepeats. Called once per deduplicator.
+	GOJO_API void RegisterLogDeduplicator(LogDeduplicator& deduplicator);
+
+	/**
+	 * @brief Per call site deduplicator used by GOJO_LOG_DEDUP.
+	 *
+	 * Messages are compared by a hash of their arguments (see HashLogArgs), nothing is formatted.
+	 * A repeat of the previous message is suppressed unless "interval" elapsed since it was last logged,
+	 * the next message let through reports the number of repeats. A burst that is never followed by another
+	 * message is reported by LogManager::ReportPendingRepeats, which ShutDown calls as well.
+	 */
+	class LogDeduplicator final
+	{
+	public:
+		constexpr explicit LogDeduplicator(int64_t intervalMilliseconds = 1000)
+			: mInterval(intervalMilliseconds) {}
+
+		// @param repeatCount Receives the number of suppressed repeats of the previously logged message.
+		// @return True if the message should be logged.
+		bool Check(const LogSite& site, uint64_t hash, uint64_t& repeatCount)
+		{
+			const int64_t now = GetLogLimiterTime();
+			if (mLastHash.load(std::memory_order_relaxed) == hash && now - mLastLogTime.load(std::memory_order_relaxed) < mInterval)
+			{
+				// The first suppressed repeat makes the site known to ReportPendingRepeats
+				if (mRepeatCount.fetch_add(1, std::memory_order_relaxed) == 0 && !mSite.load(std::memory_order_relaxed))
+				{
+					const LogSite* expected = nullptr;
+					if (mSite.compare_exchange_strong(expected, &site, std::memory_order_acq_rel))
+					{
+						RegisterLogDeduplicator(*this);
+					}
+				}
+				return false;
+			}
+
+			mLastHash.store(hash, std::memory_order_relaxed);
+			mLastLogTime.store(now, std::memory_order_relaxed);
+			repeatCount = mRepeatCount.exchange(0, std::memory_order_relaxed);
+			return true;
+		}
+
+		// @brief Takes the repeats suppressed since the last message let through.
+		// @return The site they belong to, nullptr if the deduplicator never suppressed anything.
+		const LogSite* TakeRepeats(uint64_t& repeatCount)
+		{
+			repeatCount = mRepeatCount.exchange(0, std::memory_order_relaxed);
+			return mSite.load(std::memory_order_acquire);
+		}
+
+		[[nodiscard]] LogDeduplicator* GetNext() const { return mNext; }
+		void SetNext(LogDeduplicator* next) { mNext = next; }
+
+	private:
+		const int64_t mInterval;
+		std::atomic<uint64_t> mLastHash{ 0 };
+		std::atomic<int64_t> mLastLogTime{ INT64_MIN / 2 };
+		std::atomic<uint64_t> mRepeatCount{ 0 };
+
+		std::atomic<const LogSite*> mSite{ nullptr };		// Set on the first suppressed repeat
+		LogDeduplicator* mNext{ nullptr };					// Registered deduplicators, written once before publishing
+	};
+
+	// ====================================================================================================
+	// Argument Hashing
+	// ====================================================================================================
+
+	inline void HashLogBytes(uint64_t& hash, const void* data, size_t size)
+	{
+		// FNV-1a
+		const auto* bytes = static_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+		}
+	}
+
+	template<typename T>
+	void HashLogArg(uint64_t& hash, const T& value)
+	{
+		using DecayedT = std::decay_t<T>;
+
+		if constexpr (GetLogArgType<DecayedT>() != LogArgType::String)
+		{
+			const auto captured = CaptureLogArg(value);
+			HashLogBytes(hash, &captured, sizeof(captured));
+		}
+		else if constexpr (LogStringArg<DecayedT>)
+		{
+			const std::string_view text = CaptureLogArg(value);
+			HashLogBytes(hash, text.data(), text.size());
+		}
+		else if constexpr (requires { { std::hash<DecayedT>{}(value) } -> std::convertible_to<size_t>; })
+		{
+			const size_t valueHash = std::hash<DecayedT>{}(value);
+			HashLogBytes(hash, &valueHash, sizeof(valueHash));
+		}
+		else
+		{
+			// No cheaper identity, the text that would be logged is compared (CaptureLogArg formats it)
+			const std::string text = CaptureLogArg(value);
+			HashLogBytes(hash, text.data(), text.size());
+		}
+	}
+
+	// @brief Hashes the arguments of a log call. Only types with neither a binary form nor a std::hash are formatted.
+	template<typename... ArgsT>
+	uint64_t HashLogArgs(const ArgsT&... args)
+	{
+		uint64_t hash = 0xCBF29CE484222325ull;
+		(HashLogArg(hash, args), ...);
+		return hash;
+	}
+}
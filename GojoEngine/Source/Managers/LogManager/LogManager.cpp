@@ -1,8 +1,20 @@
 #include "LogManager.h"
+#include "Core/Containers/BoundedQueue.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Metrics/Metrics.h"
+#include "Managers/LogManager/BinaryLogSink.h"
+#include "Managers/FlightRecorder/FlightRecorder.h"
 
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <atomic>
+#include <cstdlib>
+#include <format>
+#include <vector>
+#include <optional>
+#include <thread>
+
 namespace GojoEngine
 {
 	// ====================================================================================================
@@ -26,6 +38,53 @@ namespace GojoEngine
 		}
 
 		constexpr const char* cLogPattern = "[%H:%M:%S.%e] [%^%l%$] %v";
+
+		// @brief Environment variable holding runtime category levels, e.g. "Info,Vulkan=Trace".
+		constexpr const char* cLogLevelsVariable = "GOJO_LOG_LEVELS";
+
+		// @brief One queued log call. Cells are reused, so the argument buffer keeps its capacity.
+		struct LogRecord
+		{
+			spdlog::log_clock::time_point Time;
+			const LogSite* Site{ nullptr };
+			const LogArgsLayout* Layout{ nullptr };
+			std::vector<std::byte> Arguments;
+		};
+
+		// @brief Sites used by LogMessage, the runtime category and message travel as arguments.
+		constexpr LogSite cRuntimeSites[] =
+		{
+			{ {}, LogLevel::Trace,   "[{}] {}", __FILE__, __LINE__ },
+			{ {}, LogLevel::Info,    "[{}] {}", __FILE__, __LINE__ },
+			{ {}, LogLevel::Debug,   "[{}] {}", __FILE__, __LINE__ },
+			{ {}, LogLevel::Warning, "[{}] {}", __FILE__, __LINE__ },
+			{ {}, LogLevel::Error,   "[{}] {}", __FILE__, __LINE__ },
+			{ {}, LogLevel::Fatal,   "[{}] {}", __FILE__, __LINE__ },
+		};
+
+		// @brief Summary sites of GOJO_LOG_RATE_LIMITED and GOJO_LOG_DEDUP, the category travels as the first argument.
+		constexpr std::string_view cSuppressedFormat = "[{}] {} messages suppressed by the rate limit of {}:{}";
+		constexpr std::string_view cRepeatedFormat = "[{}] Previous message repeated {} times at {}:{}";
+
+		constexpr LogSite cSuppressedSites[] =
+		{
+			{ {}, LogLevel::Trace,   cSuppressedFormat, __FILE__, __LINE__ },
+			{ {}, LogLevel::Info,    cSuppressedFormat, __FILE__, __LINE__ },
+			{ {}, LogLevel::Debug,   cSuppressedFormat, __FILE__, __LINE__ },
+			{ {}, LogLevel::Warning, cSuppressedFormat, __FILE__, __LINE__ },
+			{ {}, LogLevel::Error,   cSuppressedFormat, __FILE__, __LINE__ },
+			{ {}, LogLevel::Fatal,   cSuppressedFormat, __FILE__, __LINE__ },
+		};
+
+		constexpr LogSite cRepeatedSites[] =
+		{
+			{ {}, LogLevel::Trace,   cRepeatedFormat, __FILE__, __LINE__ },
+			{ {}, LogLevel::Info,    cRepeatedFormat, __FILE__, __LINE__ },
+			{ {}, LogLevel::Debug,   cRepeatedFormat, __FILE__, __LINE__ },
+			{ {}, LogLevel::Warning, cRepeatedFormat, __FILE__, __LINE__ },
+			{ {}, LogLevel::Error,   cRepeatedFormat, __FILE__, __LINE__ },
+			{ {}, LogLevel::Fatal,   cRepeatedFormat, __FILE__, __LINE__ },
+		};
 	}
 
 	// ====================================================================================================
@@ -35,18 +94,51 @@ namespace GojoEngine
 	class LogManager::Impl
 	{
 	public:
-		Impl()
+		explicit Impl(const LogSettings& settings)
+			: mOverflowPolicy(settings.OverflowPolicy)
+			, mConsoleLevel(settings.ConsoleLevel)
 		{
-			auto consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+			auto consoleSink = std::allocate_shared<spdlog::sinks::stdout_color_sink_mt>(TaggedAllocator<spdlog::sinks::stdout_color_sink_mt, MemoryTag::Log>{});
 			consoleSink->set_pattern(cLogPattern);
 
-			mConsoleLogger = std::make_shared<spdlog::logger>("GojoConsole", consoleSink);
+			mConsoleLogger = std::allocate_shared<spdlog::logger>(TaggedAllocator<spdlog::logger, MemoryTag::Log>{}, "GojoConsole", consoleSink);
 			mConsoleLogger->set_level(spdlog::level::trace);
 			mConsoleLogger->set_pattern(cLogPattern);
+
+			for (size_t level = 0; level < std::size(mRecordCounters); ++level)
+			{
+				mRecordCounters[level] = &MetricsRegistry::GetCounter("gojo_log_records_total", "Log records submitted, by level",
+					std::format("level=\"{}\"", GetLogLevelName(static_cast<LogLevel>(level))));
+			}
+
+			// Opened before the worker starts, failures are reported by LogManager once it can log
+			if (!settings.BinaryLogDirectory.empty())
+			{
+				mHasBinarySink = mBinarySink.Open(settings.BinaryLogDirectory, settings.BinarySegmentSize, settings.BinarySegmentCount);
+			}
+
+			if (settings.Mode == LogMode::Asynchronous)
+			{
+				mRecords.emplace(settings.QueueCapacity);
+				mWorker = std::thread([this]() { WorkerLoop(); });
+			}
 		}
 
 		~Impl()
 		{
+			if (mWorker.joinable())
+			{
+				// The worker drains every queued record before it exits
+				mRunning.store(false, std::memory_order_seq_cst);
+				WakeWorker();
+				mWorker.join();
+
+				// Records pushed by callers that saw the worker running just before it stopped
+				DrainRecords();
+			}
+
+			mBinarySink.Close();
+
 			if (mConsoleLogger)
 			{
 				mConsoleLogger->flush();
@@ -55,42 +147,332 @@ namespace GojoEngine
 			spdlog::shutdown();
 		}
 
-		void LogMessage(std::string_view categoryName, LogLevel level, std::string_view message) const
+		void SubmitRecord(const LogSite& site, const LogArgsLayout& layout, size_t argumentsSize, LogArgsWriter writer, const void* context)
 		{
 			if (!mConsoleLogger) return;
 
-			const auto spdLevel = ToSpdLogLvl(level);
-			mConsoleLogger->log(spdLevel, "[{}] {}", categoryName, message);
+			if (site.Level < LogLevel::Off)
+			{
+				mRecordCounters[static_cast<size_t>(site.Level)]->Add();
+			}
 
-			if (level == LogLevel::Fatal)
+			if (FlightRecorder* recorder = FlightRecorder::GetPtr())
 			{
-				mConsoleLogger->flush();
+				recorder->RecordLog(site, layout, argumentsSize, writer, context);
+			}
+
+			if (mRecords)
+			{
+				PushRecord(site, layout, argumentsSize, writer, context);
+			}
+			else
+			{
+				WriteRecordOnCaller(site, layout, argumentsSize, writer, context);
+			}
+
+			if (site.Level == LogLevel::Fatal)
+			{
+				Flush();
+				if (FlightRecorder* recorder = FlightRecorder::GetPtr())
+				{
+					recorder->Dump("Fatal");
+				}
 #ifdef GOJO_DEBUG_BUILD
 				GojoDebugBreak();
 #endif
 			}
 		}
 
+		void Flush()
+		{
+			// A stopped worker processes nothing anymore, records pushed after that are written by their callers
+			if (mRecords && mRunning.load(std::memory_order_seq_cst))
+			{
+				// Wait until every record pushed before this call was written (or dropped)
+				const uint64_t target = mPushedCount.load(std::memory_order_seq_cst);
+				WakeWorker();
+
+				uint64_t processed = mProcessedCount.load(std::memory_order_acquire);
+				while (processed < target)
+				{
+					mProcessedCount.wait(processed, std::memory_order_acquire);
+					processed = mProcessedCount.load(std::memory_order_acquire);
+				}
+			}
+
+			mConsoleLogger->flush();
+			mBinarySink.Flush();
+		}
+
+		[[nodiscard]] uint64_t GetDroppedMessageCount() const
+		{
+			return mDroppedCount.load(std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] bool IsBinarySinkOpen() const
+		{
+			return mHasBinarySink;
+		}
+
+	private:
+		void PushRecord(const LogSite& site, const LogArgsLayout& layout, size_t argumentsSize, LogArgsWriter writer, const void* context)
+		{
+			if (!mRunning.load(std::memory_order_seq_cst))
+			{
+				WriteRecordOnCaller(site, layout, argumentsSize, writer, context);
+				return;
+			}
+
+			const auto now = spdlog::log_clock::now();
+			const auto recordWriter = [&](LogRecord& record)
+				{
+					record.Time = now;
+					record.Site = &site;
+					record.Layout = &layout;
+					record.Arguments.resize(argumentsSize);
+					writer(record.Arguments.data(), context);
+				};
+
+			while (!mRecords->TryPush(recordWriter))
+			{
+				switch (mOverflowPolicy)
+				{
+				case LogOverflowPolicy::Block:
+					// Nobody frees a slot once the worker stopped, the record is written right away instead
+					if (!mRunning.load(std::memory_order_seq_cst))
+					{
+						WriteRecordOnCaller(site, layout, argumentsSize, writer, context);
+						return;
+					}
+					WakeWorker();
+					std::this_thread::yield();
+					break;
+
+				case LogOverflowPolicy::Drop:
+					mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+					return;
+
+				case LogOverflowPolicy::DropOldest:
+					if (mRecords->TryPop([](LogRecord&) {}))
+					{
+						mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+						mProcessedCount.fetch_add(1, std::memory_order_release);
+						mProcessedCount.notify_all();
+					}
+					break;
+				}
+			}
+
+			mPushedCount.fetch_add(1, std::memory_order_seq_cst);
+			if (mWorkerWaiting.load(std::memory_order_seq_cst))
+			{
+				WakeWorker();
+			}
+		}
+
+		// @brief Captures and writes a record on the calling thread, formatting happens right away.
+		void WriteRecordOnCaller(const LogSite& site, const LogArgsLayout& layout, size_t argumentsSize, LogArgsWriter writer, const void* context)
+		{
+			thread_local LogRecord record;
+			record.Time = spdlog::log_clock::now();
+			record.Site = &site;
+			record.Layout = &layout;
+			record.Arguments.resize(argumentsSize);
+			writer(record.Arguments.data(), context);
+
+			thread_local std::string formatBuffer;
+			WriteRecord(record, formatBuffer);
+		}
+
+		void WakeWorker()
+		{
+			mWakeSignal.fetch_add(1, std::memory_order_seq_cst);
+			mWakeSignal.notify_one();
+		}
+
+		void WorkerLoop()
+		{
+			for (;;)
+			{
+				const size_t writtenCount = DrainRecords();
+				if (writtenCount > 0)
+				{
+					mProcessedCount.fetch_add(writtenCount, std::memory_order_release);
+					mProcessedCount.notify_all();
+					continue;
+				}
+
+				if (!mRunning.load(std::memory_order_seq_cst))
+				{
+					// Producers may have pushed right before ShutDown, drain until the queue stays empty
+					if (mRecords->GetSize() == 0)
+						break;
+					continue;
+				}
+
+				// Announce the wait before re-checking the queue, producers only signal waiting workers
+				mWorkerWaiting.store(true, std::memory_order_seq_cst);
+				const uint32_t signal = mWakeSignal.load(std::memory_order_seq_cst);
+				if (mRecords->GetSize() == 0 && mRunning.load(std::memory_order_seq_cst))
+				{
+					mWakeSignal.wait(signal, std::memory_order_seq_cst);
+				}
+				mWorkerWaiting.store(false, std::memory_order_relaxed);
+			}
+		}
+
+		// @brief Writes every queued record to the sinks. Worker thread only, or once it was joined.
+		size_t DrainRecords()
+		{
+			size_t writtenCount = 0;
+			while (mRecords->TryPop([this](LogRecord& record) { WriteRecord(record, mFormatBuffer); }))
+			{
+				++writtenCount;
+			}
+			return writtenCount;
+		}
+
+		// @brief Formats a captured call (this is where the deferred formatting happens) and writes it.
+		void WriteRecord(const LogRecord& record, std::string& formatBuffer)
+		{
+			const LogSite& site = *record.Site;
+
+			if (mHasBinarySink)
+			{
+				// The captured arguments already are the binary payload, no formatting needed
+				const int64_t time = std::chrono::duration_cast<std::chrono::nanoseconds>(record.Time.time_since_epoch()).count();
+				mBinarySink.Write(site, *record.Layout, time, record.Arguments);
+			}
+
+			if (site.Level < mConsoleLevel)
+				return;
+
+			formatBuffer.clear();
+			if (!site.Category.empty())
+			{
+				formatBuffer.append("[").append(site.Category).append("] ");
+			}
+			record.Layout->Format(formatBuffer, site.Format, record.Arguments.data());
+
+			mConsoleLogger->log(record.Time, spdlog::source_loc{}, ToSpdLogLvl(site.Level), spdlog::string_view_t(formatBuffer));
+		}
+
 	private:
 		std::shared_ptr<spdlog::logger> mConsoleLogger;
+		LogLevel mConsoleLevel{ LogLevel::Trace };
+		BinaryLogSink mBinarySink;
+		bool mHasBinarySink{ false };						// Set before any thread logs, the sink locks internally
+		Counter* mRecordCounters[static_cast<size_t>(LogLevel::Off)]{};	// Indexed by LogLevel
+
+		// Asynchronous mode only
+		std::optional<BoundedQueue<LogRecord>> mRecords;
+		LogOverflowPolicy mOverflowPolicy{ LogOverflowPolicy::Block };
+		std::thread mWorker;
+		std::string mFormatBuffer;							// Worker thread only (until joined), reused for every record
+
+		std::atomic<bool> mRunning{ true };
+		std::atomic<bool> mWorkerWaiting{ false };
+		std::atomic<uint32_t> mWakeSignal{ 0 };
+		std::atomic<uint64_t> mPushedCount{ 0 };
+		std::atomic<uint64_t> mProcessedCount{ 0 };		// Written by the worker or dropped by DropOldest
+		std::atomic<uint64_t> mDroppedCount{ 0 };
 	};
 
+	// ====================================================================================================
+	// Log Deduplicator Registry
+	// ====================================================================================================
+
+	namespace
+	{
+		// @brief Deduplicators that ever suppressed a repeat. Function-local statics, so they outlive the LogManager.
+		std::atomic<LogDeduplicator*> sLogDeduplicators{ nullptr };
+	}
+
+	void RegisterLogDeduplicator(LogDeduplicator& deduplicator)
+	{
+		LogDeduplicator* head = sLogDeduplicators.load(std::memory_order_relaxed);
+		do
+		{
+			deduplicator.SetNext(head);
+		} while (!sLogDeduplicators.compare_exchange_weak(head, &deduplicator, std::memory_order_release, std::memory_order_relaxed));
+	}
+
 	// ====================================================================================================
 	// LogManager Public API
 	// ====================================================================================================
 
-	LogManager::LogManager()
-		: mImpl(std::make_unique<Impl>())
+	LogManager::LogManager(const LogSettings& settings)
+		: mImpl(std::make_unique<Impl>(settings))
 	{
+		// GetInstance() is not available before the constructor returns, errors are logged through this instance
+		if (!settings.CategoryLevels.empty() && !LogCategory::Configure(settings.CategoryLevels))
+		{
+			LogMessage("LogManager", LogLevel::Error, std::format("Invalid category levels '{}'", settings.CategoryLevels));
+		}
+
+		// The environment wins over the code so levels can be changed on a shipped build
+		if (const char* levels = std::getenv(cLogLevelsVariable); levels && !LogCategory::Configure(levels))
+		{
+			LogMessage("LogManager", LogLevel::Error, std::format("Invalid {} value '{}'", cLogLevelsVariable, levels));
+		}
+
+		if (!settings.BinaryLogDirectory.empty() && !mImpl->IsBinarySinkOpen())
+		{
+			LogMessage("LogManager", LogLevel::Error, std::format("Failed to open a binary log segment in '{}'", settings.BinaryLogDirectory.string()));
+		}
 	}
 
 	LogManager::~LogManager()
 	{
+		ReportPendingRepeats();
 		GOJO_LOG_INFO("LogManager", "ShutDown complete!");
 	}
 
 	void LogManager::LogMessage(std::string_view categoryName, LogLevel level, std::string_view message) const
 	{
-		mImpl->LogMessage(categoryName, level, message);
+		if (level >= LogLevel::Off || !LogCategory::Get(categoryName).IsEnabled(level)) return;
+
+		Log(cRuntimeSites[static_cast<size_t>(level)], "[{}] {}", categoryName, message);
+	}
+
+	void LogManager::LogSuppressed(const LogSite& site, uint64_t suppressedCount) const
+	{
+		if (site.Level >= LogLevel::Off) return;
+
+		Log(cSuppressedSites[static_cast<size_t>(site.Level)], "[{}] {} messages suppressed by the rate limit of {}:{}", site.Category, suppressedCount, site.File, site.Line);
+	}
+
+	void LogManager::LogRepeated(const LogSite& site, uint64_t repeatCount) const
+	{
+		if (site.Level >= LogLevel::Off) return;
+
+		Log(cRepeatedSites[static_cast<size_t>(site.Level)], "[{}] Previous message repeated {} times at {}:{}", site.Category, repeatCount, site.File, site.Line);
+	}
+
+	void LogManager::ReportPendingRepeats() const
+	{
+		for (LogDeduplicator* deduplicator = sLogDeduplicators.load(std::memory_order_acquire); deduplicator; deduplicator = deduplicator->GetNext())
+		{
+			uint64_t repeatCount = 0;
+			if (const LogSite* site = deduplicator->TakeRepeats(repeatCount); site && repeatCount > 0)
+			{
+				LogRepeated(*site, repeatCount);
+			}
+		}
+	}
+
+	void LogManager::SubmitRecord(const LogSite& site, const LogArgsLayout& layout, size_t argumentsSize, LogArgsWriter writer, const void* context) const
+	{
+		mImpl->SubmitRecord(site, layout, argumentsSize, writer, context);
+	}
+
+	void LogManager::Flush() const
+	{
+		mImpl->Flush();
+	}
+
+	uint64_t LogManager::GetDroppedMessageCount() const
+	{
+		return mImpl->GetDroppedMessageCount();
 	}
-}
\ No newline at end of file
+}
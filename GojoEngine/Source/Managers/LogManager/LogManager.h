@@ -2,12 +2,18 @@
 
 #include "Core/Macros.h"
 #include "Managers/Manager.h"
+#include "Managers/FlightRecorder/FlightRecorder.h"
+#include "Managers/LogManager/LogCategory.h"
+#include "Managers/LogManager/LogLimiter.h"
+#include "Managers/LogManager/LogSite.h"
 
 #include <string>
 #include <string_view>
 #include <memory>
 #include <format>
 #include <concepts>
+#include <filesystem>
+#include <tuple>
 
 // ====================================================================================================
 // Log Configuration
@@ -50,6 +56,48 @@ namespace GojoEngine
 	constexpr LogLevel MIN_LOG_LEVEL = LogLevel::Trace;
 	constexpr LogLevel MAX_LOG_LEVEL = LogLevel::Fatal;
 
+	// @brief Lower-case level names, indexed by LogLevel. Used for parsing, metric labels and decoded output.
+	inline constexpr std::string_view cLogLevelNames[] = { "trace", "info", "debug", "warning", "error", "fatal", "off" };
+
+	// @brief Returns the name of "level", "unknown" for values read from a damaged file.
+	constexpr std::string_view GetLogLevelName(LogLevel level)
+	{
+		const auto index = static_cast<size_t>(level);
+		return index < std::size(cLogLevelNames) ? cLogLevelNames[index] : "unknown";
+	}
+
+	enum class LogMode : uint8_t
+	{
+		Synchronous,	// The calling thread writes to the sinks
+		Asynchronous	// The calling thread only pushes a record, a background thread writes to the sinks
+	};
+
+	/**
+	 * @brief What an asynchronous log call does when the record queue is full.
+	 */
+	enum class LogOverflowPolicy : uint8_t
+	{
+		Block,			// Wait for the background thread to make room (no message is lost)
+		Drop,			// Discard the new message
+		DropOldest		// Discard the oldest queued message to make room for the new one
+	};
+
+	struct LogSettings
+	{
+		LogMode Mode{ LogMode::Asynchronous };
+		LogOverflowPolicy OverflowPolicy{ LogOverflowPolicy::Block };
+		size_t QueueCapacity{ 8192 };		// Records, rounded up to a power of two
+		std::string_view CategoryLevels;	// Runtime levels, see LogCategory::Configure (the GOJO_LOG_LEVELS environment variable is applied afterwards)
+
+		// Messages below this level skip the console and are only written to the binary sink (if any)
+		LogLevel ConsoleLevel{ LogLevel::Trace };
+
+		// Binary sink: unformatted records in memory-mapped rotating segments, see BinaryLogSink and the LogDecoder tool
+		std::filesystem::path BinaryLogDirectory;			// The binary sink is enabled when not empty
+		size_t BinarySegmentSize{ 64 * 1024 * 1024 };		// Bytes preallocated per segment file
+		uint32_t BinarySegmentCount{ 8 };					// Segments kept on disk, the oldest is deleted on rotation
+	};
+
 	/**
 	 * @brief Concept ensuring the message can be converted to a string view.
 	 */
@@ -63,16 +111,58 @@ namespace GojoEngine
 	/**
 	 * @brief Handles logging to console sink.
 	 * Implements PIMPL idiom to hide spdlog dependencies.
+	 *
+	 * In asynchronous mode (default) log calls copy the message into a preallocated lock-free ring
+	 * buffer and return, a background thread performs the sink I/O. Fatal messages and ShutDown
+	 * flush every pending record first.
+	 *
+	 * Formatting is deferred: GOJO_LOG only copies the raw arguments next to the address of its
+	 * static LogSite, the background thread formats them right before writing.
 	 */
 	class GOJO_API LogManager final : public Manager<LogManager>
 	{
 		friend class Manager<LogManager>;
 
 	public:
+		// @brief Logs an already formatted message with a runtime category.
 		void LogMessage(std::string_view categoryName, LogLevel level, std::string_view message) const;
 
+		// @brief Captures the arguments of a log call in binary form, formatting happens later.
+		//        "format" is only used to validate the call at compile time, the site holds the same string.
+		template<typename... ArgsT>
+		void Log(const LogSite& site, [[maybe_unused]] std::format_string<const ArgsT&...> format, const ArgsT&... args) const
+		{
+			using CapturedT = std::tuple<decltype(CaptureLogArg(args))...>;
+
+			const CapturedT captured{ CaptureLogArg(args)... };
+			const size_t argumentsSize = std::apply([](const auto&... values) { return (size_t{ 0 } + ... + GetCapturedLogArgSize(values)); }, captured);
+
+			SubmitRecord(site, cLogArgsLayout<std::decay_t<ArgsT>...>, argumentsSize,
+				[](std::byte* destination, const void* context)
+				{
+					std::apply([&](const auto&... values) { ((destination = WriteCapturedLogArg(destination, values)), ...); }, *static_cast<const CapturedT*>(context));
+				},
+				&captured);
+		}
+
+		// @brief Summary lines of GOJO_LOG_RATE_LIMITED and GOJO_LOG_DEDUP, logged with the category and level of "site".
+		void LogSuppressed(const LogSite& site, uint64_t suppressedCount) const;
+		void LogRepeated(const LogSite& site, uint64_t repeatCount) const;
+
+		// @brief Logs the repeat counts GOJO_LOG_DEDUP sites are still holding back (a burst with no later message). Also done by ShutDown.
+		void ReportPendingRepeats() const;
+
+		// @brief Hands a captured log call to the backend (used by Log).
+		void SubmitRecord(const LogSite& site, const LogArgsLayout& layout, size_t argumentsSize, LogArgsWriter writer, const void* context) const;
+
+		// @brief Blocks until every message logged so far reached the sinks.
+		void Flush() const;
+
+		// @brief Number of messages discarded by the Drop/DropOldest overflow policies.
+		[[nodiscard]] uint64_t GetDroppedMessageCount() const;
+
 	private:
-		LogManager();
+		explicit LogManager(const LogSettings& settings = {});
 		~LogManager();
 
 	private:
@@ -86,20 +176,75 @@ namespace GojoEngine
 // ====================================================================================================
 
 #ifndef GOJO_LOG
-#define GOJO_LOG(categoryName, logLevel, message, ...) 																										\
-do 																																							\
-{ 																																							\
-	if constexpr (GojoEngine::LogLevel::logLevel >= GojoEngine::MIN_LOG_LEVEL && GojoEngine::LogLevel::logLevel <= GojoEngine::MAX_LOG_LEVEL) 				\
+#define GOJO_LOG(categoryName, logLevel, message, ...)																										\
+do																																							\
+{																																							\
+	if constexpr (GojoEngine::LogLevel::logLevel >= GojoEngine::MIN_LOG_LEVEL && GojoEngine::LogLevel::logLevel <= GojoEngine::MAX_LOG_LEVEL)				\
 	{																																						\
-		GOJO_STATIC_ASSERT(GojoEngine::LoggableMessage<decltype(message)>, "Message should be convertible to std::string or std::string_view!"); 			\
-		GOJO_STATIC_ASSERT(GojoEngine::LoggableMessage<decltype(categoryName)>, "Category should be convertible to std::string or std::string_view!"); 		\
+		GOJO_STATIC_ASSERT(GojoEngine::LoggableMessage<decltype(message)>, "Message should be convertible to std::string or std::string_view!");			\
+		GOJO_STATIC_ASSERT(GojoEngine::LoggableMessage<decltype(categoryName)>, "Category should be convertible to std::string or std::string_view!");		\
 																																							\
-		GojoEngine::LogManager::GetInstance().LogMessage( 																									\
-			categoryName, 																																	\
-			GojoEngine::LogLevel::logLevel, 																												\
-			std::format(message, ##__VA_ARGS__) 																											\
-		); 																																					\
-	} 																																						\
+		/* The category is resolved once per call site, arguments are only evaluated if its runtime level allows it */										\
+		static const GojoEngine::LogCategory& gojoLogCategory = GojoEngine::LogCategory::Get(categoryName);													\
+		if (gojoLogCategory.IsEnabled(GojoEngine::LogLevel::logLevel))																						\
+		{																																					\
+			static constexpr GojoEngine::LogSite gojoLogSite{ categoryName, GojoEngine::LogLevel::logLevel, message, __FILE__, __LINE__ };					\
+			GojoEngine::LogManager::GetInstance().Log(gojoLogSite, message, ##__VA_ARGS__);																	\
+		}																																					\
+	}																																						\
+} while (0)
+#endif
+
+// Lets at most "maxPerSecond" messages of this call site through, the first one of the next second reports the suppressed count
+#ifndef GOJO_LOG_RATE_LIMITED
+#define GOJO_LOG_RATE_LIMITED(categoryName, logLevel, maxPerSecond, message, ...)																			\
+do																																							\
+{																																							\
+	if constexpr (GojoEngine::LogLevel::logLevel >= GojoEngine::MIN_LOG_LEVEL && GojoEngine::LogLevel::logLevel <= GojoEngine::MAX_LOG_LEVEL)				\
+	{																																						\
+		static const GojoEngine::LogCategory& gojoLogCategory = GojoEngine::LogCategory::Get(categoryName);													\
+		if (gojoLogCategory.IsEnabled(GojoEngine::LogLevel::logLevel))																						\
+		{																																					\
+			/* Suppressed messages stop here: arguments are neither evaluated nor formatted */																\
+			static GojoEngine::LogRateLimiter gojoLogLimiter{ maxPerSecond };																				\
+			uint64_t gojoSuppressedCount = 0;																												\
+			if (gojoLogLimiter.TryAcquire(gojoSuppressedCount))																								\
+			{																																				\
+				static constexpr GojoEngine::LogSite gojoLogSite{ categoryName, GojoEngine::LogLevel::logLevel, message, __FILE__, __LINE__ };				\
+				const auto& gojoLogManager = GojoEngine::LogManager::GetInstance();																			\
+				if (gojoSuppressedCount > 0) { gojoLogManager.LogSuppressed(gojoLogSite, gojoSuppressedCount); }											\
+				gojoLogManager.Log(gojoLogSite, message, ##__VA_ARGS__);																					\
+			}																																				\
+		}																																					\
+	}																																						\
+} while (0)
+#endif
+
+// Collapses consecutive identical messages (same arguments) of this call site into a "repeated K times" summary
+#ifndef GOJO_LOG_DEDUP
+#define GOJO_LOG_DEDUP(categoryName, logLevel, message, ...)																								\
+do																																							\
+{																																							\
+	if constexpr (GojoEngine::LogLevel::logLevel >= GojoEngine::MIN_LOG_LEVEL && GojoEngine::LogLevel::logLevel <= GojoEngine::MAX_LOG_LEVEL)				\
+	{																																						\
+		static const GojoEngine::LogCategory& gojoLogCategory = GojoEngine::LogCategory::Get(categoryName);													\
+		if (gojoLogCategory.IsEnabled(GojoEngine::LogLevel::logLevel))																						\
+		{																																					\
+			/* Arguments are evaluated once, repeats are detected on a hash of their raw values and never formatted */										\
+			static GojoEngine::LogDeduplicator gojoLogDeduplicator;																							\
+			[](const auto&... gojoLogArgs)																													\
+			{																																				\
+				static constexpr GojoEngine::LogSite gojoLogSite{ categoryName, GojoEngine::LogLevel::logLevel, message, __FILE__, __LINE__ };				\
+				uint64_t gojoRepeatCount = 0;																												\
+				if (gojoLogDeduplicator.Check(gojoLogSite, GojoEngine::HashLogArgs(gojoLogArgs...), gojoRepeatCount))										\
+				{																																			\
+					const auto& gojoLogManager = GojoEngine::LogManager::GetInstance();																		\
+					if (gojoRepeatCount > 0) { gojoLogManager.LogRepeated(gojoLogSite, gojoRepeatCount); }													\
+					gojoLogManager.Log(gojoLogSite, message, gojoLogArgs...);																				\
+				}																																			\
+			}(__VA_ARGS__);																																	\
+		}																																					\
+	}																																						\
 } while (0)
 #endif
 
@@ -107,9 +252,15 @@ do 																																							\
 // Assertion Log Macro
 // ====================================================================================================
 
+// The message is flushed so it is visible before the debugger breaks, the flight recorder dumps the history leading to it
 #ifndef GOJO_LOG_ASSERT
 #define GOJO_LOG_ASSERT(expression, message, file, line) \
-		GOJO_LOG("Assertions", Error, "Assertion '{}' Failed: {}\nSource: {}:{}", #expression, message, file, line)
+		do \
+		{ \
+			GOJO_LOG("Assertions", Error, "Assertion '{}' Failed: {}\nSource: {}:{}", #expression, message, file, line); \
+			GojoEngine::LogManager::GetInstance().Flush(); \
+			if (GojoEngine::FlightRecorder* gojoFlightRecorder = GojoEngine::FlightRecorder::GetPtr()) { gojoFlightRecorder->Dump("Assertion"); } \
+		} while (0)
 #endif
 
 // ====================================================================================================
@@ -150,4 +301,56 @@ do 																																							\
 #define GOJO_LOG_FATAL(category, msg, ...) GOJO_LOG(category, Fatal, msg, ##__VA_ARGS__)
 #else
 #define GOJO_LOG_FATAL(category, msg, ...)
+#endif
+
+// ====================================================================================================
+// Hot Path Utility Macros
+// ====================================================================================================
+
+#if LOG_TRACE_ENABLED
+#define GOJO_LOG_TRACE_RATE_LIMITED(category, maxPerSecond, msg, ...) GOJO_LOG_RATE_LIMITED(category, Trace, maxPerSecond, msg, ##__VA_ARGS__)
+#define GOJO_LOG_TRACE_DEDUP(category, msg, ...) GOJO_LOG_DEDUP(category, Trace, msg, ##__VA_ARGS__)
+#else
+#define GOJO_LOG_TRACE_RATE_LIMITED(category, maxPerSecond, msg, ...)
+#define GOJO_LOG_TRACE_DEDUP(category, msg, ...)
+#endif
+
+#if LOG_INFO_ENABLED
+#define GOJO_LOG_INFO_RATE_LIMITED(category, maxPerSecond, msg, ...) GOJO_LOG_RATE_LIMITED(category, Info, maxPerSecond, msg, ##__VA_ARGS__)
+#define GOJO_LOG_INFO_DEDUP(category, msg, ...) GOJO_LOG_DEDUP(category, Info, msg, ##__VA_ARGS__)
+#else
+#define GOJO_LOG_INFO_RATE_LIMITED(category, maxPerSecond, msg, ...)
+#define GOJO_LOG_INFO_DEDUP(category, msg, ...)
+#endif
+
+#if LOG_DEBUG_ENABLED
+#define GOJO_LOG_DEBUG_RATE_LIMITED(category, maxPerSecond, msg, ...) GOJO_LOG_RATE_LIMITED(category, Debug, maxPerSecond, msg, ##__VA_ARGS__)
+#define GOJO_LOG_DEBUG_DEDUP(category, msg, ...) GOJO_LOG_DEDUP(category, Debug, msg, ##__VA_ARGS__)
+#else
+#define GOJO_LOG_DEBUG_RATE_LIMITED(category, maxPerSecond, msg, ...)
+#define GOJO_LOG_DEBUG_DEDUP(category, msg, ...)
+#endif
+
+#if LOG_WARNING_ENABLED
+#define GOJO_LOG_WARNING_RATE_LIMITED(category, maxPerSecond, msg, ...) GOJO_LOG_RATE_LIMITED(category, Warning, maxPerSecond, msg, ##__VA_ARGS__)
+#define GOJO_LOG_WARNING_DEDUP(category, msg, ...) GOJO_LOG_DEDUP(category, Warning, msg, ##__VA_ARGS__)
+#else
+#define GOJO_LOG_WARNING_RATE_LIMITED(category, maxPerSecond, msg, ...)
+#define GOJO_LOG_WARNING_DEDUP(category, msg, ...)
+#endif
+
+#if LOG_ERROR_ENABLED
+#define GOJO_LOG_ERROR_RATE_LIMITED(category, maxPerSecond, msg, ...) GOJO_LOG_RATE_LIMITED(category, Error, maxPerSecond, msg, ##__VA_ARGS__)
+#define GOJO_LOG_ERROR_DEDUP(category, msg, ...) GOJO_LOG_DEDUP(category, Error, msg, ##__VA_ARGS__)
+#else
+#define GOJO_LOG_ERROR_RATE_LIMITED(category, maxPerSecond, msg, ...)
+#define GOJO_LOG_ERROR_DEDUP(category, msg, ...)
+#endif
+
+#if LOG_FATAL_ENABLED
+#define GOJO_LOG_FATAL_RATE_LIMITED(category, maxPerSecond, msg, ...) GOJO_LOG_RATE_LIMITED(category, Fatal, maxPerSecond, msg, ##__VA_ARGS__)
+#define GOJO_LOG_FATAL_DEDUP(category, msg, ...) GOJO_LOG_DEDUP(category, Fatal, msg, ##__VA_ARGS__)
+#else
+#define GOJO_LOG_FATAL_RATE_LIMITED(category, maxPerSecond, msg, ...)
+#define GOJO_LOG_FATAL_DEDUP(category, msg, ...)
 #endif
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "Managers/LogManager/LogSite.h"
+
+#include <charconv>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Runtime Decoding
+	// ====================================================================================================
+
+	bool DecodeLogArgs(std::span<const LogArgType> types, std::span<const std::byte> arguments, std::vector<DecodedLogArg>& decoded)
+	{
+		decoded.clear();
+
+		size_t offset = 0;
+		auto read = [&](auto& value)
+			{
+				if (arguments.size() - offset < sizeof(value))
+					return false;
+
+				std::memcpy(&value, arguments.data() + offset, sizeof(value));
+				offset += sizeof(value);
+				return true;
+			};
+
+		auto readValue = [&]<typename T>(std::in_place_type_t<T>)
+			{
+				T value{};
+				if (!read(value))
+					return false;
+
+				decoded.emplace_back(value);
+				return true;
+			};
+
+		for (LogArgType type : types)
+		{
+			bool isValid = false;
+			switch (type)
+			{
+			case LogArgType::Bool:		isValid = readValue(std::in_place_type<bool>); break;
+			case LogArgType::Char:		isValid = readValue(std::in_place_type<char>); break;
+			case LogArgType::Int32:		isValid = readValue(std::in_place_type<int32_t>); break;
+			case LogArgType::UInt32:	isValid = readValue(std::in_place_type<uint32_t>); break;
+			case LogArgType::Int64:		isValid = readValue(std::in_place_type<int64_t>); break;
+			case LogArgType::UInt64:	isValid = readValue(std::in_place_type<uint64_t>); break;
+			case LogArgType::Float:		isValid = readValue(std::in_place_type<float>); break;
+			case LogArgType::Double:	isValid = readValue(std::in_place_type<double>); break;
+			case LogArgType::Pointer:	isValid = readValue(std::in_place_type<const void*>); break;
+			case LogArgType::String:
+			{
+				uint32_t length = 0;
+				if (read(length) && arguments.size() - offset >= length)
+				{
+					decoded.emplace_back(std::string_view(reinterpret_cast<const char*>(arguments.data() + offset), length));
+					offset += length;
+					isValid = true;
+				}
+				break;
+			}
+			}
+
+			if (!isValid)
+				return false;
+		}
+		return true;
+	}
+
+	void FormatDecodedLogArgs(std::string& output, std::string_view format, std::span<const DecodedLogArg> arguments, size_t firstArgument)
+	{
+		size_t nextArgument = firstArgument;
+		size_t position = 0;
+		while (position < format.size())
+		{
+			const char character = format[position];
+			if ((character == '{' || character == '}') && position + 1 < format.size() && format[position + 1] == character)
+			{
+				output.push_back(character);
+				position += 2;
+				continue;
+			}
+
+			if (character != '{')
+			{
+				output.push_back(character);
+				++position;
+				continue;
+			}
+
+			const size_t fieldEnd = format.find('}', position);
+			if (fieldEnd == std::string_view::npos)
+			{
+				output.append(format.substr(position));
+				return;
+			}
+
+			// "{index:spec}", the index is optional
+			const std::string_view field = format.substr(position + 1, fieldEnd - position - 1);
+			const size_t colon = field.find(':');
+			const std::string_view indexText = field.substr(0, colon);
+			const std::string_view spec = colon != std::string_view::npos ? field.substr(colon) : std::string_view();
+
+			size_t argumentIndex = nextArgument++;
+			if (!indexText.empty())
+			{
+				size_t explicitIndex = 0;
+				std::from_chars(indexText.data(), indexText.data() + indexText.size(), explicitIndex);
+				argumentIndex = firstArgument + explicitIndex;
+			}
+
+			if (argumentIndex < arguments.size())
+			{
+				const std::string singleFormat = std::format("{{{}}}", spec);
+				try
+				{
+					std::visit([&](const auto& value)
+						{
+							std::vformat_to(std::back_inserter(output), singleFormat, std::make_format_args(value));
+						}, arguments[argumentIndex]);
+				}
+				catch (const std::format_error&)
+				{
+					output.append(format.substr(position, fieldEnd - position + 1));
+				}
+			}
+			else
+			{
+				output.append("<missing argument>");
+			}
+
+			position = fieldEnd + 1;
+		}
+	}
+}
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "Core/Macros.h"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace GojoEngine
+{
+	enum class LogLevel : uint8_t;
+
+	// ====================================================================================================
+	// Log Sites
+	// ====================================================================================================
+
+	/**
+	 * @brief Compile-time description of one log call site.
+	 * GOJO_LOG emits a static constexpr instance per call site, records only carry its address.
+	 */
+	struct LogSite
+	{
+		std::string_view Category;
+		LogLevel Level;
+		std::string_view Format;
+		std::string_view File;
+		uint32_t Line{ 0 };
+	};
+
+	// ====================================================================================================
+	// Log Arguments
+	// ====================================================================================================
+
+	/**
+	 * @brief Binary representation of a captured log argument.
+	 * Arithmetic values are copied as is, strings as a uint32 length followed by their characters.
+	 * Other formattable types are formatted on the calling thread and captured as a String.
+	 */
+	enum class LogArgType : uint8_t
+	{
+		Bool,
+		Char,
+		Int32,
+		UInt32,
+		Int64,
+		UInt64,
+		Float,
+		Double,
+		Pointer,
+		String
+	};
+
+	/**
+	 * @brief Layout of the arguments of a log call, one instance per argument type list.
+	 * "Format" rebuilds the arguments from the captured bytes and formats them (consumer side).
+	 */
+	struct LogArgsLayout
+	{
+		const LogArgType* Types;
+		uint32_t Count;
+		void (*Format)(std::string& output, std::string_view format, const std::byte* arguments);
+	};
+
+	// @brief Writes the captured arguments of a call into "destination" (exactly the announced size).
+	using LogArgsWriter = void(*)(std::byte* destination, const void* context);
+
+	template<typename T>
+	concept LogStringArg = std::same_as<T, std::string> || std::same_as<T, std::string_view>
+		|| std::same_as<T, const char*> || std::same_as<T, char*>;
+
+	// @brief Maps an argument type (decayed) to its captured type.
+	template<typename T>
+	consteval LogArgType GetLogArgType()
+	{
+		if constexpr (std::same_as<T, bool>)									return LogArgType::Bool;
+		else if constexpr (std::same_as<T, char>)								return LogArgType::Char;
+		else if constexpr (std::signed_integral<T> && sizeof(T) <= 4)			return LogArgType::Int32;
+		else if constexpr (std::unsigned_integral<T> && sizeof(T) <= 4)			return LogArgType::UInt32;
+		else if constexpr (std::signed_integral<T>)								return LogArgType::Int64;
+		else if constexpr (std::unsigned_integral<T>)							return LogArgType::UInt64;
+		else if constexpr (std::same_as<T, float>)								return LogArgType::Float;
+		else if constexpr (std::floating_point<T>)								return LogArgType::Double;
+		else if constexpr (std::same_as<T, std::nullptr_t> || (std::is_pointer_v<T> && !LogStringArg<T>)) return LogArgType::Pointer;
+		else																	return LogArgType::String;
+	}
+
+	template<LogArgType TypeT> struct LogArgStorage;
+	template<> struct LogArgStorage<LogArgType::Bool>    { using Type = bool; };
+	template<> struct LogArgStorage<LogArgType::Char>    { using Type = char; };
+	template<> struct LogArgStorage<LogArgType::Int32>   { using Type = int32_t; };
+	template<> struct LogArgStorage<LogArgType::UInt32>  { using Type = uint32_t; };
+	template<> struct LogArgStorage<LogArgType::Int64>   { using Type = int64_t; };
+	template<> struct LogArgStorage<LogArgType::UInt64>  { using Type = uint64_t; };
+	template<> struct LogArgStorage<LogArgType::Float>   { using Type = float; };
+	template<> struct LogArgStorage<LogArgType::Double>  { using Type = double; };
+	template<> struct LogArgStorage<LogArgType::Pointer> { using Type = const void*; };
+	template<> struct LogArgStorage<LogArgType::String>  { using Type = std::string_view; };
+
+	// @brief Returns what is captured for an argument: the value, a view of the string or its formatted text.
+	template<typename T>
+	decltype(auto) CaptureLogArg(const T& value)
+	{
+		using DecayedT = std::decay_t<T>;
+		constexpr LogArgType type = GetLogArgType<DecayedT>();
+
+		if constexpr (type == LogArgType::Pointer)
+		{
+			return static_cast<const void*>(value);
+		}
+		else if constexpr (type != LogArgType::String)
+		{
+			return static_cast<typename LogArgStorage<type>::Type>(value);
+		}
+		else if constexpr (std::is_pointer_v<DecayedT>)
+		{
+			return value ? std::string_view(value) : std::string_view();
+		}
+		else if constexpr (LogStringArg<DecayedT>)
+		{
+			return std::string_view(value);
+		}
+		else
+		{
+			// No binary representation, the text is captured instead
+			return std::format("{}", value);
+		}
+	}
+
+	template<typename T>
+	size_t GetCapturedLogArgSize(const T& captured)
+	{
+		if constexpr (std::same_as<T, std::string_view> || std::same_as<T, std::string>)
+			return sizeof(uint32_t) + captured.size();
+		else
+			return sizeof(T);
+	}
+
+	template<typename T>
+	std::byte* WriteCapturedLogArg(std::byte* destination, const T& captured)
+	{
+		if constexpr (std::same_as<T, std::string_view> || std::same_as<T, std::string>)
+		{
+			const auto length = static_cast<uint32_t>(captured.size());
+			std::memcpy(destination, &length, sizeof(length));
+			if (length > 0)
+			{
+				std::memcpy(destination + sizeof(length), captured.data(), length);
+			}
+			return destination + sizeof(length) + length;
+		}
+		else
+		{
+			std::memcpy(destination, &captured, sizeof(T));
+			return destination + sizeof(T);
+		}
+	}
+
+	template<LogArgType TypeT>
+	typename LogArgStorage<TypeT>::Type ReadCapturedLogArg(const std::byte*& source)
+	{
+		using StorageT = typename LogArgStorage<TypeT>::Type;
+		if constexpr (TypeT == LogArgType::String)
+		{
+			uint32_t length = 0;
+			std::memcpy(&length, source, sizeof(length));
+			const std::string_view text(reinterpret_cast<const char*>(source + sizeof(length)), length);
+			source += sizeof(length) + length;
+			return text;
+		}
+		else
+		{
+			StorageT value;
+			std::memcpy(&value, source, sizeof(StorageT));
+			source += sizeof(StorageT);
+			return value;
+		}
+	}
+
+	// @brief Consumer side: reads the captured arguments back and formats them.
+	template<LogArgType... TypesT>
+	void FormatCapturedLogArgs(std::string& output, std::string_view format, const std::byte* arguments)
+	{
+		// Braced initialization keeps the reads in argument order
+		std::tuple<typename LogArgStorage<TypesT>::Type...> values{ ReadCapturedLogArg<TypesT>(arguments)... };
+
+		try
+		{
+			std::apply([&](auto&... unpacked)
+				{
+					std::vformat_to(std::back_inserter(output), format, std::make_format_args(unpacked...));
+				}, values);
+		}
+		catch (const std::format_error& error)
+		{
+			// Format specs of pre-formatted arguments are applied to their text and may not fit
+			output.append("<format error: ").append(error.what()).append("> ").append(format);
+		}
+	}
+
+	template<typename... ArgsT>
+	inline constexpr std::array<LogArgType, sizeof...(ArgsT)> cLogArgTypes{ GetLogArgType<std::decay_t<ArgsT>>()... };
+
+	template<typename... ArgsT>
+	inline constexpr LogArgsLayout cLogArgsLayout
+	{
+		cLogArgTypes<ArgsT...>.data(),
+		static_cast<uint32_t>(sizeof...(ArgsT)),
+		&FormatCapturedLogArgs<GetLogArgType<std::decay_t<ArgsT>>()...>
+	};
+
+	// ====================================================================================================
+	// Runtime Decoding
+	// ====================================================================================================
+
+	// @brief A captured argument read back when its type is only known at runtime (LogDecoder, flight records).
+	using DecodedLogArg = std::variant<bool, char, int32_t, uint32_t, int64_t, uint64_t, float, double, const void*, std::string_view>;
+
+	// @brief Reads the captured arguments described by "types". Strings point into "arguments".
+	// @return False if the arguments do not fit in "arguments".
+	GOJO_API bool DecodeLogArgs(std::span<const LogArgType> types, std::span<const std::byte> arguments, std::vector<DecodedLogArg>& decoded);
+
+	/**
+	 * @brief Formats "format" with decoded arguments, starting at "firstArgument".
+	 * The argument types are only known at runtime, so every replacement field is formatted on its own.
+	 */
+	GOJO_API void FormatDecodedLogArgs(std::string& output, std::string_view format, std::span<const DecodedLogArg> arguments, size_t firstArgument = 0);
+}
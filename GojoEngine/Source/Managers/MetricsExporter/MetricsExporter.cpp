@@ -0,0 +1,296 @@
+#include "Managers/MetricsExporter/MetricsExporter.h"
+#include "Managers/LogManager/LogManager.h"
+#include "Core/Metrics/Metrics.h"
+#include "Core/Profiler/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <format>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <WinSock2.h>
+#include <afunix.h>
+#else
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		constexpr std::chrono::milliseconds cPollInterval{ 100 };		// Upper bound of the shutdown latency
+		constexpr std::chrono::milliseconds cRequestTimeout{ 100 };		// Clients that connect and send nothing
+
+#ifdef _WIN32
+		using SocketHandle = SOCKET;
+		constexpr SocketHandle cInvalidSocket = INVALID_SOCKET;
+		constexpr int cSendFlags = 0;
+		constexpr int cShutDownSend = SD_SEND;
+
+		void CloseSocketHandle(SocketHandle socketHandle) { closesocket(socketHandle); }
+#else
+		using SocketHandle = int;
+		constexpr SocketHandle cInvalidSocket = -1;
+		constexpr int cSendFlags = MSG_NOSIGNAL;						// A client that hung up must not raise SIGPIPE
+		constexpr int cShutDownSend = SHUT_WR;
+
+		void CloseSocketHandle(SocketHandle socketHandle) { close(socketHandle); }
+#endif
+
+		// @brief True once "socketHandle" can be read (or accepted from) without blocking.
+		bool WaitReadable(SocketHandle socketHandle, std::chrono::milliseconds timeout)
+		{
+			fd_set readSet;
+			FD_ZERO(&readSet);
+			FD_SET(socketHandle, &readSet);
+
+			timeval time{};
+			time.tv_sec = static_cast<long>(timeout.count() / 1000);
+			time.tv_usec = static_cast<long>((timeout.count() % 1000) * 1000);
+
+			return select(static_cast<int>(socketHandle) + 1, &readSet, nullptr, nullptr, &time) > 0;
+		}
+	}
+
+	// ====================================================================================================
+	// MetricsExporter Implementation (PIMPL)
+	// ====================================================================================================
+
+	class MetricsExporter::Impl
+	{
+	public:
+		explicit Impl(const MetricsExporterSettings& settings)
+			: mSettings(settings)
+		{
+			if (!mSettings.SocketPath.empty())
+			{
+				OpenSocket();
+			}
+
+			if (!mSettings.SnapshotPath.empty() || mListenSocket != cInvalidSocket)
+			{
+				mThread = std::thread([this]() { Run(); });
+			}
+		}
+
+		~Impl()
+		{
+			if (mThread.joinable())
+			{
+				{
+					std::lock_guard lock(mMutex);
+					mStopRequested.store(true, std::memory_order_relaxed);
+				}
+				mSignal.notify_one();
+				mThread.join();
+			}
+
+			CloseSocket();
+
+			// Final values of the session, the last periodic snapshot may be seconds old
+			if (!mSettings.SnapshotPath.empty())
+			{
+				WriteSnapshot();
+			}
+		}
+
+		bool WriteSnapshot() const
+		{
+			if (mSettings.SnapshotPath.empty())
+				return false;
+
+			GOJO_PROFILE_SCOPE("MetricsExporter::WriteSnapshot");
+			return MetricsRegistry::WriteSnapshot(mSettings.SnapshotPath);
+		}
+
+	private:
+		void Run()
+		{
+			Profiler::SetThreadName("Metrics Exporter");
+
+			auto nextSnapshot = std::chrono::steady_clock::now();
+			while (!mStopRequested.load(std::memory_order_relaxed))
+			{
+				auto timeout = cPollInterval;
+				if (!mSettings.SnapshotPath.empty())
+				{
+					const auto now = std::chrono::steady_clock::now();
+					if (now >= nextSnapshot)
+					{
+						if (!WriteSnapshot() && !mReportedWriteFailure)
+						{
+							GOJO_LOG_ERROR("Metrics", "Failed to write the metrics snapshot to '{}'", mSettings.SnapshotPath.string());
+							mReportedWriteFailure = true;
+						}
+						nextSnapshot = now + mSettings.SnapshotInterval;
+					}
+					timeout = std::min(timeout, std::chrono::ceil<std::chrono::milliseconds>(nextSnapshot - now));
+				}
+
+				if (mListenSocket != cInvalidSocket)
+				{
+					if (WaitReadable(mListenSocket, timeout))
+					{
+						ServeClient();
+					}
+				}
+				else
+				{
+					std::unique_lock lock(mMutex);
+					mSignal.wait_for(lock, timeout, [this]() { return mStopRequested.load(std::memory_order_relaxed); });
+				}
+			}
+		}
+
+		void OpenSocket()
+		{
+#ifdef _WIN32
+			WSADATA wsaData{};
+			if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+			{
+				GOJO_LOG_ERROR("Metrics", "WSAStartup failed, metrics are not served on a socket");
+				return;
+			}
+			mIsWinsockStarted = true;
+#endif
+
+			sockaddr_un address{};
+			address.sun_family = AF_UNIX;
+
+			const std::string path = mSettings.SocketPath.string();
+			if (path.size() >= sizeof(address.sun_path))
+			{
+				GOJO_LOG_ERROR("Metrics", "Metrics socket path '{}' is too long", path);
+				return;
+			}
+			std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+			// A previous session that did not shut down cleanly leaves the socket file behind
+			std::error_code error;
+			std::filesystem::remove(mSettings.SocketPath, error);
+
+			mListenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+			if (mListenSocket == cInvalidSocket)
+			{
+				GOJO_LOG_ERROR("Metrics", "Failed to create the metrics socket");
+				return;
+			}
+
+			if (bind(mListenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(mListenSocket, 4) != 0)
+			{
+				GOJO_LOG_ERROR("Metrics", "Failed to listen on the metrics socket '{}'", path);
+				CloseSocketHandle(mListenSocket);
+				mListenSocket = cInvalidSocket;
+				return;
+			}
+
+			GOJO_LOG_INFO("Metrics", "Serving metrics on '{}'", path);
+		}
+
+		void CloseSocket()
+		{
+			if (mListenSocket != cInvalidSocket)
+			{
+				CloseSocketHandle(mListenSocket);
+				mListenSocket = cInvalidSocket;
+
+				std::error_code error;
+				std::filesystem::remove(mSettings.SocketPath, error);
+			}
+
+#ifdef _WIN32
+			if (mIsWinsockStarted)
+			{
+				WSACleanup();
+				mIsWinsockStarted = false;
+			}
+#endif
+		}
+
+		void ServeClient()
+		{
+			const SocketHandle client = accept(mListenSocket, nullptr, nullptr);
+			if (client == cInvalidSocket)
+				return;
+
+			GOJO_PROFILE_SCOPE("MetricsExporter::ServeClient");
+
+			// The request itself does not matter, but closing with it unread would reset the connection
+			if (WaitReadable(client, cRequestTimeout))
+			{
+				char request[1024];
+				recv(client, request, sizeof(request), 0);
+			}
+
+			const std::string body = MetricsRegistry::GetSnapshot();
+			const std::string response = std::format(
+				"HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4; charset=utf-8\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}",
+				body.size(), body);
+
+			size_t sent = 0;
+			while (sent < response.size())
+			{
+				const int result = send(client, response.data() + sent, static_cast<int>(response.size() - sent), cSendFlags);
+				if (result <= 0)
+					break;
+				sent += static_cast<size_t>(result);
+			}
+
+			shutdown(client, cShutDownSend);
+			CloseSocketHandle(client);
+		}
+
+	private:
+		MetricsExporterSettings mSettings;
+
+		std::thread mThread;
+		std::mutex mMutex;
+		std::condition_variable mSignal;
+		std::atomic<bool> mStopRequested{ false };
+		bool mReportedWriteFailure{ false };
+
+		SocketHandle mListenSocket{ cInvalidSocket };
+#ifdef _WIN32
+		bool mIsWinsockStarted{ false };
+#endif
+	};
+
+	// ====================================================================================================
+	// MetricsExporter Public API
+	// ====================================================================================================
+
+	MetricsExporter::MetricsExporter(const MetricsExporterSettings& settings)
+		: pImpl(std::make_unique<Impl>(settings))
+	{
+		GOJO_LOG_INFO("Metrics", "MetricsExporter StartUp complete!");
+	}
+
+	MetricsExporter::~MetricsExporter()
+	{
+		pImpl.reset();
+		GOJO_LOG_INFO("Metrics", "MetricsExporter ShutDown complete!");
+	}
+
+	bool MetricsExporter::WriteSnapshot() const
+	{
+		return pImpl->WriteSnapshot();
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Core/Macros.h"
+#include "Managers/Manager.h"
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Metrics Exporter Settings
+	// ====================================================================================================
+
+	struct MetricsExporterSettings
+	{
+		std::filesystem::path SnapshotPath;									// Rewritten every SnapshotInterval, empty disables
+		std::chrono::milliseconds SnapshotInterval{ 5000 };
+		std::filesystem::path SocketPath;									// Local (AF_UNIX) socket, empty disables
+	};
+
+	// ====================================================================================================
+	// Metrics Exporter Interface
+	// ====================================================================================================
+
+	/**
+	 * @brief Publishes MetricsRegistry snapshots for a local scraper, from its own thread.
+	 *
+	 * The snapshot file is replaced atomically, a final one is written on shutdown. Every connection to
+	 * the socket receives one snapshot as a plain HTTP/1.0 response and is closed, so both
+	 * "curl --unix-socket <path> http://localhost/metrics" and Prometheus behind a socket proxy work.
+	 * With neither path set the exporter does nothing, the metrics are still recorded.
+	 */
+	class GOJO_API MetricsExporter final : public Manager<MetricsExporter>
+	{
+		friend class Manager<MetricsExporter>;
+
+	public:
+		// @brief Writes a snapshot right away (SnapshotPath must be set).
+		bool WriteSnapshot() const;
+
+	private:
+		explicit MetricsExporter(const MetricsExporterSettings& settings = {});
+		~MetricsExporter();
+
+	private:
+		class Impl;
+		std::unique_ptr<Impl> pImpl;
+	};
+}
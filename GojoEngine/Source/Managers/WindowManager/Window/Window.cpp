@@ -4,6 +4,7 @@
 #include "Managers/EventManager/Events/KeyboardEvents.h"
 #include "Managers/EventManager/Events/MouseEvents.h"
 #include "Managers/LogManager/LogManager.h"
+#include "Core/Memory/MemoryTracker.h"
 
 #include <GLFW/glfw3.h>
 
@@ -44,11 +45,31 @@ namespace GojoEngine
 		}
 	}
 
+	void* Window::operator new(size_t size)
+	{
+		return MemoryTracker::Allocate(size, alignof(Window), GOJO_MEMORY_SITE(MemoryTag::Windows));
+	}
+
+	void Window::operator delete(void* memory) noexcept
+	{
+		MemoryTracker::Free(memory);
+	}
+
 	bool Window::ShouldClose() const
 	{
 		return mWindow ? glfwWindowShouldClose(mWindow) : true;
 	}
 
+	bool Window::IsFocused() const
+	{
+		return mWindow ? glfwGetWindowAttrib(mWindow, GLFW_FOCUSED) == GLFW_TRUE : false;
+	}
+
+	bool Window::IsMinimized() const
+	{
+		return mWindow ? glfwGetWindowAttrib(mWindow, GLFW_ICONIFIED) == GLFW_TRUE : false;
+	}
+
 	void Window::InitializeCallbacks()
 	{
 		glfwSetWindowUserPointer(mWindow, this);
@@ -65,7 +86,7 @@ namespace GojoEngine
 				self->mSettings.Height = static_cast<uint16_t>(height);
 
 				WindowResizeEvent event(self->mId, width, height);
-				DispatchEvent(event);
+				PostEvent(event);
 			});
 
 		// Close
@@ -74,7 +95,7 @@ namespace GojoEngine
 				auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
 
 				WindowCloseEvent event(self->mId);
-				DispatchEvent(event);
+				PostEvent(event);
 			});
 
 		// Focus / Lost Focus
@@ -85,12 +106,12 @@ namespace GojoEngine
 				if (focused)
 				{
 					WindowFocusEvent event(self->mId);
-					DispatchEvent(event);
+					PostEvent(event);
 				}
 				else
 				{
 					WindowLostFocusEvent event(self->mId);
-					DispatchEvent(event);
+					PostEvent(event);
 				}
 			});
 
@@ -103,7 +124,7 @@ namespace GojoEngine
 				self->mSettings.YPos = static_cast<uint16_t>(ypos);
 
 				WindowMovedEvent event(self->mId, xpos, ypos);
-				DispatchEvent(event);
+				PostEvent(event);
 			});
 
 		// ==========================================
@@ -119,19 +140,19 @@ namespace GojoEngine
 				case GLFW_PRESS:
 				{
 					KeyPressedEvent event(self->mId, key);
-					DispatchEvent(event);
+					PostEvent(event);
 					break;
 				}
 				case GLFW_RELEASE:
 				{
 					KeyReleasedEvent event(self->mId, key);
-					DispatchEvent(event);
+					PostEvent(event);
 					break;
 				}
 				case GLFW_REPEAT:
 				{
 					KeyPressedEvent event(self->mId, key);
-					DispatchEvent(event);
+					PostEvent(event);
 					break;
 				}
 				}
@@ -143,7 +164,7 @@ namespace GojoEngine
 				auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
 
 				KeyTypedEvent event(self->mId, static_cast<int>(keycode));
-				DispatchEvent(event);
+				PostEvent(event);
 			});
 
 		// ==========================================
@@ -159,13 +180,13 @@ namespace GojoEngine
 				case GLFW_PRESS:
 				{
 					MouseButtonPressedEvent event(self->mId, button);
-					DispatchEvent(event);
+					PostEvent(event);
 					break;
 				}
 				case GLFW_RELEASE:
 				{
 					MouseButtonReleasedEvent event(self->mId, button);
-					DispatchEvent(event);
+					PostEvent(event);
 					break;
 				}
 				}
@@ -177,7 +198,7 @@ namespace GojoEngine
 				auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
 
 				MouseScrolledEvent event(self->mId, static_cast<float>(xOffset), static_cast<float>(yOffset));
-				DispatchEvent(event);
+				PostEvent(event);
 			});
 
 		// Cursor Position (Mouse Moved)
@@ -186,7 +207,7 @@ namespace GojoEngine
 				auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
 
 				MouseMovedEvent event(self->mId, static_cast<float>(xPos), static_cast<float>(yPos));
-				DispatchEvent(event);
+				PostEvent(event);
 			});
 	}
 
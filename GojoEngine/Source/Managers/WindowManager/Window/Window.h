@@ -2,6 +2,7 @@
 
 #include "Core/Macros.h"
 #include "Core/Utility.h"
+#include "Core/Containers/SlotMap.h"
 #include <string>
 #include <functional> 
 
@@ -22,24 +23,13 @@ namespace GojoEngine
 		std::string Title{ "GojoWindow" };
 	};
 
+	class Window;
+
 	/**
-	 * @brief Strongly typed ID for windows to avoid confusion with regular integers.
+	 * @brief Generational handle of a window. Stays stale once the window is erased, even after another
+	 *        window reused its slot.
 	 */
-	struct GOJO_API WindowId
-	{
-		constexpr explicit WindowId(uint32_t id) : mId(id) {}
-
-		WindowId operator++(int)
-		{
-			WindowId temp = *this;
-			++mId;
-			return temp;
-		}
-
-		constexpr auto operator<=>(const WindowId&) const = default; // Space-ship operator that will be exposed to 6 operators.
-
-		uint32_t mId{ 0 };
-	};
+	using WindowId = SlotHandle<Window>;
 
 	// ====================================================================================================
 	// Window Class
@@ -52,6 +42,8 @@ namespace GojoEngine
 		~Window() override;
 
 		[[nodiscard]] bool ShouldClose() const;
+		[[nodiscard]] bool IsFocused() const;
+		[[nodiscard]] bool IsMinimized() const;
 		[[nodiscard]] bool IsValid() const { return mWindow != nullptr; }
 
 		[[nodiscard]] GLFWwindow* GetRaw() const { return mWindow; }
@@ -59,6 +51,10 @@ namespace GojoEngine
 		[[nodiscard]] std::pair<uint16_t, uint16_t> GetResolution() const { return std::make_pair(mSettings.Width, mSettings.Height); }
 		[[nodiscard]] WindowId GetId() const { return mId; }
 
+		// Windows are accounted to MemoryTag::Windows
+		static void* operator new(size_t size);
+		static void operator delete(void* memory) noexcept;
+
 	private:
 		void InitializeCallbacks();
 
@@ -68,19 +64,3 @@ namespace GojoEngine
 		WindowId mId;
 	};
 }
-
-// ====================================================================================================
-// Standard Library Specializations
-// ====================================================================================================
-
-namespace std
-{
-	template<>
-	struct hash<GojoEngine::WindowId>
-	{
-		size_t operator()(const GojoEngine::WindowId& windowId)	const noexcept
-		{
-			return std::hash<uint32_t>{}(windowId.mId);
-		}
-	};
-}
\ No newline at end of file
@@ -1,10 +1,27 @@
 #include "Managers/WindowManager/WindowManager.h"
 #include "Managers/LogManager/LogManager.h"
+#include "Managers/EventManager/EventManager.h"
+#include "Core/Metrics/Metrics.h"
+#include "Core/Profiler/Profiler.h"
 
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+
 namespace GojoEngine
 {
+	// ====================================================================================================
+	// Internal Helpers
+	// ====================================================================================================
+	namespace
+	{
+		Gauge& GetWindowsAliveMetric()
+		{
+			static Gauge& sGauge = MetricsRegistry::GetGauge("gojo_windows_alive", "Windows created and not erased yet");
+			return sGauge;
+		}
+	}
+
 	// ====================================================================================================
 	// Public API
 	// ====================================================================================================
@@ -19,18 +36,18 @@ namespace GojoEngine
 			return std::unexpected(WindowError::ManagerIsNotInitialized);
 		}
 
-		const WindowId id( ++mWindowCounter );
-
-		auto window = std::make_shared<Window>(id, settings);
-		if (!window->IsValid())
+		// The window registers its handle with its GLFW callbacks, so the slot is taken first
+		const WindowId id = mWindows.EmplaceWithHandle([&settings](WindowId handle) { return std::make_unique<Window>(handle, settings); });
+		if (!(*mWindows.Get(id))->IsValid())
 		{
+			mWindows.Remove(id);
 			GOJO_LOG_ERROR("WindowManager", "Window creation failed for '{}'", settings.Title);
 			return std::unexpected(WindowError::CreationFailed);
 		}
 
-		mWindows[id] = window;
+		GetWindowsAliveMetric().Set(static_cast<double>(mWindows.GetSize()));
 
-		GOJO_LOG_INFO("WindowManager", "Window '{}' created with ID: {}", settings.Title, id.mId);
+		GOJO_LOG_INFO("WindowManager", "Window '{}' created with ID: {} (generation {})", settings.Title, id.Index, id.Generation);
 
 		return id;
 	}
@@ -39,26 +56,59 @@ namespace GojoEngine
 	{
 		if (!mInitialized) return;
 
-		glfwPollEvents();
+		PollEvents();
 		CleanupClosedWindows();
 	}
 
+	void WindowManager::PollEvents()
+	{
+		if (!mInitialized) return;
+
+		GOJO_PROFILE_SCOPE("glfwPollEvents");
+		glfwPollEvents();
+	}
+
+	void WindowManager::WaitEvents(std::chrono::milliseconds timeout)
+	{
+		if (!mInitialized) return;
+
+		GOJO_PROFILE_SCOPE("glfwWaitEventsTimeout");
+		glfwWaitEventsTimeout(std::chrono::duration<double>(timeout).count());
+	}
+
+	void WindowManager::WakeUp()
+	{
+		if (!mInitialized) return;
+
+		glfwPostEmptyEvent();
+	}
+
 	void WindowManager::CleanupClosedWindows()
 	{
-		std::erase_if(mWindows, [](const auto& pair)
+		GOJO_PROFILE_SCOPE("WindowManager::CleanupClosedWindows");
+
+		mWindows.RemoveIf([](WindowId id, const std::unique_ptr<Window>& window)
 			{
-				if (pair.second->ShouldClose())
+				if (window->ShouldClose())
 				{
-					GOJO_LOG_INFO("WindowManager", "Erased '{}' window!", pair.second->GetTitle());
+					// Listener buckets of this window are dead weight from now on
+					if (EventManager::IsInitialized())
+					{
+						EventManager::GetInstance().RemoveWindowListeners(id);
+					}
+
+					GOJO_LOG_INFO("WindowManager", "Erased '{}' window!", window->GetTitle());
 					return true;
 				}
 				return false;
 			});
+
+		GetWindowsAliveMetric().Set(static_cast<double>(mWindows.GetSize()));
 	}
 
 	void WindowManager::CloseAllWindows()
 	{
-		for (auto& [id, window] : mWindows)
+		for (const std::unique_ptr<Window>& window : mWindows)
 		{
 			if (window && window->IsValid())
 			{
@@ -69,17 +119,24 @@ namespace GojoEngine
 
 	bool WindowManager::AreAllWindowsClosed() const
 	{
-		return mWindows.empty();
+		return mWindows.IsEmpty();
 	}
 
-	std::shared_ptr<Window> WindowManager::GetWindowById(WindowId id) const
+	bool WindowManager::AreAllWindowsInactive() const
 	{
-		if (auto it = mWindows.find(id); it != mWindows.end())
+		const bool anyFocused = std::ranges::any_of(mWindows, [](const std::unique_ptr<Window>& window) { return window->IsFocused(); });
+		const bool allMinimized = std::ranges::all_of(mWindows, [](const std::unique_ptr<Window>& window) { return window->IsMinimized(); });
+		return !anyFocused || allMinimized;
+	}
+
+	Window* WindowManager::GetWindowById(WindowId id) const
+	{
+		if (const std::unique_ptr<Window>* window = mWindows.Get(id))
 		{
-			return it->second;
+			return window->get();
 		}
 
-		GOJO_LOG_WARNING("WindowManager", "Requested window with invalid ID: {}", id.mId);
+		GOJO_LOG_WARNING("WindowManager", "Requested window with stale ID: {} (generation {})", id.Index, id.Generation);
 		return nullptr;
 	}
 
@@ -87,13 +144,20 @@ namespace GojoEngine
 	// Constructor / Destructor
 	// ====================================================================================================
 
-	WindowManager::WindowManager()
+	WindowManager::WindowManager(const WindowManagerSettings& settings)
+		: mHeadless(settings.Headless)
 	{
 		glfwSetErrorCallback([](int errorCode, const char* description)
 			{
 				GOJO_LOG_ERROR("GLFW", "Error [{}]: {}", errorCode, description);
 			});
 
+		// The null platform implements the whole window API without a display (build farms, servers)
+		if (mHeadless)
+		{
+			glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+		}
+
 		if (!glfwInit())
 		{
 			GOJO_LOG_FATAL("GLFW", "Initialization failed!");
@@ -105,13 +169,19 @@ namespace GojoEngine
 		glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
 
 		mInitialized = true;
+
+		if (mHeadless)
+		{
+			GOJO_LOG_INFO("WindowManager", "Running headless on the GLFW null platform");
+		}
 	}
 
 	WindowManager::~WindowManager()
 	{
 		CloseAllWindows();
 		CleanupClosedWindows();
-		mWindows.clear();
+		mWindows.Clear();
+		GetWindowsAliveMetric().Set(0.0);
 
 		if (mInitialized)
 		{
@@ -2,9 +2,10 @@
 
 #include "Managers/WindowManager/Window/Window.h"
 #include "Managers/Manager.h"	
-#include <unordered_map>
+#include "Core/Containers/SlotMap.h"
 #include <memory>
 #include <expected>
+#include <chrono>
 
 namespace GojoEngine
 {
@@ -19,6 +20,15 @@ namespace GojoEngine
 		CreationFailed
 	};
 
+	// ====================================================================================================
+	// Window manager settings
+	// ====================================================================================================
+
+	struct WindowManagerSettings
+	{
+		bool Headless{ false };							// GLFW null platform: no display needed, windows are never shown
+	};
+
 	// ====================================================================================================
 	// Window manager
 	// ====================================================================================================
@@ -29,21 +39,35 @@ namespace GojoEngine
 
 	public:
 		[[nodiscard]] std::expected<WindowId, WindowError> CreateWindow(const WindowSettings& settings);
-		[[nodiscard]] std::shared_ptr<Window> GetWindowById(WindowId id) const;
+		// @brief nullptr once the window was erased. Owned by the manager, do not keep it across frames.
+		[[nodiscard]] Window* GetWindowById(WindowId id) const;
 		[[nodiscard]] bool AreAllWindowsClosed() const;
 
+		// @brief True if no window has the focus or every window is minimized (nothing to present).
+		[[nodiscard]] bool AreAllWindowsInactive() const;
+
 		void OnUpdate();
+		void PollEvents();
+
+		// @brief Blocks until an OS event arrives or "timeout" elapsed, then processes the events like PollEvents().
+		void WaitEvents(std::chrono::milliseconds timeout);
+
+		// @brief Wakes up a WaitEvents() call from any thread.
+		void WakeUp();
+
 		void CloseAllWindows();
 		void CleanupClosedWindows();
 
+		[[nodiscard]] bool IsHeadless() const { return mHeadless; }
+
 	private:
-		WindowManager();
+		explicit WindowManager(const WindowManagerSettings& settings = {});
 		~WindowManager();
 
 	private:
-		std::unordered_map<WindowId, std::shared_ptr<Window>> mWindows;
+		SlotMap<std::unique_ptr<Window>, Window> mWindows;	// Windows hand "this" to GLFW, the map moves pointers only
 		bool mInitialized{ false };
-		uint16_t mWindowCounter{ 0 };
+		bool mHeadless{ false };
 	};
 
 }
\ No newline at end of file
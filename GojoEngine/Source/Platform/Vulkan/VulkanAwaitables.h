@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Core/Coroutines/TaskScheduler.h"
+
+#include <vulkan/vulkan.h>
+
+namespace GojoEngine
+{
+	// ====================================================================================================
+	// Vulkan Awaitables
+	// ====================================================================================================
+
+	// @brief Continues the coroutine on the main thread at the first frame boundary after "fence" was signaled
+	//        (or the device was lost, vkGetFenceStatus reports it to the resumed code).
+	[[nodiscard]] inline auto WaitForFence(VkDevice device, VkFence fence)
+	{
+		return WaitUntil([device, fence]() { return vkGetFenceStatus(device, fence) != VK_NOT_READY; });
+	}
+}
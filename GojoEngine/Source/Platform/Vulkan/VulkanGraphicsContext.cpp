@@ -1,5 +1,7 @@
 #include "Platform/Vulkan/VulkanGraphicsContext.h"
 #include "Managers/LogManager/LogManager.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiler/Profiler.h"
 
 #include <vulkan/vulkan.h>
 #include <VkBootstrap.h>
@@ -13,6 +15,42 @@ namespace GojoEngine
 	constexpr bool gUseValidationLayers = false;
 #endif
 
+	// Host memory of the loader, layers and driver is accounted to MemoryTag::Vulkan
+	static MemorySite gVulkanMemorySite{ MemoryTag::Vulkan, "Vulkan host memory", 0 };
+
+	// The callbacks are called from C code: failures are reported with nullptr, never with an exception
+	static VKAPI_ATTR void* VKAPI_CALL VulkanAllocate(void*, size_t size, size_t alignment, VkSystemAllocationScope) noexcept
+	{
+		try
+		{
+			return MemoryTracker::Allocate(size, alignment, gVulkanMemorySite);
+		}
+		catch (const std::bad_alloc&)
+		{
+			return nullptr;
+		}
+	}
+
+	// On failure "original" is left untouched, as Vulkan expects
+	static VKAPI_ATTR void* VKAPI_CALL VulkanReallocate(void*, void* original, size_t size, size_t alignment, VkSystemAllocationScope) noexcept
+	{
+		try
+		{
+			return MemoryTracker::Reallocate(original, size, alignment, gVulkanMemorySite);
+		}
+		catch (const std::bad_alloc&)
+		{
+			return nullptr;
+		}
+	}
+
+	static VKAPI_ATTR void VKAPI_CALL VulkanFree(void*, void* memory) noexcept
+	{
+		MemoryTracker::Free(memory);
+	}
+
+	static VkAllocationCallbacks gVulkanAllocationCallbacks{ nullptr, VulkanAllocate, VulkanReallocate, VulkanFree, nullptr, nullptr };
+
 	static VKAPI_ATTR VkBool32 VKAPI_CALL VulkanDebugCallback(
 		VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
 		VkDebugUtilsMessageTypeFlagsEXT messageType,
@@ -24,21 +62,23 @@ namespace GojoEngine
 		else if (messageType & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT) typePrefix = "[Validation]";
 		else if (messageType & VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT) typePrefix = "[Performance]";
 
+		// The layers can report the same message thousands of times per frame: errors and warnings are
+		// collapsed into "repeated K times" summaries, the chatty severities are rate limited
 		if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT)
 		{
-			GOJO_LOG_ERROR("Vulkan", "{} {}", typePrefix, pCallbackData->pMessage);
+			GOJO_LOG_ERROR_DEDUP("Vulkan", "{} {}", typePrefix, pCallbackData->pMessage);
 		}
 		else if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT)
 		{
-			GOJO_LOG_WARNING("Vulkan", "{} {}", typePrefix, pCallbackData->pMessage);
+			GOJO_LOG_WARNING_DEDUP("Vulkan", "{} {}", typePrefix, pCallbackData->pMessage);
 		}
 		else if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT)
 		{
-			GOJO_LOG_INFO("Vulkan", "{} {}", typePrefix, pCallbackData->pMessage);
+			GOJO_LOG_INFO_RATE_LIMITED("Vulkan", 20, "{} {}", typePrefix, pCallbackData->pMessage);
 		}
 		else if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT)
 		{
-			GOJO_LOG_TRACE("Vulkan", "{} {}", typePrefix, pCallbackData->pMessage);
+			GOJO_LOG_TRACE_RATE_LIMITED("Vulkan", 20, "{} {}", typePrefix, pCallbackData->pMessage);
 		}
 
 		return VK_FALSE;
@@ -47,7 +87,10 @@ namespace GojoEngine
 	class VulkanGraphicsContext::Impl
 	{
 	public:
-		Impl() = default;
+		explicit Impl(const VulkanContextSettings& settings)
+			: mSettings(settings)
+		{
+		}
 
 		~Impl()
 		{
@@ -64,14 +107,18 @@ namespace GojoEngine
 			GOJO_ASSERT_MESSAGE(mInstance == VK_NULL_HANDLE, "Vulkan Instance already initialized!");
 
 			GOJO_LOG_INFO("Vulkan", "Initializing Vulkan Graphics Context...");
+			GOJO_PROFILE_SCOPE("VulkanGraphicsContext::StartUp");
 
 			/* VK INSTANCE */
+			GOJO_PROFILE_SCOPE("vkCreateInstance");
 			vkb::InstanceBuilder instanceBuilder;
 			auto instanceResult = instanceBuilder
 				.set_app_name("GojoEngine")
+				.set_headless(mSettings.Headless)
 				.set_engine_name("GojoEngine")
 				.request_validation_layers(gUseValidationLayers)
 				.set_debug_callback(VulkanDebugCallback)
+				.set_allocation_callbacks(&gVulkanAllocationCallbacks)
 				.require_api_version(1, 4, 0)
 				.build();
 
@@ -95,6 +142,8 @@ namespace GojoEngine
 			}
 
 			GOJO_LOG_INFO("Vulkan", "Vulkan Instance created successfully.");
+
+			SelectPhysicalDevice(vkbInstance);
 		}
 
 		void ShutDown()
@@ -106,6 +155,7 @@ namespace GojoEngine
 			}
 
 			GOJO_LOG_INFO("Vulkan", "Shutting down Vulkan Graphics Context...");
+			GOJO_PROFILE_SCOPE("VulkanGraphicsContext::ShutDown");
 
 			/* SHUTDOWN DEBUG MESSENGER */
 			if (mDebugMessenger != VK_NULL_HANDLE)
@@ -113,7 +163,8 @@ namespace GojoEngine
 				auto func = (PFN_vkDestroyDebugUtilsMessengerEXT)vkGetInstanceProcAddr(mInstance, "vkDestroyDebugUtilsMessengerEXT");
 				if (func != nullptr)
 				{
-					func(mInstance, mDebugMessenger, nullptr);
+					GOJO_PROFILE_SCOPE("vkDestroyDebugUtilsMessengerEXT");
+					func(mInstance, mDebugMessenger, &gVulkanAllocationCallbacks);
 					GOJO_LOG_INFO("Vulkan", "Vulkan Debug Messenger ShutDown complete!");
 				}
 				else
@@ -124,20 +175,58 @@ namespace GojoEngine
 			}
 
 			/* SHUTDOWN INSTANCE */
-			vkDestroyInstance(mInstance, nullptr);
+			{
+				GOJO_PROFILE_SCOPE("vkDestroyInstance");
+				vkDestroyInstance(mInstance, &gVulkanAllocationCallbacks);
+			}
 			mInstance = VK_NULL_HANDLE;
+			mPhysicalDevice = VK_NULL_HANDLE;
 			GOJO_LOG_INFO("Vulkan", "Vulkan Instance ShutDown complete!");
 
 			GOJO_LOG_INFO("Vulkan", "Vulkan resources released.");
 		}
 
 	private:
+		void SelectPhysicalDevice(const vkb::Instance& vkbInstance)
+		{
+			GOJO_PROFILE_SCOPE("SelectPhysicalDevice");
+
+			// Surfaces come later (and never when headless). Headless runs prefer a software implementation
+			// such as lavapipe, so machines without a GPU behave the same on every run
+			vkb::PhysicalDeviceSelector selector(vkbInstance);
+			auto deviceResult = selector
+				.prefer_gpu_device_type(mSettings.Headless ? vkb::PreferredDeviceType::cpu : vkb::PreferredDeviceType::discrete)
+				.allow_any_gpu_device_type(true)
+				.defer_surface_initialization()
+				.select();
+
+			if (!deviceResult)
+			{
+				GOJO_LOG_ERROR("Vulkan", "No suitable physical device! Error: {}", deviceResult.error().message());
+				return;
+			}
+
+			const vkb::PhysicalDevice& device = deviceResult.value();
+			mPhysicalDevice = device.physical_device;
+
+			const bool isSoftware = device.properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU;
+			GOJO_LOG_INFO("Vulkan", "Selected physical device '{}' ({})", device.name, isSoftware ? "software" : "hardware");
+
+			if (mSettings.Headless && !isSoftware)
+			{
+				GOJO_LOG_INFO("Vulkan", "No software Vulkan implementation found, the headless run uses a hardware device");
+			}
+		}
+
+	private:
+		VulkanContextSettings mSettings;
 		VkInstance mInstance{ VK_NULL_HANDLE };
+		VkPhysicalDevice mPhysicalDevice{ VK_NULL_HANDLE };
 		VkDebugUtilsMessengerEXT mDebugMessenger{ VK_NULL_HANDLE };
 	};
 
-	VulkanGraphicsContext::VulkanGraphicsContext()
-		: pImpl(std::make_unique<Impl>())
+	VulkanGraphicsContext::VulkanGraphicsContext(const VulkanContextSettings& settings)
+		: pImpl(std::make_unique<Impl>(settings))
 	{
 	}
 
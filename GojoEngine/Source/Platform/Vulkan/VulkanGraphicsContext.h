@@ -7,10 +7,15 @@
 
 namespace GojoEngine
 {
+	struct VulkanContextSettings
+	{
+		bool Headless{ false };							// No surface extensions, a CPU implementation (lavapipe) is preferred
+	};
+
 	class GOJO_API VulkanGraphicsContext final : public NonCopyable
 	{
 	public:
-		explicit VulkanGraphicsContext();
+		explicit VulkanGraphicsContext(const VulkanContextSettings& settings = {});
 		~VulkanGraphicsContext();
 
 		void StartUp();
@@ -0,0 +1,74 @@
+#include <Core/MappedFile.h>
+#include <Managers/FlightRecorder/FlightRecordFormat.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+
+using namespace GojoEngine;
+
+// ====================================================================================================
+// Decoder
+// ====================================================================================================
+
+/**
+ * Offline decoder of the region files written by the flight recorder (FlightRecorderSettings::Directory).
+ *
+ *     FlightRecordDecoder <FlightRecorder.gjfr or FlightRecorder.previous.gjfr>...
+ *
+ * Prints the time-sorted records of every file, the same text as FlightRecorder::Dump().
+ */
+namespace
+{
+	// @return False if "path" is not a flight recorder region.
+	bool DecodeRegion(const std::filesystem::path& path)
+	{
+		MappedFile file;
+		if (!file.Open(path, MappedFile::Access::ReadOnly))
+		{
+			std::fprintf(stderr, "'%s' cannot be mapped\n", path.string().c_str());
+			return false;
+		}
+
+		std::string text;
+		if (!FormatFlightRecord(std::span<const std::byte>(file.GetData(), file.GetSize()), path.filename().string(), text))
+		{
+			std::fprintf(stderr, "'%s' is not a version %u flight record\n", path.string().c_str(), cFlightRecordVersion);
+			return false;
+		}
+
+		std::fwrite(text.data(), 1, text.size(), stdout);
+		return true;
+	}
+
+	void PrintUsage()
+	{
+		std::fputs("Usage: FlightRecordDecoder <region file>...\n"
+			"  Region files are named FlightRecorder.gjfr (current or last run) and FlightRecorder.previous.gjfr\n", stderr);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	int failedCount = 0;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view argument = argv[i];
+		if (argument.starts_with("--"))
+		{
+			PrintUsage();
+			return 1;
+		}
+
+		failedCount += DecodeRegion(argument) ? 0 : 1;
+	}
+	return failedCount;
+}
@@ -0,0 +1,101 @@
+#include "TestFramework.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+#include <crtdbg.h>
+#endif
+
+// Replaces the global operator new/delete of the test executable, so tests can check that a code path does
+// not allocate at all, whatever container, delegate or queue node it goes through. A DLL keeps its own
+// operator new: debug MSVC builds count at the shared debug CRT heap instead, which every module goes through.
+
+namespace
+{
+	std::atomic<uint64_t> sAllocationCount{ 0 };
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+	constexpr bool cCountsCrtHeap = true;
+
+	int CountCrtAllocation(int allocationType, void*, size_t, int blockType, long, const unsigned char*, int)
+	{
+		if ((allocationType == _HOOK_ALLOC || allocationType == _HOOK_REALLOC) && blockType != _CRT_BLOCK)
+		{
+			sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		return TRUE;
+	}
+
+	const bool sIsCrtHookInstalled = (_CrtSetAllocHook(&CountCrtAllocation), true);
+#else
+	constexpr bool cCountsCrtHeap = false;
+#endif
+
+	void* AllocateCounted(std::size_t size, std::size_t alignment)
+	{
+		if constexpr (!cCountsCrtHeap)
+		{
+			sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		size = size > 0 ? size : 1;
+
+		void* block = nullptr;
+		if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			block = std::malloc(size);
+		}
+		else
+		{
+#if defined(_MSC_VER)
+			block = _aligned_malloc(size, alignment);
+#else
+			block = std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+		}
+
+		if (!block)
+			throw std::bad_alloc();
+		return block;
+	}
+
+	void FreeCounted(void* block, std::size_t alignment)
+	{
+#if defined(_MSC_VER)
+		if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			_aligned_free(block);
+			return;
+		}
+#endif
+		(void)alignment;
+		std::free(block);
+	}
+}
+
+namespace GojoTests
+{
+	uint64_t GetAllocationCount()
+	{
+		return sAllocationCount.load(std::memory_order_relaxed);
+	}
+}
+
+// ====================================================================================================
+// Replaced Global Allocation Functions
+// ====================================================================================================
+
+void* operator new(std::size_t size) { return AllocateCounted(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size) { return AllocateCounted(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return AllocateCounted(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return AllocateCounted(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void* block) noexcept { FreeCounted(block, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void* block) noexcept { FreeCounted(block, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete(void* block, std::size_t) noexcept { FreeCounted(block, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void* block, std::size_t) noexcept { FreeCounted(block, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete(void* block, std::align_val_t alignment) noexcept { FreeCounted(block, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* block, std::align_val_t alignment) noexcept { FreeCounted(block, static_cast<std::size_t>(alignment)); }
+void operator delete(void* block, std::size_t, std::align_val_t alignment) noexcept { FreeCounted(block, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* block, std::size_t, std::align_val_t alignment) noexcept { FreeCounted(block, static_cast<std::size_t>(alignment)); }
@@ -0,0 +1,136 @@
+#include "TestFramework.h"
+
+#include <Core/Profiler/Profiler.h>
+#include <Managers/LogManager/LogManager.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	// ====================================================================================================
+	// Registry
+	// ====================================================================================================
+
+	struct TestCase
+	{
+		std::string_view Name;
+		GojoTests::TestKind Kind;
+		GojoTests::TestFunction Function;
+	};
+
+	// @brief Function-local so registration works regardless of static initialization order.
+	std::vector<TestCase>& GetTestCases()
+	{
+		static std::vector<TestCase> sTestCases;
+		return sTestCases;
+	}
+
+	uint32_t sRunningTestFailures = 0;
+
+	void PrintUsage()
+	{
+		std::fprintf(stderr,
+			"Usage: GojoTests [--bench] [filter]\n"
+			"  Runs the unit tests (or the benchmarks with --bench) whose name contains \"filter\".\n"
+			"  Returns the number of failed tests.\n");
+	}
+}
+
+namespace GojoTests
+{
+	bool RegisterTest(std::string_view name, TestKind kind, TestFunction function)
+	{
+		GetTestCases().push_back(TestCase{ name, kind, function });
+		return true;
+	}
+
+	void ReportFailure(const char* expression, const char* file, int line)
+	{
+		++sRunningTestFailures;
+		std::fprintf(stderr, "  %s(%d): check failed: %s\n", file, line, expression);
+	}
+
+	LogSettings GetTestLogSettings()
+	{
+		// Synchronous logging keeps engine messages next to the test that caused them
+		LogSettings settings;
+		settings.Mode = LogMode::Synchronous;
+		settings.ConsoleLevel = LogLevel::Error;
+		return settings;
+	}
+
+	void ReportMeasurement(std::string_view name, double value, std::string_view unit)
+	{
+		std::printf("  %-48.*s %14.2f %.*s\n", static_cast<int>(name.size()), name.data(), value, static_cast<int>(unit.size()), unit.data());
+	}
+}
+
+// ====================================================================================================
+// Entry Point
+// ====================================================================================================
+
+int main(int argc, char** argv)
+{
+	GojoTests::TestKind kind = GojoTests::TestKind::Test;
+	std::string_view filter;
+	for (int index = 1; index < argc; ++index)
+	{
+		const std::string_view argument = argv[index];
+		if (argument == "--bench")
+		{
+			kind = GojoTests::TestKind::Benchmark;
+		}
+		else if (argument == "--help" || argument.starts_with("--"))
+		{
+			PrintUsage();
+			return argument == "--help" ? 0 : 1;
+		}
+		else
+		{
+			filter = argument;
+		}
+	}
+
+	LogManager::StartUp(GojoTests::GetTestLogSettings());
+
+	std::vector<TestCase> testCases = GetTestCases();
+	std::ranges::sort(testCases, {}, &TestCase::Name);
+
+	uint32_t runCount = 0;
+	std::vector<std::string_view> failedTests;
+	for (const TestCase& testCase : testCases)
+	{
+		if (testCase.Kind != kind || !testCase.Name.contains(filter))
+			continue;
+
+		std::printf("[ RUN    ] %.*s\n", static_cast<int>(testCase.Name.size()), testCase.Name.data());
+		std::fflush(stdout);
+
+		sRunningTestFailures = 0;
+		const double seconds = GojoTests::MeasureSeconds(testCase.Function);
+		++runCount;
+
+		if (sRunningTestFailures > 0)
+		{
+			failedTests.push_back(testCase.Name);
+		}
+		std::printf("[ %s ] %.*s (%.1f ms)\n", sRunningTestFailures > 0 ? "FAILED" : "    OK", static_cast<int>(testCase.Name.size()), testCase.Name.data(), seconds * 1000.0);
+	}
+
+	std::printf("%u run, %zu failed\n", runCount, failedTests.size());
+	for (std::string_view name : failedTests)
+	{
+		std::printf("  FAILED: %.*s\n", static_cast<int>(name.size()), name.data());
+	}
+
+	// Like the engine shutdown: the thread buffers of the profiler go once no thread records anymore
+	LogManager::ShutDown();
+	Profiler::ReleaseMemory();
+	return static_cast<int>(failedTests.size());
+}
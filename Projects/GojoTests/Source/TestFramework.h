@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Managers/LogManager/LogManager.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+namespace GojoTests
+{
+	// ====================================================================================================
+	// Test Registration
+	// ====================================================================================================
+
+	using TestFunction = void(*)();
+
+	enum class TestKind : uint8_t
+	{
+		Test,			// Checks behaviour, run by default and by CTest
+		Benchmark		// Prints measurements, run with --bench
+	};
+
+	// @brief Adds a test to the run, called by GOJO_TEST / GOJO_BENCHMARK during static initialization.
+	bool RegisterTest(std::string_view name, TestKind kind, TestFunction function);
+
+	// @brief Marks the running test as failed and prints the failed expression.
+	void ReportFailure(const char* expression, const char* file, int line);
+
+	// @brief Prints one benchmark result: "<name> <value> <unit>".
+	void ReportMeasurement(std::string_view name, double value, std::string_view unit);
+
+	// @brief Calls of the global operator new so far, from any thread (see AllocationCounter.cpp).
+	uint64_t GetAllocationCount();
+
+	// @brief Settings the runner starts the LogManager with, tests that restart it restore them.
+	GojoEngine::LogSettings GetTestLogSettings();
+
+	// @brief Wall-clock seconds taken by "function".
+	template<typename FunctionT>
+	double MeasureSeconds(FunctionT&& function)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		function();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+// ====================================================================================================
+// Test Macros
+// ====================================================================================================
+
+#define GOJO_TEST_CASE(name, kind)																\
+	static void name();																			\
+	static const bool s##name##Registered = ::GojoTests::RegisterTest(#name, kind, &name);		\
+	static void name()
+
+#define GOJO_TEST(name)			GOJO_TEST_CASE(name, ::GojoTests::TestKind::Test)
+#define GOJO_BENCHMARK(name)	GOJO_TEST_CASE(name, ::GojoTests::TestKind::Benchmark)
+
+// @brief Unlike assertions, a failed check is reported and the test keeps running.
+#define GOJO_CHECK(expression)															\
+	do																					\
+	{																					\
+		if (!(expression))																\
+		{																				\
+			::GojoTests::ReportFailure(#expression, __FILE__, __LINE__);				\
+		}																				\
+	} while (false)
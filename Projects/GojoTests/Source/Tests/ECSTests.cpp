@@ -0,0 +1,398 @@
+#include "TestFramework.h"
+
+#include <ECS/CommandBuffer.h>
+#include <ECS/Query.h>
+#include <ECS/SystemScheduler.h>
+#include <ECS/World.h>
+#include <Managers/JobSystem/JobSystem.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	constexpr uint32_t cTestWorkerCount = 3;
+
+	struct TestPosition
+	{
+		float X{ 0.0f };
+		float Y{ 0.0f };
+	};
+
+	struct TestVelocity
+	{
+		float X{ 0.0f };
+		float Y{ 0.0f };
+	};
+
+	struct TestValue
+	{
+		uint32_t Value{ 0 };
+	};
+
+	// @brief Not trivially movable, checks that components are moved and destroyed exactly once.
+	struct TestOwned
+	{
+		std::unique_ptr<uint32_t> Value;
+	};
+
+	struct TestThreadIndex
+	{
+		uint32_t Index{ 0 };
+	};
+
+	// @brief The "typical" component pair of the benchmarks: 8 bytes each, trivially copyable.
+	void PopulateMovers(World& world, uint32_t entityCount)
+	{
+		world.Reserve(entityCount);
+		for (uint32_t index = 0; index < entityCount; ++index)
+		{
+			world.CreateEntity(TestPosition{}, TestVelocity{ 1.0f, static_cast<float>(index % 7) });
+		}
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(ComponentTypeIdsAreStableAndDense)
+{
+	const ComponentTypeId position = GetComponentTypeId<TestPosition>();
+	GOJO_CHECK(position != cInvalidComponentTypeId);
+	GOJO_CHECK(position == GetComponentTypeId<const TestPosition>());
+	GOJO_CHECK(position != GetComponentTypeId<TestVelocity>());
+	GOJO_CHECK(GetComponentTypeId<TestVelocity>() < ComponentTypeRegistry::GetCount());
+
+	// Registering the same type again, as another module would, yields the same id
+	GOJO_CHECK(ComponentTypeRegistry::Register(MakeComponentTypeInfo<TestPosition>()) == position);
+	GOJO_CHECK(ComponentTypeRegistry::GetInfo(position).Size == sizeof(TestPosition));
+	GOJO_CHECK(ComponentTypeRegistry::GetInfo(position).Name.ends_with("TestPosition"));
+}
+
+GOJO_TEST(EntitiesMoveBetweenArchetypesWithTheirComponents)
+{
+	World world;
+	std::vector<Entity> entities;
+	for (uint32_t index = 0; index < 1000; ++index)
+	{
+		entities.push_back(world.CreateEntity(TestValue{ index }, TestOwned{ std::make_unique<uint32_t>(index) }));
+	}
+
+	// Moves every other entity into another archetype and back out of the middle of its chunks
+	for (uint32_t index = 0; index < 1000; index += 2)
+	{
+		GOJO_CHECK(world.AddComponent<TestPosition>(entities[index], TestPosition{ 1.0f, 2.0f }) != nullptr);
+	}
+	for (uint32_t index = 0; index < 1000; index += 4)
+	{
+		GOJO_CHECK(world.RemoveComponent<TestValue>(entities[index]));
+		GOJO_CHECK(!world.RemoveComponent<TestValue>(entities[index]));
+	}
+	GOJO_CHECK(world.DestroyEntity(entities[1]));
+	GOJO_CHECK(!world.DestroyEntity(entities[1]));
+	GOJO_CHECK(!world.IsAlive(entities[1]));
+	GOJO_CHECK(world.GetComponent<TestValue>(entities[1]) == nullptr);
+	GOJO_CHECK(world.GetEntityCount() == 999);
+
+	bool isIntact = true;
+	for (uint32_t index = 2; index < 1000; ++index)
+	{
+		const TestOwned* owned = world.GetComponent<TestOwned>(entities[index]);
+		isIntact &= owned && owned->Value && *owned->Value == index;
+		isIntact &= world.HasComponent<TestPosition>(entities[index]) == (index % 2 == 0);
+		isIntact &= world.HasComponent<TestValue>(entities[index]) == (index % 4 != 0);
+		isIntact &= index % 4 == 0 || world.GetComponent<TestValue>(entities[index])->Value == index;
+	}
+	GOJO_CHECK(isIntact);
+
+	// Adding a component the entity has replaces its value
+	world.AddComponent<TestOwned>(entities[2], TestOwned{ std::make_unique<uint32_t>(42u) });
+	GOJO_CHECK(*world.GetComponent<TestOwned>(entities[2])->Value == 42);
+}
+
+GOJO_TEST(QueriesVisitEveryMatchingEntityOnce)
+{
+	World world;
+	PopulateMovers(world, 5000);
+	for (uint32_t index = 0; index < 1000; ++index)
+	{
+		world.CreateEntity(TestPosition{}, TestVelocity{ 1.0f, 0.0f }, TestValue{ index });
+		world.CreateEntity(TestPosition{});
+	}
+
+	Query<TestPosition, const TestVelocity> movers(world);
+	GOJO_CHECK(movers.GetEntityCount() == 6000);
+	GOJO_CHECK(movers.GetWriteMask() == MakeComponentMask<TestPosition>());
+	GOJO_CHECK(movers.GetReadMask() == MakeComponentMask<TestVelocity>());
+
+	movers.ForEach([](TestPosition& position, const TestVelocity& velocity) { position.X += velocity.X; });
+
+	size_t chunkEntityCount = 0;
+	movers.ForEachChunk([&chunkEntityCount](std::span<const Entity> entities, std::span<TestPosition> positions, std::span<const TestVelocity> velocities)
+		{
+			GOJO_CHECK(entities.size() == positions.size() && positions.size() == velocities.size());
+			for (size_t index = 0; index < positions.size(); ++index)
+			{
+				positions[index].X += velocities[index].X;
+			}
+			chunkEntityCount += entities.size();
+		});
+	GOJO_CHECK(chunkEntityCount == 6000);
+
+	JobSystem::StartUp(JobSystemSettings{ .WorkerCount = cTestWorkerCount });
+	std::atomic<uint32_t> parallelCount{ 0 };
+	movers.ParallelForEach([&world, &parallelCount](Entity entity, TestPosition& position, const TestVelocity& velocity)
+		{
+			GOJO_CHECK(world.IsStructureLocked() && world.IsAlive(entity));
+			position.X += velocity.X;
+			parallelCount.fetch_add(1, std::memory_order_relaxed);
+		});
+	JobSystem::ShutDown();
+	GOJO_CHECK(parallelCount.load() == 6000);
+	GOJO_CHECK(!world.IsStructureLocked());
+
+	// Archetypes created after the first run are picked up
+	world.CreateEntity(TestPosition{}, TestVelocity{ 1.0f, 0.0f }, TestOwned{});
+	bool isThreeEverywhere = true;
+	size_t count = 0;
+	movers.ForEach([&](TestPosition& position, const TestVelocity&)
+		{
+			isThreeEverywhere &= count++ == 6000 || position.X == 3.0f;
+		});
+	GOJO_CHECK(count == 6001);
+	GOJO_CHECK(isThreeEverywhere);
+}
+
+GOJO_TEST(CommandBufferPlaceholdersResolveToTheCreatedEntities)
+{
+	World world;
+	const Entity existing = world.CreateEntity(TestValue{ 1 });
+	const Entity destroyed = world.CreateEntity(TestValue{ 2 });
+
+	CommandBuffer commands;
+	const Entity created = commands.CreateEntity();
+	GOJO_CHECK(CommandBuffer::IsPlaceholder(created));
+	GOJO_CHECK(!world.IsAlive(created));
+	commands.AddComponent<TestValue>(created, 10u);
+	commands.AddComponent<TestOwned>(created, std::make_unique<uint32_t>(11u));
+	commands.AddComponent<TestPosition>(existing, 3.0f, 4.0f);
+	commands.RemoveComponent<TestValue>(existing);
+	commands.DestroyEntity(destroyed);
+	commands.AddComponent<TestOwned>(destroyed, std::make_unique<uint32_t>(12u));	// Skipped, dead by then
+	GOJO_CHECK(commands.GetCommandCount() == 7);
+
+	// Placeholders only resolve once they were played back
+	GOJO_CHECK(!commands.Resolve(created).IsValid());
+	commands.Playback(world);
+	GOJO_CHECK(commands.IsEmpty());
+
+	const Entity entity = commands.Resolve(created);
+	GOJO_CHECK(world.IsAlive(entity));
+	GOJO_CHECK(world.GetComponent<TestValue>(entity)->Value == 10);
+	GOJO_CHECK(*world.GetComponent<TestOwned>(entity)->Value == 11);
+	GOJO_CHECK(world.GetComponent<TestPosition>(existing)->Y == 4.0f);
+	GOJO_CHECK(!world.HasComponent<TestValue>(existing));
+	GOJO_CHECK(!world.IsAlive(destroyed));
+	GOJO_CHECK(commands.Resolve(existing) == existing);
+
+	// A new recording stamps a new epoch: the next playback replaces the mapping, the old placeholder goes stale
+	const Entity next = commands.CreateEntity();
+	GOJO_CHECK(next != created);
+	commands.Playback(world);
+	GOJO_CHECK(commands.Resolve(created) == Entity{});
+	GOJO_CHECK(world.IsAlive(commands.Resolve(next)) && commands.Resolve(next) != entity);
+
+	// Cleared commands are dropped with their payloads, their placeholders never resolve
+	const Entity dropped = commands.CreateEntity();
+	commands.AddComponent<TestOwned>(dropped, std::make_unique<uint32_t>(13u));
+	commands.Clear();
+	commands.Playback(world);
+	GOJO_CHECK(!commands.Resolve(dropped).IsValid());
+	GOJO_CHECK(world.GetEntityCount() == 3);
+
+	// Placeholders of one buffer mean nothing to another
+	CommandBuffer other;
+	GOJO_CHECK(other.CreateEntity() != commands.CreateEntity());
+}
+
+GOJO_TEST(ThreadCommandBuffersRecordOnEveryWorker)
+{
+	JobSystem::StartUp(JobSystemSettings{ .WorkerCount = cTestWorkerCount });
+	{
+		World world;
+		PopulateMovers(world, 10000);
+
+		ThreadCommandBuffers commands;
+		GOJO_CHECK(commands.GetThreadCount() == cTestWorkerCount + 1);
+
+		Query<const TestPosition> positions(world);
+		positions.ParallelForEach([&commands](Entity entity, const TestPosition&)
+			{
+				const uint32_t threadIndex = JobSystem::GetCurrentThreadIndex();
+				commands.GetLocal().AddComponent<TestThreadIndex>(entity, threadIndex);
+				commands.GetLocal().AddComponent<TestValue>(commands.GetLocal().CreateEntity(), threadIndex);
+			});
+		GOJO_CHECK(commands.GetCommandCount() == 30000);
+
+		commands.Playback(world);
+		GOJO_CHECK(commands.IsEmpty());
+		GOJO_CHECK(world.GetEntityCount() == 20000);
+
+		// Every command was applied once, whichever thread recorded it
+		Query<const TestThreadIndex> tagged(world);
+		Query<const TestValue> created(world);
+		GOJO_CHECK(tagged.GetEntityCount() == 10000);
+		GOJO_CHECK(created.GetEntityCount() == 10000);
+
+		bool isKnownThread = true;
+		tagged.ForEach([&isKnownThread](const TestThreadIndex& tag) { isKnownThread &= tag.Index <= cTestWorkerCount; });
+		GOJO_CHECK(isKnownThread);
+	}
+	JobSystem::ShutDown();
+}
+
+GOJO_TEST(SystemCommandsPlayBackInRegistrationOrder)
+{
+	JobSystem::StartUp(JobSystemSettings{ .WorkerCount = cTestWorkerCount });
+	{
+		World world;
+		const Entity target = world.CreateEntity(TestValue{ 0 });
+		PopulateMovers(world, 2000);
+
+		Query<TestPosition, const TestVelocity> movers(world);
+		Entity spawned;
+		Entity spawnedEntity;
+
+		SystemScheduler scheduler;
+		scheduler.AddSystem("TestFirst", SystemAccess::Of<const TestValue>(), [target, &spawned, &spawnedEntity](World&, ThreadCommandBuffers& commands)
+			{
+				// The entity spawned by the previous run is known now
+				if (spawned.IsValid())
+				{
+					spawnedEntity = commands.Resolve(spawned);
+				}
+				commands.GetLocal().AddComponent<TestValue>(target, 1u);
+				spawned = commands.GetLocal().CreateEntity();
+			});
+		scheduler.AddSystem("TestMove", SystemAccess::Of<TestPosition, const TestVelocity>(), [&movers](World&, ThreadCommandBuffers& commands)
+			{
+				movers.ParallelForEach([&commands](Entity entity, TestPosition& position, const TestVelocity& velocity)
+					{
+						position.X += velocity.X;
+						if (velocity.Y == 0.0f)
+						{
+							commands.GetLocal().AddComponent<TestValue>(entity, 3u);
+						}
+					});
+			});
+		scheduler.AddSystem("TestLast", SystemAccess::Of<const TestValue>(), [target](World&, ThreadCommandBuffers& commands)
+			{
+				commands.GetLocal().AddComponent<TestValue>(target, 2u);
+			});
+		scheduler.AddSystem("TestExclusive", SystemAccess::Exclusive(), [target](World& world, ThreadCommandBuffers&)
+			{
+				GOJO_CHECK(!world.IsStructureLocked());
+				world.GetComponent<TestValue>(target)->Value += 100;
+			});
+		GOJO_CHECK(scheduler.GetBatchCount() == 2);
+
+		// The parallel systems finish in any order, their commands apply in registration order
+		for (uint32_t run = 1; run <= 20; ++run)
+		{
+			scheduler.Run(world);
+			GOJO_CHECK(world.GetComponent<TestValue>(target)->Value == 2);
+			GOJO_CHECK(world.GetEntityCount() == 2001 + run);
+			GOJO_CHECK(run == 1 || world.IsAlive(spawnedEntity));
+		}
+
+		Query<const TestValue, const TestVelocity> stopped(world);
+		GOJO_CHECK(stopped.GetEntityCount() == (2000 + 6) / 7);
+
+		bool isMoved = true;
+		movers.ForEach([&isMoved](const TestPosition& position, const TestVelocity&) { isMoved &= position.X == 20.0f; });
+		GOJO_CHECK(isMoved);
+
+		GOJO_CHECK(scheduler.GetSystemCount() == 4);
+	}
+	JobSystem::ShutDown();
+}
+
+// ====================================================================================================
+// Benchmarks
+// ====================================================================================================
+
+/**
+ * 100k entities with two components: creation straight into the world and through a command buffer,
+ * then one update pass per way of iterating. Reports the cost per entity.
+ */
+GOJO_BENCHMARK(ECSHundredThousandEntities)
+{
+	constexpr uint32_t cEntityCount = 100000;
+
+	World directWorld;
+	const double createSeconds = GojoTests::MeasureSeconds([&]() { PopulateMovers(directWorld, cEntityCount); });
+
+	World bufferedWorld;
+	CommandBuffer commands(cEntityCount * 2 * sizeof(TestPosition));
+	const double playbackSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			for (uint32_t index = 0; index < cEntityCount; ++index)
+			{
+				const Entity entity = commands.CreateEntity();
+				commands.AddComponent<TestPosition>(entity);
+				commands.AddComponent<TestVelocity>(entity, 1.0f, static_cast<float>(index % 7));
+			}
+			commands.Playback(bufferedWorld);
+		});
+	GOJO_CHECK(bufferedWorld.GetEntityCount() == cEntityCount);
+
+	Query<TestPosition, const TestVelocity> movers(directWorld);
+	const double forEachSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			movers.ForEach([](TestPosition& position, const TestVelocity& velocity)
+				{
+					position.X += velocity.X;
+					position.Y += velocity.Y;
+				});
+		});
+
+	const double chunkSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			movers.ForEachChunk([](std::span<const Entity>, std::span<TestPosition> positions, std::span<const TestVelocity> velocities)
+				{
+					for (size_t index = 0; index < positions.size(); ++index)
+					{
+						positions[index].X += velocities[index].X;
+						positions[index].Y += velocities[index].Y;
+					}
+				});
+		});
+
+	JobSystem::StartUp();
+	const double parallelSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			movers.ParallelForEach([](TestPosition& position, const TestVelocity& velocity)
+				{
+					position.X += velocity.X;
+					position.Y += velocity.Y;
+				});
+		});
+	JobSystem::ShutDown();
+
+	bool isUpdated = true;
+	movers.ForEach([&isUpdated](const TestPosition& position, const TestVelocity&) { isUpdated &= position.X == 3.0f; });
+	GOJO_CHECK(isUpdated);
+
+	GojoTests::ReportMeasurement("CreateEntity", createSeconds * 1e9 / cEntityCount, "ns/entity");
+	GojoTests::ReportMeasurement("CommandBufferCreateAndPlayback", playbackSeconds * 1e9 / cEntityCount, "ns/entity");
+	GojoTests::ReportMeasurement("QueryForEach", forEachSeconds * 1e9 / cEntityCount, "ns/entity");
+	GojoTests::ReportMeasurement("QueryForEachChunk", chunkSeconds * 1e9 / cEntityCount, "ns/entity");
+	GojoTests::ReportMeasurement("QueryParallelForEach", parallelSeconds * 1e9 / cEntityCount, "ns/entity");
+}
@@ -0,0 +1,93 @@
+#include "TestFramework.h"
+
+#include <Core/Engine.h>
+#include <Managers/EventManager/EventManager.h>
+#include <Managers/JobSystem/JobSystem.h>
+#include <Managers/LogManager/LogManager.h>
+#include <Managers/WindowManager/WindowManager.h>
+
+#include <chrono>
+#include <cstdint>
+
+using namespace GojoEngine;
+using namespace std::chrono_literals;
+
+namespace
+{
+	// @brief Hands the runner's LogManager over to the engine stages for the scope, then restarts it.
+	class ScopedEngineLogger final
+	{
+	public:
+		ScopedEngineLogger() { LogManager::ShutDown(); }
+		~ScopedEngineLogger() { LogManager::StartUp(GojoTests::GetTestLogSettings()); }
+	};
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(RunLimitsStopAtWhicheverComesFirst)
+{
+	const EngineRunLimits unlimited;
+	GOJO_CHECK(!unlimited.IsReached(UINT64_MAX, std::chrono::hours(24)));
+
+	const EngineRunLimits frames{ .MaxFrames = 3 };
+	GOJO_CHECK(!frames.IsReached(2, std::chrono::hours(24)));
+	GOJO_CHECK(frames.IsReached(3, 0s));
+
+	const EngineRunLimits duration{ .MaxDuration = 100ms };
+	GOJO_CHECK(!duration.IsReached(UINT64_MAX, 99ms));
+	GOJO_CHECK(duration.IsReached(0, 100ms));
+
+	const EngineRunLimits both{ .MaxFrames = 10, .MaxDuration = 100ms };
+	GOJO_CHECK(!both.IsReached(9, 99ms));
+	GOJO_CHECK(both.IsReached(10, 1ms));
+	GOJO_CHECK(both.IsReached(1, 101ms));
+}
+
+GOJO_TEST(StartUpWithAnInvalidGraphStartsNothing)
+{
+	bool clientStarted = false;
+
+	EngineSettings settings;
+	settings.AdditionalStages.push_back({ "Client", { "Renderer" }, StartupThread::Any, [&clientStarted]() { clientStarted = true; } });
+
+	const auto result = Engine::StartUp(settings);
+	GOJO_CHECK(!result && result.error() == StartupError::UnknownDependency);
+	GOJO_CHECK(!clientStarted);
+	GOJO_CHECK(!JobSystem::IsInitialized() && !EventManager::IsInitialized());
+	GOJO_CHECK(Engine::GetStartupTimings().empty());
+
+	// Neither touches the managers that were never created
+	Engine::Run();
+	Engine::ShutDown();
+}
+
+GOJO_TEST(HeadlessRunWithoutWindowsEndsOnTheFrameLimit)
+{
+	const ScopedEngineLogger engineLogger;
+
+	EngineSettings settings;
+	settings.Headless = true;
+	settings.RunLimits.MaxFrames = 5;
+	settings.FramePacing.TargetFrameRate = 0;
+
+	const auto result = Engine::StartUp(settings);
+	GOJO_CHECK(result.has_value());
+	if (!result)
+		return;
+
+	uint64_t updateCount = 0;
+	const PhaseCallbackId updateCallback = Engine::AddPhaseCallback(EnginePhase::Update, [&updateCount](const FrameTime&) { ++updateCount; });
+
+	// Without the headless flag a run with no window open would end before the first frame
+	GOJO_CHECK(Engine::IsHeadless());
+	GOJO_CHECK(WindowManager::GetInstance().AreAllWindowsClosed());
+	Engine::Run();
+	GOJO_CHECK(updateCount == settings.RunLimits.MaxFrames);
+
+	Engine::RemovePhaseCallback(updateCallback);
+	Engine::ShutDown();
+	GOJO_CHECK(!WindowManager::IsInitialized());
+}
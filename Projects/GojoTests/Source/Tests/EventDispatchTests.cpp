@@ -0,0 +1,179 @@
+#include "TestFramework.h"
+
+#include <Managers/EventManager/EventManager.h>
+#include <Managers/EventManager/Events/WindowEvents.h>
+
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	class TestPingEvent final : public Event
+	{
+	public:
+		TestPingEvent() = default;
+		explicit TestPingEvent(int value) : mValue(value) {}
+
+		[[nodiscard]] int GetValue() const { return mValue; }
+
+		EVENT_TYPE(TestPing, "TestPing: Value[{}]", mValue)
+
+	private:
+		int mValue{ 0 };
+	};
+
+	class TestPongEvent final : public Event
+	{
+	public:
+		EVENT_TYPE(TestPong, "TestPong")
+	};
+
+	// @brief Two client event classes of the same name in different namespaces.
+	namespace TestAudio
+	{
+		class TestAlarmEvent final : public Event
+		{
+		public:
+			EVENT_TYPE(TestAlarm, "TestAlarm: Volume[{}]", mVolume)
+
+			float mVolume{ 1.0f };
+		};
+	}
+
+	namespace TestClock
+	{
+		class TestAlarmEvent final : public Event
+		{
+		public:
+			EVENT_TYPE(TestAlarm, "TestAlarm: Hour[{}] Minute[{}]", mHour, mMinute)
+
+			uint64_t mHour{ 7 };
+			uint64_t mMinute{ 30 };
+		};
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(EventTypeIdsAreDenseAndResolvableByName)
+{
+	const EventTypeId pingId = GetEventTypeId<TestPingEvent>();
+	const EventTypeId pongId = GetEventTypeId<TestPongEvent>();
+
+	GOJO_CHECK(pingId != cInvalidEventTypeId);
+	GOJO_CHECK(pongId != cInvalidEventTypeId);
+	GOJO_CHECK(pingId != pongId);
+	GOJO_CHECK(pingId < EventTypeRegistry::GetCount() && pongId < EventTypeRegistry::GetCount());
+
+	GOJO_CHECK(EventTypeRegistry::Find(GetTypeName<TestPingEvent>()) == pingId);
+	GOJO_CHECK(EventTypeRegistry::GetName(pongId) == GetTypeName<TestPongEvent>());
+	GOJO_CHECK(EventTypeRegistry::GetName(pongId).ends_with("::TestPongEvent"));
+	GOJO_CHECK(EventTypeRegistry::Register(GetTypeName<TestPingEvent>()) == pingId);
+	GOJO_CHECK(EventTypeRegistry::Register(GetTypeName<TestPingEvent>(), MakeEventSerializer<TestPingEvent>()) == pingId);
+	GOJO_CHECK(TestPingEvent().GetTypeId() == pingId);
+}
+
+GOJO_TEST(EventsOfTheSameNameInDifferentNamespacesGetTheirOwnIds)
+{
+	const EventTypeId audioId = GetEventTypeId<TestAudio::TestAlarmEvent>();
+	const EventTypeId clockId = GetEventTypeId<TestClock::TestAlarmEvent>();
+	GOJO_CHECK(audioId != clockId);
+	GOJO_CHECK(TestAudio::TestAlarmEvent::GetStaticName() == TestClock::TestAlarmEvent::GetStaticName());
+	GOJO_CHECK(EventTypeRegistry::GetName(audioId).ends_with("TestAudio::TestAlarmEvent"));
+	GOJO_CHECK(EventTypeRegistry::GetName(clockId).ends_with("TestClock::TestAlarmEvent"));
+
+	EventManager::StartUp();
+
+	uint32_t audioCount = 0;
+	uint64_t clockMinutes = 0;
+	AddListener<TestAudio::TestAlarmEvent>([&audioCount](const TestAudio::TestAlarmEvent&) { ++audioCount; });
+	AddListener<TestClock::TestAlarmEvent>([&clockMinutes](const TestClock::TestAlarmEvent& event) { clockMinutes += event.mHour * 60 + event.mMinute; });
+
+	DispatchEvent(TestClock::TestAlarmEvent{});
+	EnqueueEvent(TestAudio::TestAlarmEvent{});
+	EnqueueEvent(TestClock::TestAlarmEvent{});
+	DispatchEventsInQueue();
+
+	GOJO_CHECK(audioCount == 1);
+	GOJO_CHECK(clockMinutes == 2 * 450);
+
+	EventManager::ShutDown();
+}
+
+GOJO_TEST(ListenersOnlyReceiveTheirEventTypeInRegistrationOrder)
+{
+	EventManager::StartUp();
+
+	std::vector<int> calls;
+	AddListener<TestPingEvent>([&calls](const TestPingEvent& event) { calls.push_back(event.GetValue()); });
+	AddListener<TestPingEvent>([&calls](const TestPingEvent& event) { calls.push_back(event.GetValue() * 10); });
+	AddListener<TestPongEvent>([&calls](const TestPongEvent&) { calls.push_back(-1); });
+
+	DispatchEvent(TestPingEvent(1));
+	DispatchEvent(TestPingEvent(2));
+
+	// The type-erased overload resolves the id through the virtual call
+	const Event& event = TestPingEvent(3);
+	EventManager::GetInstance().DispatchEvent(event);
+
+	GOJO_CHECK((calls == std::vector<int>{ 1, 10, 2, 20, 3, 30 }));
+
+	EventManager::ShutDown();
+}
+
+GOJO_TEST(ListenersAddedWhileDispatchingStartAfterTheDispatch)
+{
+	EventManager::StartUp();
+
+	int outerCalls = 0;
+	int innerCalls = 0;
+	AddListener<TestPingEvent>([&outerCalls, &innerCalls](const TestPingEvent&)
+		{
+			if (outerCalls++ == 0)
+			{
+				AddListener<TestPingEvent>([&innerCalls](const TestPingEvent&) { ++innerCalls; });
+			}
+		});
+
+	DispatchEvent(TestPingEvent(1));
+	GOJO_CHECK(outerCalls == 1 && innerCalls == 0);
+
+	DispatchEvent(TestPingEvent(2));
+	GOJO_CHECK(outerCalls == 2 && innerCalls == 1);
+
+	EventManager::ShutDown();
+}
+
+GOJO_TEST(WindowListenersOnlyReceiveEventsOfTheirWindow)
+{
+	EventManager::StartUp();
+
+	const WindowId first{ 1, 1 };
+	const WindowId second{ 2, 1 };
+	const WindowId reusedFirst{ 1, 2 };		// Same slot as "first", created after it was destroyed
+
+	int firstCalls = 0;
+	int secondCalls = 0;
+	int globalCalls = 0;
+	AddWindowListener<WindowResizeEvent>(first, [&firstCalls](const WindowResizeEvent&) { ++firstCalls; });
+	AddWindowListener<WindowResizeEvent>(second, [&secondCalls](const WindowResizeEvent&) { ++secondCalls; });
+	AddListener<WindowResizeEvent>([&globalCalls](const WindowResizeEvent&) { ++globalCalls; });
+
+	DispatchEvent(WindowResizeEvent(first, 800, 600));
+	DispatchEvent(WindowResizeEvent(second, 800, 600));
+	DispatchEvent(WindowResizeEvent(second, 1024, 768));
+	GOJO_CHECK(firstCalls == 1 && secondCalls == 2 && globalCalls == 3);
+
+	// A stale handle never reaches the listeners of the window that used the slot before
+	DispatchEvent(WindowResizeEvent(reusedFirst, 640, 480));
+	GOJO_CHECK(firstCalls == 1 && globalCalls == 4);
+
+	EventManager::GetInstance().RemoveWindowListeners(second);
+	DispatchEvent(WindowResizeEvent(second, 800, 600));
+	GOJO_CHECK(secondCalls == 2 && globalCalls == 5);
+
+	EventManager::ShutDown();
+}
@@ -0,0 +1,303 @@
+#include "TestFramework.h"
+
+#include <Core/Containers/MPSCQueue.h>
+#include <Managers/EventManager/EventManager.h>
+#include <Managers/EventManager/Events/MouseEvents.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <format>
+#include <thread>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	// @brief Small trivially copyable event, fits a queue slot.
+	class TestSequenceEvent final : public Event
+	{
+	public:
+		TestSequenceEvent() = default;
+		explicit TestSequenceEvent(uint32_t producer, uint32_t sequence) : mProducer(producer), mSequence(sequence) {}
+
+		[[nodiscard]] uint32_t GetProducer() const { return mProducer; }
+		[[nodiscard]] uint32_t GetSequence() const { return mSequence; }
+
+		EVENT_TYPE(TestSequence, "TestSequence: Producer[{}] Sequence[{}]", mProducer, mSequence)
+
+	private:
+		uint32_t mProducer{ 0 };
+		uint32_t mSequence{ 0 };
+	};
+
+	// @brief Too large for a queue slot, always heap allocated.
+	class TestLargeEvent final : public Event
+	{
+	public:
+		TestLargeEvent() = default;
+		explicit TestLargeEvent(uint32_t sequence) : mSequence(sequence) {}
+
+		[[nodiscard]] uint32_t GetSequence() const { return mSequence; }
+
+		EVENT_TYPE(TestLarge, "TestLarge: Sequence[{}]", mSequence)
+
+	private:
+		uint32_t mSequence{ 0 };
+		std::array<std::byte, 256> mPayload{};
+	};
+
+	uint32_t GetMaxProducerCount()
+	{
+		return std::clamp(std::thread::hardware_concurrency(), 2u, 16u);
+	}
+
+	// @brief Enqueues "eventsPerProducer" events from every producer thread while the calling thread drains.
+	// @return Events dispatched per producer, in dispatch order.
+	std::vector<std::vector<uint32_t>> RunProducers(uint32_t producerCount, uint32_t eventsPerProducer)
+	{
+		std::vector<std::vector<uint32_t>> sequences(producerCount);
+		AddListener<TestSequenceEvent>([&sequences](const TestSequenceEvent& event)
+			{
+				sequences[event.GetProducer()].push_back(event.GetSequence());
+			});
+
+		std::atomic<bool> start{ false };
+		std::vector<std::jthread> producers;
+		for (uint32_t producer = 0; producer < producerCount; ++producer)
+		{
+			producers.emplace_back([&start, producer, eventsPerProducer]()
+				{
+					while (!start.load(std::memory_order_acquire))
+					{
+						std::this_thread::yield();
+					}
+
+					for (uint32_t sequence = 0; sequence < eventsPerProducer; ++sequence)
+					{
+						EnqueueEvent(TestSequenceEvent(producer, sequence));
+					}
+				});
+		}
+
+		const size_t totalEvents = size_t{ producerCount } * eventsPerProducer;
+		size_t dispatchedEvents = 0;
+		start.store(true, std::memory_order_release);
+		while (dispatchedEvents < totalEvents)
+		{
+			DispatchEventsInQueue();
+
+			dispatchedEvents = 0;
+			for (const std::vector<uint32_t>& producerSequences : sequences)
+			{
+				dispatchedEvents += producerSequences.size();
+			}
+		}
+		return sequences;
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(MPSCQueueKeepsTheOrderOfEachProducer)
+{
+	constexpr uint32_t cProducerCount = 4;
+	constexpr uint32_t cValuesPerProducer = 100'000;
+
+	MPSCQueue<uint64_t> queue;
+	std::vector<std::jthread> producers;
+	for (uint32_t producer = 0; producer < cProducerCount; ++producer)
+	{
+		producers.emplace_back([&queue, producer]()
+			{
+				for (uint32_t value = 0; value < cValuesPerProducer; ++value)
+				{
+					queue.Push(uint64_t{ producer } << 32 | value);
+				}
+			});
+	}
+
+	std::vector<int64_t> lastValues(cProducerCount, -1);
+	uint64_t poppedCount = 0;
+	bool isOrdered = true;
+	while (poppedCount < uint64_t{ cProducerCount } * cValuesPerProducer)
+	{
+		uint64_t value = 0;
+		if (!queue.TryPop(value))
+			continue;
+
+		const uint32_t producer = static_cast<uint32_t>(value >> 32);
+		const int64_t sequence = static_cast<int64_t>(value & 0xFFFFFFFF);
+		isOrdered &= sequence == lastValues[producer] + 1;
+		lastValues[producer] = sequence;
+		++poppedCount;
+	}
+
+	GOJO_CHECK(isOrdered);
+	GOJO_CHECK(queue.IsEmpty());
+}
+
+GOJO_TEST(EventsEnqueuedFromWorkerThreadsAreDispatchedInOrder)
+{
+	EventManager::StartUp();
+
+	// More events than queue slots, so the overflow path is part of the run
+	constexpr uint32_t cEventsPerProducer = 20'000;
+	const std::vector<std::vector<uint32_t>> sequences = RunProducers(4, cEventsPerProducer);
+	for (const std::vector<uint32_t>& producerSequences : sequences)
+	{
+		GOJO_CHECK(producerSequences.size() == cEventsPerProducer);
+		GOJO_CHECK(std::ranges::is_sorted(producerSequences));
+	}
+
+	EventManager::ShutDown();
+}
+
+GOJO_TEST(SteadyStateEnqueueDoesNotAllocate)
+{
+	EventManager::StartUp();
+
+	uint32_t dispatchedCount = 0;
+	AddListener<TestSequenceEvent>([&dispatchedCount](const TestSequenceEvent&) { ++dispatchedCount; });
+
+	// A frame worth of events that fits the queue, repeated: every event must land in a preallocated slot
+	constexpr uint32_t cFrameCount = 100;
+	constexpr uint32_t cEventsPerFrame = 1'000;
+	const auto runFrame = []()
+		{
+			for (uint32_t sequence = 0; sequence < cEventsPerFrame; ++sequence)
+			{
+				EnqueueEvent(TestSequenceEvent(0, sequence));
+			}
+			DispatchEventsInQueue();
+		};
+
+	// The first frame may still size lazily built tables
+	runFrame();
+
+	const EventQueueStats statsBefore = EventManager::GetInstance().GetQueueStats();
+	const uint64_t allocationsBefore = GojoTests::GetAllocationCount();
+	for (uint32_t frame = 0; frame < cFrameCount; ++frame)
+	{
+		runFrame();
+	}
+	const uint64_t allocationsAfter = GojoTests::GetAllocationCount();
+	const EventQueueStats statsAfter = EventManager::GetInstance().GetQueueStats();
+
+	GOJO_CHECK(allocationsAfter == allocationsBefore);
+	GOJO_CHECK(dispatchedCount == (cFrameCount + 1) * cEventsPerFrame);
+	GOJO_CHECK(statsAfter.InlineEvents - statsBefore.InlineEvents == cFrameCount * cEventsPerFrame);
+	GOJO_CHECK(statsAfter.HeapEvents == statsBefore.HeapEvents);
+
+	EventManager::ShutDown();
+}
+
+GOJO_TEST(OversizedEventsDoNotOvertakeOverflowedEvents)
+{
+	EventManager::StartUp();
+
+	// Overflow the ring, so the drain below frees slots while older events still wait in the overflow queue
+	// (the listener runs once the slot of the first event was released)
+	constexpr uint32_t cEventCount = 3'000;
+	std::vector<uint32_t> order;
+	AddListener<TestSequenceEvent>([&order](const TestSequenceEvent& event)
+		{
+			order.push_back(event.GetSequence());
+			if (event.GetSequence() == 1)
+			{
+				EnqueueEvent(TestSequenceEvent(0, cEventCount));
+				EnqueueEvent(TestLargeEvent(cEventCount + 1));
+			}
+		});
+	AddListener<TestLargeEvent>([&order](const TestLargeEvent& event) { order.push_back(event.GetSequence()); });
+
+	for (uint32_t sequence = 0; sequence < cEventCount; ++sequence)
+	{
+		EnqueueEvent(TestSequenceEvent(0, sequence));
+	}
+
+	for (uint32_t frame = 0; frame < 4 && order.size() < cEventCount + 2; ++frame)
+	{
+		DispatchEventsInQueue();
+	}
+
+	GOJO_CHECK(order.size() == cEventCount + 2);
+	GOJO_CHECK(std::ranges::is_sorted(order));
+
+	EventManager::ShutDown();
+}
+
+GOJO_TEST(CoalescingMergesRunsOfTheSameWindowOnly)
+{
+	EventManager::StartUp();
+	EventManager::GetInstance().SetCoalescingEnabled(true);
+
+	struct Move { WindowId Window; float X; };
+	std::vector<Move> moves;
+	float scrolled = 0.0f;
+	AddListener<MouseMovedEvent>([&moves](const MouseMovedEvent& event) { moves.push_back(Move{ event.GetWindowId(), event.GetX() }); });
+	AddListener<MouseScrolledEvent>([&scrolled](const MouseScrolledEvent& event) { scrolled += event.GetYOffset(); });
+
+	const WindowId first{ 1, 1 };
+	const WindowId second{ 2, 1 };
+	PostEvent(MouseMovedEvent(first, 1.0f, 0.0f));
+	PostEvent(MouseMovedEvent(first, 2.0f, 0.0f));
+	PostEvent(MouseMovedEvent(first, 3.0f, 0.0f));		// Run of three -> last position
+	PostEvent(MouseMovedEvent(second, 4.0f, 0.0f));		// Other window breaks the run
+	PostEvent(MouseScrolledEvent(second, 0.0f, 1.0f));
+	PostEvent(MouseScrolledEvent(second, 0.0f, 2.0f));	// Scroll offsets add up
+	PostEvent(MouseMovedEvent(first, 5.0f, 0.0f));		// Not merged across the scrolls (order is kept)
+
+	const EventQueueStats statsBefore = EventManager::GetInstance().GetQueueStats();
+	DispatchEventsInQueue();
+	const EventQueueStats statsAfter = EventManager::GetInstance().GetQueueStats();
+
+	GOJO_CHECK(moves.size() == 3);
+	if (moves.size() == 3)
+	{
+		GOJO_CHECK(moves[0].Window == first && moves[0].X == 3.0f);
+		GOJO_CHECK(moves[1].Window == second && moves[1].X == 4.0f);
+		GOJO_CHECK(moves[2].Window == first && moves[2].X == 5.0f);
+	}
+	GOJO_CHECK(scrolled == 3.0f);
+	GOJO_CHECK(statsAfter.CoalescedEvents - statsBefore.CoalescedEvents == 3);
+
+	EventManager::ShutDown();
+}
+
+GOJO_TEST(PostEventDispatchesImmediatelyWithoutCoalescing)
+{
+	EventManager::StartUp();
+
+	int moveCount = 0;
+	AddListener<MouseMovedEvent>([&moveCount](const MouseMovedEvent&) { ++moveCount; });
+
+	PostEvent(MouseMovedEvent(WindowId{ 1, 1 }, 1.0f, 0.0f));
+	PostEvent(MouseMovedEvent(WindowId{ 1, 1 }, 2.0f, 0.0f));
+	GOJO_CHECK(moveCount == 2);
+
+	EventManager::ShutDown();
+}
+
+// ====================================================================================================
+// Benchmarks
+// ====================================================================================================
+
+GOJO_BENCHMARK(EventEnqueueThroughput)
+{
+	constexpr uint32_t cEventsPerProducer = 500'000;
+
+	for (uint32_t producerCount = 1; producerCount <= GetMaxProducerCount(); ++producerCount)
+	{
+		EventManager::StartUp();
+
+		const double seconds = GojoTests::MeasureSeconds([producerCount]() { RunProducers(producerCount, cEventsPerProducer); });
+		const double eventsPerSecond = static_cast<double>(producerCount) * cEventsPerProducer / seconds;
+		GojoTests::ReportMeasurement(std::format("{} producer(s)", producerCount), eventsPerSecond / 1'000'000.0, "M events/s");
+
+		EventManager::ShutDown();
+	}
+}
@@ -0,0 +1,109 @@
+#include "TestFramework.h"
+
+#include <Managers/EventManager/EventManager.h>
+#include <Managers/EventManager/EventRecorder.h>
+
+#include <filesystem>
+
+using namespace GojoEngine;
+
+namespace
+{
+	// @brief Stands for external input, recorded.
+	class TestInputEvent final : public Event
+	{
+	public:
+		TestInputEvent() = default;
+		explicit TestInputEvent(int value) : mValue(value) {}
+
+		[[nodiscard]] int GetValue() const { return mValue; }
+
+		void Serialize(EventArchive& archive) { archive(mValue); }
+
+		EVENT_TYPE(TestInput, "TestInput: Value[{}]", mValue)
+
+	private:
+		int mValue{ 0 };
+	};
+
+	// @brief Queued by a listener in reaction to TestInputEvent, must not be recorded.
+	class TestEchoEvent final : public Event
+	{
+	public:
+		TestEchoEvent() = default;
+		explicit TestEchoEvent(int value) : mValue(value) {}
+
+		void Serialize(EventArchive& archive) { archive(mValue); }
+
+		EVENT_TYPE(TestEcho, "TestEcho: Value[{}]", mValue)
+
+	private:
+		int mValue{ 0 };
+	};
+
+	struct ListenerCalls
+	{
+		int Inputs{ 0 };
+		int Echoes{ 0 };
+		int InputSum{ 0 };
+	};
+
+	void AddEchoListeners(ListenerCalls& calls)
+	{
+		AddListener<TestInputEvent>([&calls](const TestInputEvent& event)
+			{
+				++calls.Inputs;
+				calls.InputSum += event.GetValue();
+				EnqueueEvent(TestEchoEvent(event.GetValue()));
+			});
+		AddListener<TestEchoEvent>([&calls](const TestEchoEvent&) { ++calls.Echoes; });
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(ReplayReproducesListenerQueuedEventsExactlyOnce)
+{
+	constexpr int cFrameCount = 50;
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "GojoTests_EventRecording.bin";
+
+	// Record: one external event per frame, its listener queues an echo for the next drain
+	ListenerCalls recordedCalls;
+	EventManager::StartUp();
+	AddEchoListeners(recordedCalls);
+	GOJO_CHECK(EventManager::GetInstance().StartRecording(path));
+	for (int frame = 0; frame < cFrameCount; ++frame)
+	{
+		EnqueueEvent(TestInputEvent(frame));
+		DispatchEventsInQueue();
+	}
+	DispatchEventsInQueue();
+	EventManager::GetInstance().StopRecording();
+	EventManager::ShutDown();
+
+	// Replay into a fresh manager, the listeners recreate the echoes on their own
+	ListenerCalls replayedCalls;
+	EventManager::StartUp();
+	AddEchoListeners(replayedCalls);
+
+	EventReplayer replayer;
+	GOJO_CHECK(replayer.Open(path));
+	while (!replayer.IsFinished())
+	{
+		replayer.ReplayFrame();
+		DispatchEventsInQueue();
+	}
+	DispatchEventsInQueue();
+
+	GOJO_CHECK(replayer.GetReplayedEventCount() == cFrameCount);
+	GOJO_CHECK(replayedCalls.Inputs == recordedCalls.Inputs);
+	GOJO_CHECK(replayedCalls.Echoes == recordedCalls.Echoes);
+	GOJO_CHECK(replayedCalls.InputSum == recordedCalls.InputSum);
+	GOJO_CHECK(recordedCalls.Echoes == cFrameCount);
+
+	replayer.Close();
+	EventManager::ShutDown();
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,158 @@
+#include "TestFramework.h"
+
+#include <Core/Containers/TimerWheel.h>
+#include <Managers/EventManager/EventManager.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	class TestAlarmEvent final : public Event
+	{
+	public:
+		EVENT_TYPE(TestAlarm, "TestAlarm")
+	};
+
+	class TestSnoozeEvent final : public Event
+	{
+	public:
+		EVENT_TYPE(TestSnooze, "TestSnooze")
+	};
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(TimerWheelExpiresTimersAtTheirTickOnEveryLevel)
+{
+	// Delays in the first level, across one cascade and across two
+	const std::vector<uint64_t> delays{ 1, 5, 255, 256, 300, 70'000 };
+
+	TimerWheel<uint64_t> wheel;
+	for (uint64_t delay : delays)
+	{
+		wheel.Schedule(delay, 0, delay);
+	}
+
+	std::vector<uint64_t> expiredDelays;
+	bool expiredOnTime = true;
+	for (uint64_t tick = 0; tick < 70'001; ++tick)
+	{
+		wheel.Advance(1, [&](TimerHandle, uint64_t& delay)
+			{
+				expiredOnTime &= wheel.GetCurrentTick() == delay;
+				expiredDelays.push_back(delay);
+			});
+	}
+
+	GOJO_CHECK(expiredOnTime);
+	GOJO_CHECK(expiredDelays == delays);
+	GOJO_CHECK(wheel.GetSize() == 0);
+}
+
+GOJO_TEST(TimerWheelRearmsPeriodicTimersUntilCancelled)
+{
+	TimerWheel<int> wheel;
+	int expirations = 0;
+	const TimerHandle periodic = wheel.Schedule(10, 10, 0);
+	const TimerHandle cancelled = wheel.Schedule(50, 0, 0);
+
+	GOJO_CHECK(wheel.Cancel(cancelled));
+	GOJO_CHECK(!wheel.Cancel(cancelled));
+
+	// A big step fires every period it covers, in order
+	wheel.Advance(100, [&](TimerHandle handle, int&)
+		{
+			++expirations;
+			if (expirations == 3)
+			{
+				wheel.Cancel(handle);
+			}
+		});
+
+	GOJO_CHECK(expirations == 3);
+	GOJO_CHECK(!wheel.IsScheduled(periodic));
+	GOJO_CHECK(wheel.GetSize() == 0);
+}
+
+GOJO_TEST(TimerWheelSchedulesAtAbsoluteTicks)
+{
+	TimerWheel<uint64_t> wheel;
+	wheel.Advance(10, [](TimerHandle, uint64_t&) {});
+
+	// A tick that already passed expires on the next step instead of a full revolution later
+	wheel.ScheduleAt(5, 0, 11);
+	wheel.ScheduleAt(40, 0, 40);
+
+	std::vector<uint64_t> expiredTicks;
+	wheel.Advance(1, [&](TimerHandle, uint64_t& tick) { expiredTicks.push_back(tick); });
+	GOJO_CHECK(expiredTicks == std::vector<uint64_t>{ 11 });
+
+	wheel.Advance(29, [&](TimerHandle, uint64_t& tick) { expiredTicks.push_back(tick); });
+	GOJO_CHECK((expiredTicks == std::vector<uint64_t>{ 11, 40 }));
+	GOJO_CHECK(wheel.GetSize() == 0);
+}
+
+GOJO_TEST(SchedulingATimerDoesNotDispatchOverdueTimers)
+{
+	EventManager::StartUp();
+
+	int alarmCount = 0;
+	int snoozeCount = 0;
+	AddListener<TestAlarmEvent>([&alarmCount](const TestAlarmEvent&) { ++alarmCount; });
+	AddListener<TestSnoozeEvent>([&snoozeCount](const TestSnoozeEvent&)
+		{
+			++snoozeCount;
+			EnqueueEventDelayed(TestAlarmEvent(), std::chrono::milliseconds(1));
+		});
+
+	EnqueueEventDelayed(TestAlarmEvent(), std::chrono::milliseconds(1));
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+	// The first alarm is overdue, neither scheduling directly nor from a listener may fire it
+	EnqueueEventDelayed(TestAlarmEvent(), std::chrono::milliseconds(1));
+	DispatchEvent(TestSnoozeEvent());
+	GOJO_CHECK(snoozeCount == 1);
+	GOJO_CHECK(alarmCount == 0);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	DispatchEventsInQueue();
+	GOJO_CHECK(alarmCount == 3);
+
+	EventManager::ShutDown();
+}
+
+GOJO_TEST(DelayedAndPeriodicEventsAreDispatchedFromTheQueue)
+{
+	EventManager::StartUp();
+
+	int alarmCount = 0;
+	AddListener<TestAlarmEvent>([&alarmCount](const TestAlarmEvent&) { ++alarmCount; });
+
+	const TimerHandle delayed = EnqueueEventDelayed(TestAlarmEvent(), std::chrono::milliseconds(20));
+	DispatchEventsInQueue();
+	GOJO_CHECK(alarmCount == 0);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(30));
+	DispatchEventsInQueue();
+	GOJO_CHECK(alarmCount == 1);
+	GOJO_CHECK(!CancelTimer(delayed));
+
+	const TimerHandle periodic = EnqueueEventEvery(TestAlarmEvent(), std::chrono::milliseconds(5));
+	std::this_thread::sleep_for(std::chrono::milliseconds(30));
+	DispatchEventsInQueue();
+	GOJO_CHECK(alarmCount >= 3);
+
+	GOJO_CHECK(CancelTimer(periodic));
+	const int countAfterCancel = alarmCount;
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	DispatchEventsInQueue();
+	GOJO_CHECK(alarmCount == countAfterCancel);
+
+	EventManager::ShutDown();
+}
@@ -0,0 +1,160 @@
+#include "TestFramework.h"
+
+#include <Core/MappedFile.h>
+#include <Managers/EventManager/Events/Event.h>
+#include <Managers/FlightRecorder/FlightRecorder.h>
+#include <Managers/LogManager/LogManager.h>
+
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	class TestFlightEvent final : public Event
+	{
+	public:
+		EVENT_TYPE(TestFlight, "TestFlight")
+	};
+
+	FlightRecorderSettings MakeFlightRecorderSettings(const std::filesystem::path& directory)
+	{
+		FlightRecorderSettings settings;
+		settings.Directory = directory;
+		settings.RecordsPerThread = 64;
+		settings.MaxThreads = 4;
+		settings.InstallCrashHandlers = false;		// The test marks the crash itself
+		return settings;
+	}
+
+	std::vector<std::filesystem::path> FindDumps(const std::filesystem::path& directory)
+	{
+		std::vector<std::filesystem::path> dumps;
+		for (const auto& entry : std::filesystem::directory_iterator(directory))
+		{
+			if (entry.path().extension() == ".txt")
+			{
+				dumps.push_back(entry.path());
+			}
+		}
+		return dumps;
+	}
+
+	std::string ReadText(const std::filesystem::path& path)
+	{
+		std::ifstream file(path);
+		return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(CrashedRunIsDumpedByTheNextStartUp)
+{
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "GojoTests_FlightRecorder";
+	std::filesystem::remove_all(directory);
+
+	// A run that crashes: the handler only marks the region, nothing is written yet
+	FlightRecorder::StartUp(MakeFlightRecorderSettings(directory));
+	GOJO_LOG_INFO("Tests", "Flight record value {} from {}", 42, "Gojo");
+	FlightRecorder::GetInstance().RecordEvent(GetEventTypeId<TestFlightEvent>(), 0);
+	FlightRecorder::GetInstance().MarkFrame();
+	FlightRecorder::GetInstance().MarkCrashed("SIGSEGV");
+	FlightRecorder::ShutDown();
+	GOJO_CHECK(FindDumps(directory).empty());
+
+	// The next run keeps the old region and decodes it from its own tables
+	FlightRecorder::StartUp(MakeFlightRecorderSettings(directory));
+	const std::vector<std::filesystem::path> dumps = FindDumps(directory);
+	GOJO_CHECK(dumps.size() == 1);
+	GOJO_CHECK(std::filesystem::exists(directory / "FlightRecorder.previous.gjfr"));
+	if (dumps.size() == 1)
+	{
+		const std::string text = ReadText(dumps[0]);
+		GOJO_CHECK(dumps[0].filename().string().find("PreviousRun_SIGSEGV") != std::string::npos);
+		GOJO_CHECK(text.find("[info] [Tests] Flight record value 42 from Gojo") != std::string::npos);
+		GOJO_CHECK(text.find(std::format("[event] {} (depth 0)", GetTypeName<TestFlightEvent>())) != std::string::npos);
+	}
+
+	// A clean shutdown leaves nothing to report
+	FlightRecorder::ShutDown();
+	FlightRecorder::StartUp(MakeFlightRecorderSettings(directory));
+	GOJO_CHECK(FindDumps(directory).size() == 1);
+	FlightRecorder::ShutDown();
+
+	// The decoder tool path: any region file decodes on its own
+	MappedFile previousRegion;
+	std::string text;
+	GOJO_CHECK(previousRegion.Open(directory / "FlightRecorder.previous.gjfr", MappedFile::Access::ReadOnly));
+	GOJO_CHECK(FormatFlightRecord(std::span<const std::byte>(previousRegion.GetData(), previousRegion.GetSize()), "Test", text));
+	GOJO_CHECK(text.starts_with("Flight record: Test"));
+	previousRegion.Close();
+
+	std::filesystem::remove_all(directory);
+}
+
+GOJO_TEST(DumpFormatsEveryThreadInTimeOrder)
+{
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "GojoTests_FlightRecorderDump";
+	std::filesystem::remove_all(directory);
+
+	FlightRecorder::StartUp(MakeFlightRecorderSettings(directory));
+	GOJO_LOG_INFO("Tests", "Flight record order {}", 1);
+	std::thread([]() { GOJO_LOG_INFO("Tests", "Flight record order {}", 2); }).join();
+	GOJO_LOG_INFO("Tests", "Flight record order {}", 3);
+
+	const std::filesystem::path path = FlightRecorder::GetInstance().Dump("OnDemand");
+	FlightRecorder::ShutDown();
+
+	const std::string text = ReadText(path);
+	const size_t first = text.find("Flight record order 1");
+	const size_t second = text.find("Flight record order 2");
+	const size_t third = text.find("Flight record order 3");
+	GOJO_CHECK(first != std::string::npos && second != std::string::npos && third != std::string::npos);
+	GOJO_CHECK(first < second && second < third);
+
+	std::filesystem::remove_all(directory);
+}
+
+GOJO_TEST(IdleFramesAreNotReportedAsHitches)
+{
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "GojoTests_FlightRecorderHitch";
+	std::filesystem::remove_all(directory);
+
+	FlightRecorderSettings settings = MakeFlightRecorderSettings(directory);
+	settings.HitchThresholdMs = 5;
+	FlightRecorder::StartUp(settings);
+	FlightRecorder& recorder = FlightRecorder::GetInstance();
+
+	// A frame blocked on window events on purpose
+	recorder.MarkFrame();
+	recorder.MarkIdleFrame();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	recorder.MarkFrame();
+	GOJO_CHECK(FindDumps(directory).empty());
+
+	// The same wait in a busy frame is a hitch
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	recorder.MarkFrame();
+	const std::vector<std::filesystem::path> dumps = FindDumps(directory);
+	GOJO_CHECK(dumps.size() == 1);
+	if (dumps.size() == 1)
+	{
+		const std::string text = ReadText(dumps[0]);
+		GOJO_CHECK(text.starts_with("Flight record: Hitch"));
+		GOJO_CHECK(text.find("ms, idle)") != std::string::npos);
+	}
+
+	FlightRecorder::ShutDown();
+	std::filesystem::remove_all(directory);
+}
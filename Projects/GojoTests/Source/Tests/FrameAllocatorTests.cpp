@@ -0,0 +1,159 @@
+#include "TestFramework.h"
+
+#include <Core/Memory/FrameAllocator.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	bool IsAligned(const void* memory, size_t alignment)
+	{
+		return reinterpret_cast<uintptr_t>(memory) % alignment == 0;
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(FrameMemoryIsReusedAfterBeginFrame)
+{
+	FrameAllocator::StartUp();
+	FrameAllocator& allocator = FrameAllocator::GetInstance();
+
+	void* first = allocator.Allocate(24);
+	void* second = allocator.Allocate(8, 256);
+	GOJO_CHECK(first != second);
+	GOJO_CHECK(IsAligned(first, alignof(std::max_align_t)));
+	GOJO_CHECK(IsAligned(second, 256));
+
+	allocator.BeginFrame();
+	GOJO_CHECK(allocator.GetFrameIndex() == 1);
+	GOJO_CHECK(allocator.Allocate(24) == first);
+
+	FrameAllocator::ShutDown();
+}
+
+GOJO_TEST(NextFrameMemoryStaysValidForOneMoreFrame)
+{
+	FrameAllocator::StartUp();
+	FrameAllocator& allocator = FrameAllocator::GetInstance();
+
+	auto* produced = static_cast<uint32_t*>(allocator.Allocate(sizeof(uint32_t) * 64, alignof(uint32_t), FrameLifetime::NextFrame));
+	for (uint32_t index = 0; index < 64; ++index)
+	{
+		produced[index] = index;
+	}
+
+	// Frame N + 1 consumes while producing into the other buffer
+	allocator.BeginFrame();
+	void* producedNext = allocator.Allocate(sizeof(uint32_t) * 64, alignof(uint32_t), FrameLifetime::NextFrame);
+	GOJO_CHECK(producedNext != produced);
+
+	bool isIntact = true;
+	for (uint32_t index = 0; index < 64; ++index)
+	{
+		isIntact &= produced[index] == index;
+	}
+	GOJO_CHECK(isIntact);
+
+	// Frame N + 2 reuses the buffer of frame N
+	allocator.BeginFrame();
+	GOJO_CHECK(allocator.Allocate(sizeof(uint32_t) * 64, alignof(uint32_t), FrameLifetime::NextFrame) == produced);
+
+	FrameAllocator::ShutDown();
+}
+
+GOJO_TEST(FrameArenaOverflowsToTheHeapAndIsReported)
+{
+	FrameAllocator::StartUp(FrameAllocatorSettings{ .FrameArenaSize = 256, .DoubleBufferedArenaSize = 256 });
+	FrameAllocator& allocator = FrameAllocator::GetInstance();
+
+	void* fitting = allocator.Allocate(128);
+	void* overflowing = allocator.Allocate(512);
+	std::memset(overflowing, 0xAB, 512);
+	GOJO_CHECK(fitting != nullptr && overflowing != nullptr);
+
+	// The usage of a frame is recorded when the thread resets its arena in a later frame
+	allocator.BeginFrame();
+	(void)allocator.Allocate(16);
+
+	const FrameAllocatorStats stats = allocator.GetStats();
+	GOJO_CHECK(stats.OverflowCount == 1);
+	GOJO_CHECK(stats.FrameHighWaterMark >= 128 + 512);
+	GOJO_CHECK(stats.FrameArenaSize == 256);
+
+	FrameAllocator::ShutDown();
+}
+
+GOJO_TEST(EveryThreadAllocatesFromItsOwnArenas)
+{
+	FrameAllocator::StartUp();
+	FrameAllocator& allocator = FrameAllocator::GetInstance();
+
+	void* mainThreadMemory = allocator.Allocate(64);
+	void* workerMemory = nullptr;
+	std::thread([&allocator, &workerMemory]() { workerMemory = allocator.Allocate(64); }).join();
+
+	GOJO_CHECK(workerMemory != nullptr && workerMemory != mainThreadMemory);
+	GOJO_CHECK(allocator.GetStats().ThreadCount == 2);
+
+	// pmr containers draw from the same arenas, they must not outlive the allocator
+	{
+		std::pmr::vector<uint32_t> values(allocator.GetResource());
+		values.assign(100, 7);
+		GOJO_CHECK(values.size() == 100 && values[99] == 7);
+	}
+
+	FrameAllocator::ShutDown();
+
+	// A restarted allocator does not hand out the arenas of the previous instance
+	FrameAllocator::StartUp();
+	GOJO_CHECK(FrameAllocator::GetInstance().Allocate(64) != nullptr);
+	GOJO_CHECK(FrameAllocator::GetInstance().GetStats().ThreadCount == 1);
+	FrameAllocator::ShutDown();
+}
+
+// ====================================================================================================
+// Benchmarks
+// ====================================================================================================
+
+GOJO_BENCHMARK(FrameAllocationVersusHeap)
+{
+	FrameAllocator::StartUp(FrameAllocatorSettings{ .FrameArenaSize = 64u << 20 });
+	FrameAllocator& allocator = FrameAllocator::GetInstance();
+
+	constexpr uint32_t cAllocationCount = 1000000;
+	std::vector<void*> allocations(cAllocationCount);
+
+	const double frameSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			for (uint32_t index = 0; index < cAllocationCount; ++index)
+			{
+				allocations[index] = allocator.Allocate(32);
+			}
+		});
+
+	const double heapSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			for (uint32_t index = 0; index < cAllocationCount; ++index)
+			{
+				allocations[index] = ::operator new(32);
+			}
+			for (void* allocation : allocations)
+			{
+				::operator delete(allocation);
+			}
+		});
+
+	GojoTests::ReportMeasurement("FrameAllocate", frameSeconds * 1e9 / cAllocationCount, "ns/allocation");
+	GojoTests::ReportMeasurement("HeapNewDelete", heapSeconds * 1e9 / cAllocationCount, "ns/allocation");
+
+	FrameAllocator::ShutDown();
+}
@@ -0,0 +1,96 @@
+#include "TestFramework.h"
+
+#include <Core/FrameLoop.h>
+
+#include <chrono>
+#include <cmath>
+#include <string>
+
+using namespace GojoEngine;
+using namespace std::chrono_literals;
+
+namespace
+{
+	bool IsNear(double value, double expected)
+	{
+		return std::abs(value - expected) < 1e-9;
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(FixedStepsConsumeTheElapsedTimeExactly)
+{
+	FrameLoop frameLoop({ .UpdateRate = 50, .MaxStepsPerFrame = 5 });		// 20 ms steps
+
+	uint32_t stepCount = 0;
+	double lastAlpha = -1.0;
+	frameLoop.AddCallback(EnginePhase::FixedUpdate, [&stepCount](const FrameTime&) { ++stepCount; });
+	frameLoop.AddCallback(EnginePhase::Render, [&lastAlpha](const FrameTime& time) { lastAlpha = time.Alpha; });
+
+	frameLoop.Tick(50ms);
+	GOJO_CHECK(stepCount == 2);
+	GOJO_CHECK(IsNear(lastAlpha, 0.5));
+
+	// The 10 ms left over complete the third step
+	frameLoop.Tick(10ms);
+	GOJO_CHECK(stepCount == 3);
+	GOJO_CHECK(IsNear(lastAlpha, 0.0));
+
+	frameLoop.Tick(5ms);
+	GOJO_CHECK(stepCount == 3);
+	GOJO_CHECK(IsNear(lastAlpha, 0.25));
+
+	const FrameTime& time = frameLoop.GetFrameTime();
+	GOJO_CHECK(time.FrameIndex == 3);
+	GOJO_CHECK(time.FixedStepIndex == 3);
+	GOJO_CHECK(IsNear(time.SimulationSeconds, 0.06));
+	GOJO_CHECK(IsNear(time.DeltaSeconds, 0.005));
+	GOJO_CHECK(frameLoop.GetDroppedStepCount() == 0);
+}
+
+GOJO_TEST(LongFramesDropTheBacklogInsteadOfCatchingUp)
+{
+	FrameLoop frameLoop({ .UpdateRate = 50, .MaxStepsPerFrame = 5 });
+
+	uint32_t stepCount = 0;
+	frameLoop.AddCallback(EnginePhase::FixedUpdate, [&stepCount](const FrameTime&) { ++stepCount; });
+
+	// 50 steps due, 5 run, 45 dropped, the fraction is kept for interpolation
+	frameLoop.Tick(1010ms);
+	GOJO_CHECK(stepCount == 5);
+	GOJO_CHECK(frameLoop.GetDroppedStepCount() == 45);
+	GOJO_CHECK(IsNear(frameLoop.GetFrameTime().Alpha, 0.5));
+
+	frameLoop.Tick(10ms);
+	GOJO_CHECK(stepCount == 6);
+}
+
+GOJO_TEST(PhasesRunInOrderAndCallbacksCanChangeThemselves)
+{
+	FrameLoop frameLoop({ .UpdateRate = 50, .MaxStepsPerFrame = 5 });
+
+	std::string trace;
+	frameLoop.AddCallback(EnginePhase::Render, [&trace](const FrameTime&) { trace += 'R'; });
+	frameLoop.AddCallback(EnginePhase::Update, [&trace](const FrameTime&) { trace += 'U'; });
+	frameLoop.AddCallback(EnginePhase::FixedUpdate, [&trace](const FrameTime&) { trace += 'F'; });
+
+	// Runs once: removes itself and adds a callback that starts with the next phase run
+	PhaseCallbackId onceId = cInvalidPhaseCallbackId;
+	onceId = frameLoop.AddCallback(EnginePhase::Update, [&](const FrameTime&)
+		{
+			trace += 'O';
+			GOJO_CHECK(frameLoop.RemoveCallback(onceId));
+			frameLoop.AddCallback(EnginePhase::Update, [&trace](const FrameTime&) { trace += 'N'; });
+		});
+
+	frameLoop.Tick(40ms);
+	GOJO_CHECK(trace == "FFUOR");
+
+	trace.clear();
+	frameLoop.Tick(0ms);
+	GOJO_CHECK(trace == "UNR");
+	GOJO_CHECK(!frameLoop.RemoveCallback(onceId));
+}
@@ -0,0 +1,206 @@
+#include "TestFramework.h"
+
+#include <Core/Containers/WorkStealingDeque.h>
+#include <Managers/JobSystem/JobSystem.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	constexpr uint32_t cTestWorkerCount = 3;
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(WorkStealingDequeHandsOutEveryValueOnce)
+{
+	constexpr size_t cValueCount = 100000;
+	constexpr size_t cThiefCount = 3;
+
+	std::vector<uint32_t> values(cValueCount, 0);
+	std::vector<std::atomic<uint32_t>> takenCounts(cValueCount);
+	WorkStealingDeque<uint32_t*> deque(2);		// Grows while thieves read
+
+	std::atomic<bool> isPushing{ true };
+	std::vector<std::thread> thieves;
+	for (size_t thief = 0; thief < cThiefCount; ++thief)
+	{
+		thieves.emplace_back([&]()
+			{
+				while (isPushing.load(std::memory_order_acquire) || !deque.IsEmpty())
+				{
+					if (uint32_t* value = deque.Steal())
+					{
+						takenCounts[value - values.data()].fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+			});
+	}
+
+	// The owner pops every third push, racing the thieves for the last element
+	for (size_t index = 0; index < cValueCount; ++index)
+	{
+		deque.Push(&values[index]);
+		if (index % 3 == 0)
+		{
+			if (uint32_t* value = deque.Pop())
+			{
+				takenCounts[value - values.data()].fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+	}
+	isPushing.store(false, std::memory_order_release);
+
+	for (std::thread& thief : thieves)
+	{
+		thief.join();
+	}
+
+	bool isEveryValueTakenOnce = true;
+	for (const std::atomic<uint32_t>& takenCount : takenCounts)
+	{
+		isEveryValueTakenOnce &= takenCount.load() == 1;
+	}
+	GOJO_CHECK(isEveryValueTakenOnce);
+	GOJO_CHECK(deque.Pop() == nullptr);
+}
+
+GOJO_TEST(ParallelForVisitsEveryIndexOnce)
+{
+	JobSystem::StartUp(JobSystemSettings{ .WorkerCount = cTestWorkerCount });
+	JobSystem& jobSystem = JobSystem::GetInstance();
+	GOJO_CHECK(jobSystem.GetWorkerCount() == cTestWorkerCount);
+	GOJO_CHECK(JobSystem::GetCurrentThreadIndex() == 0);
+
+	constexpr uint32_t cCount = 100000;
+	std::vector<std::atomic<uint32_t>> visitCounts(cCount);
+	std::atomic<bool> isThreadIndexValid{ true };
+	jobSystem.ParallelFor(cCount, [&](uint32_t index)
+		{
+			visitCounts[index].fetch_add(1, std::memory_order_relaxed);
+			if (JobSystem::GetCurrentThreadIndex() > cTestWorkerCount)
+			{
+				isThreadIndexValid.store(false, std::memory_order_relaxed);
+			}
+		}, 64);
+
+	bool isEveryIndexVisitedOnce = true;
+	for (const std::atomic<uint32_t>& visitCount : visitCounts)
+	{
+		isEveryIndexVisitedOnce &= visitCount.load() == 1;
+	}
+	GOJO_CHECK(isEveryIndexVisitedOnce);
+	GOJO_CHECK(isThreadIndexValid.load());
+
+	JobSystem::ShutDown();
+}
+
+GOJO_TEST(RunAfterStartsOnceTheDependencyIsDone)
+{
+	JobSystem::StartUp(JobSystemSettings{ .WorkerCount = cTestWorkerCount });
+	JobSystem& jobSystem = JobSystem::GetInstance();
+
+	std::atomic<uint32_t> finishedCount{ 0 };
+	std::atomic<bool> isOrderKept{ true };
+
+	JobCounter dependency;
+	JobCounter continuation;
+	for (uint32_t job = 0; job < 8; ++job)
+	{
+		jobSystem.Run([&finishedCount]()
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(2));
+				finishedCount.fetch_add(1, std::memory_order_acq_rel);
+			}, &dependency);
+	}
+	jobSystem.RunAfter(dependency, [&]()
+		{
+			isOrderKept.store(finishedCount.load(std::memory_order_acquire) == 8, std::memory_order_relaxed);
+		}, &continuation);
+
+	jobSystem.Wait(continuation);
+	GOJO_CHECK(dependency.IsDone());
+	GOJO_CHECK(isOrderKept.load());
+
+	// A dependency that is already done starts the job right away
+	JobCounter immediate;
+	bool hasRun = false;
+	jobSystem.RunAfter(dependency, [&hasRun]() { hasRun = true; }, &immediate);
+	jobSystem.Wait(immediate);
+	GOJO_CHECK(hasRun);
+
+	JobSystem::ShutDown();
+}
+
+GOJO_TEST(JobsCanWaitOnTheJobsTheyStart)
+{
+	// One worker: without helping while waiting the nested waits would deadlock
+	JobSystem::StartUp(JobSystemSettings{ .WorkerCount = 1 });
+	JobSystem& jobSystem = JobSystem::GetInstance();
+
+	std::atomic<uint32_t> leafCount{ 0 };
+	JobCounter counter;
+	for (uint32_t parent = 0; parent < 16; ++parent)
+	{
+		jobSystem.Run([&jobSystem, &leafCount]()
+			{
+				JobCounter children;
+				for (uint32_t child = 0; child < 16; ++child)
+				{
+					jobSystem.Run([&leafCount]() { leafCount.fetch_add(1, std::memory_order_relaxed); }, &children);
+				}
+				jobSystem.Wait(children);
+			}, &counter);
+	}
+
+	// Jobs started from threads outside the system go through the shared queue
+	std::thread foreignThread([&jobSystem, &leafCount]()
+		{
+			JobCounter foreign;
+			for (uint32_t job = 0; job < 16; ++job)
+			{
+				jobSystem.Run([&leafCount]() { leafCount.fetch_add(1, std::memory_order_relaxed); }, &foreign);
+			}
+			jobSystem.Wait(foreign);
+		});
+
+	jobSystem.Wait(counter);
+	foreignThread.join();
+	GOJO_CHECK(leafCount.load() == 16 * 16 + 16);
+
+	JobSystem::ShutDown();
+}
+
+// ====================================================================================================
+// Benchmarks
+// ====================================================================================================
+
+GOJO_BENCHMARK(JobRunAndWaitThroughput)
+{
+	JobSystem::StartUp(JobSystemSettings{ .WorkerCount = cTestWorkerCount });
+	JobSystem& jobSystem = JobSystem::GetInstance();
+
+	constexpr uint32_t cJobCount = 100000;
+	std::atomic<uint32_t> finishedCount{ 0 };
+	const double seconds = GojoTests::MeasureSeconds([&]()
+		{
+			JobCounter counter;
+			for (uint32_t job = 0; job < cJobCount; ++job)
+			{
+				jobSystem.Run([&finishedCount]() { finishedCount.fetch_add(1, std::memory_order_relaxed); }, &counter);
+			}
+			jobSystem.Wait(counter);
+		});
+	GOJO_CHECK(finishedCount.load() == cJobCount);
+	GojoTests::ReportMeasurement("JobRunAndWait", seconds * 1e9 / cJobCount, "ns/job");
+
+	JobSystem::ShutDown();
+}
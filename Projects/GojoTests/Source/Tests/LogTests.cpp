@@ -0,0 +1,437 @@
+#include "TestFramework.h"
+
+#include <Core/MappedFile.h>
+#include <Managers/LogManager/BinaryLogFormat.h>
+#include <Managers/LogManager/LogManager.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	// @brief Restarts the LogManager with "settings" for the scope, then with the runner's settings again.
+	class ScopedLogManager final
+	{
+	public:
+		explicit ScopedLogManager(const LogSettings& settings)
+		{
+			LogManager::ShutDown();
+			LogManager::StartUp(settings);
+		}
+
+		~ScopedLogManager()
+		{
+			if (LogManager::IsInitialized())
+			{
+				LogManager::ShutDown();
+			}
+			LogManager::StartUp(GojoTests::GetTestLogSettings());
+		}
+
+		// @brief Shuts the manager down early, every pending record reaches the sinks.
+		void ShutDown() { LogManager::ShutDown(); }
+	};
+
+	// @brief Empty directory for binary log segments, removed with the object.
+	class ScopedLogDirectory final
+	{
+	public:
+		explicit ScopedLogDirectory(std::string_view name)
+			: mPath(std::filesystem::temp_directory_path() / name)
+		{
+			std::filesystem::remove_all(mPath);
+			std::filesystem::create_directories(mPath);
+		}
+
+		~ScopedLogDirectory()
+		{
+			std::error_code error;
+			std::filesystem::remove_all(mPath, error);
+		}
+
+		[[nodiscard]] const std::filesystem::path& GetPath() const { return mPath; }
+
+	private:
+		std::filesystem::path mPath;
+	};
+
+	// @brief Calls "visitor(format, arguments)" for every binary message record in "directory", segment by segment.
+	//        A message whose site was not declared earlier in its segment is reported with an empty format.
+	template<typename VisitorT>
+	void ForEachBinaryLogMessage(const std::filesystem::path& directory, VisitorT&& visitor)
+	{
+		for (const auto& entry : std::filesystem::directory_iterator(directory))
+		{
+			MappedFile file;
+			if (entry.path().extension() != cBinaryLogExtension || !file.Open(entry.path(), MappedFile::Access::ReadOnly))
+				continue;
+
+			const std::byte* data = file.GetData();
+			std::unordered_map<uint32_t, std::string_view> siteFormats;		// Site ids are only declared inside a segment
+
+			size_t offset = AlignBinaryLogRecord(sizeof(BinaryLogSegmentHeader));
+			while (offset + sizeof(BinaryLogRecordHeader) <= file.GetSize())
+			{
+				BinaryLogRecordHeader header{};
+				std::memcpy(&header, data + offset, sizeof(header));
+				if (header.Type == BinaryLogRecordType::End || header.Size < sizeof(header))
+					break;
+
+				const std::byte* body = data + offset + sizeof(header);
+				if (header.Type == BinaryLogRecordType::Site)
+				{
+					BinaryLogSiteRecord site{};
+					std::memcpy(&site, body, sizeof(site));
+
+					const char* text = reinterpret_cast<const char*>(body + sizeof(site) + site.ArgCount * sizeof(LogArgType));
+					siteFormats.insert_or_assign(site.SiteId, std::string_view(text + site.CategoryLength + site.FileLength, site.FormatLength));
+				}
+				else if (header.Type == BinaryLogRecordType::Message)
+				{
+					BinaryLogMessageRecord message{};
+					std::memcpy(&message, body, sizeof(message));
+
+					const auto format = siteFormats.find(message.SiteId);
+					visitor(format != siteFormats.end() ? format->second : std::string_view(), std::span(body + sizeof(message), message.ArgumentsSize));
+				}
+
+				offset += header.Size;
+			}
+		}
+	}
+
+	// @brief Counts the binary records of messages whose site format is "format", across every segment in "directory".
+	size_t CountBinaryLogMessages(const std::filesystem::path& directory, std::string_view format)
+	{
+		size_t count = 0;
+		ForEachBinaryLogMessage(directory, [&count, format](std::string_view messageFormat, std::span<const std::byte>) { count += messageFormat == format ? 1 : 0; });
+		return count;
+	}
+
+	// @brief Captures the arguments the way LogManager::Log does and formats them back like the backend.
+	template<typename... ArgsT>
+	std::string FormatThroughCapture(std::string_view format, const ArgsT&... args)
+	{
+		const std::tuple captured{ CaptureLogArg(args)... };
+		const size_t size = std::apply([](const auto&... values) { return (size_t{ 0 } + ... + GetCapturedLogArgSize(values)); }, captured);
+
+		std::vector<std::byte> buffer(size);
+		std::apply([destination = buffer.data()](const auto&... values) mutable { ((destination = WriteCapturedLogArg(destination, values)), ...); }, captured);
+
+		std::string output;
+		cLogArgsLayout<ArgsT...>.Format(output, format, buffer.data());
+		return output;
+	}
+
+	// @brief Synchronous manager writing every level to a binary sink in "directory" only.
+	LogSettings MakeBinarySettings(const std::filesystem::path& directory)
+	{
+		LogSettings settings;
+		settings.Mode = LogMode::Synchronous;
+		settings.ConsoleLevel = LogLevel::Off;
+		settings.BinaryLogDirectory = directory;
+		return settings;
+	}
+
+	constexpr std::string_view cTestMessageFormat = "Test message {} from thread {}";
+
+	// @brief Logs "messagesPerThread" messages from each of "threadCount" threads at once.
+	void LogFromThreads(uint32_t threadCount, uint32_t messagesPerThread)
+	{
+		std::vector<std::jthread> threads;
+		for (uint32_t thread = 0; thread < threadCount; ++thread)
+		{
+			threads.emplace_back([thread, messagesPerThread]()
+				{
+					for (uint32_t message = 0; message < messagesPerThread; ++message)
+					{
+						GOJO_LOG("Tests", Info, "Test message {} from thread {}", message, thread);
+					}
+				});
+		}
+	}
+
+	LogSettings MakeAsynchronousSettings(LogOverflowPolicy policy, const std::filesystem::path& directory)
+	{
+		LogSettings settings;
+		settings.Mode = LogMode::Asynchronous;
+		settings.OverflowPolicy = policy;
+		settings.QueueCapacity = 16;					// Tiny, so the producers keep running into a full queue
+		settings.ConsoleLevel = LogLevel::Off;
+		settings.BinaryLogDirectory = directory;
+		return settings;
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(AsynchronousLoggingWithTheBlockPolicyLosesNoMessage)
+{
+	constexpr uint32_t cThreadCount = 4;
+	constexpr uint32_t cMessagesPerThread = 5'000;
+
+	ScopedLogDirectory directory("GojoTests_LogBlock");
+	ScopedLogManager logManager(MakeAsynchronousSettings(LogOverflowPolicy::Block, directory.GetPath()));
+
+	LogFromThreads(cThreadCount, cMessagesPerThread);
+	GOJO_CHECK(LogManager::GetInstance().GetDroppedMessageCount() == 0);
+
+	// ShutDown drains the queue
+	logManager.ShutDown();
+	GOJO_CHECK(CountBinaryLogMessages(directory.GetPath(), cTestMessageFormat) == cThreadCount * cMessagesPerThread);
+}
+
+GOJO_TEST(AsynchronousLoggingCountsEveryDroppedMessage)
+{
+	constexpr uint32_t cThreadCount = 4;
+	constexpr uint32_t cMessagesPerThread = 5'000;
+
+	for (LogOverflowPolicy policy : { LogOverflowPolicy::Drop, LogOverflowPolicy::DropOldest })
+	{
+		ScopedLogDirectory directory("GojoTests_LogDrop");
+		ScopedLogManager logManager(MakeAsynchronousSettings(policy, directory.GetPath()));
+
+		LogFromThreads(cThreadCount, cMessagesPerThread);
+		LogManager::GetInstance().Flush();
+		const uint64_t droppedCount = LogManager::GetInstance().GetDroppedMessageCount();
+
+		logManager.ShutDown();
+		GOJO_CHECK(CountBinaryLogMessages(directory.GetPath(), cTestMessageFormat) + droppedCount == cThreadCount * cMessagesPerThread);
+	}
+}
+
+GOJO_TEST(InvalidCategoryLevelsAreReportedOnceTheManagerRuns)
+{
+	ScopedLogDirectory directory("GojoTests_LogLevels");
+
+	// The error is raised while the constructor runs, before GetInstance() is available
+	LogSettings settings;
+	settings.Mode = LogMode::Synchronous;
+	settings.ConsoleLevel = LogLevel::Off;
+	settings.CategoryLevels = "TestsConfigured=Error,TestsBroken=Loud,=Info";
+	settings.BinaryLogDirectory = directory.GetPath();
+	ScopedLogManager logManager(settings);
+
+	// Valid entries are applied anyway
+	GOJO_CHECK(LogCategory::Get("TestsConfigured").GetLevel() == LogLevel::Error);
+	GOJO_CHECK(LogCategory::Find("TestsBroken") == nullptr);
+
+	logManager.ShutDown();
+	GOJO_CHECK(CountBinaryLogMessages(directory.GetPath(), "[{}] {}") == 1);
+}
+
+GOJO_TEST(LogLevelNamesRoundTrip)
+{
+	for (size_t index = 0; index < std::size(cLogLevelNames); ++index)
+	{
+		const auto level = static_cast<LogLevel>(index);
+
+		LogLevel parsedLevel{};
+		GOJO_CHECK(LogCategory::ParseLevel(GetLogLevelName(level), parsedLevel) && parsedLevel == level);
+	}
+
+	LogLevel parsedLevel{};
+	GOJO_CHECK(LogCategory::ParseLevel("Warning", parsedLevel) && parsedLevel == LogLevel::Warning);
+	GOJO_CHECK(!LogCategory::ParseLevel("Loud", parsedLevel));
+	GOJO_CHECK(GetLogLevelName(static_cast<LogLevel>(200)) == "unknown");
+}
+
+GOJO_TEST(BinaryLogSegmentsRotateAndStaySelfContained)
+{
+	constexpr uint32_t cMessageCount = 2'000;
+	constexpr uint32_t cSegmentCount = 3;
+	constexpr std::string_view cFormat = "Rotated message {} of {}";
+
+	ScopedLogDirectory directory("GojoTests_LogRotation");
+
+	// Segments of a few kilobytes, so the messages fill several of them
+	LogSettings settings;
+	settings.Mode = LogMode::Synchronous;
+	settings.ConsoleLevel = LogLevel::Off;
+	settings.BinaryLogDirectory = directory.GetPath();
+	settings.BinarySegmentSize = 8 * 1024;
+	settings.BinarySegmentCount = cSegmentCount;
+	ScopedLogManager logManager(settings);
+
+	for (uint32_t message = 0; message < cMessageCount; ++message)
+	{
+		GOJO_LOG("Tests", Info, "Rotated message {} of {}", message, cMessageCount);
+	}
+	logManager.ShutDown();
+
+	const auto segmentFiles = std::ranges::count_if(std::filesystem::directory_iterator(directory.GetPath()),
+		[](const std::filesystem::directory_entry& entry) { return entry.path().extension() == cBinaryLogExtension; });
+	GOJO_CHECK(segmentFiles == cSegmentCount);
+
+	// Only the newest messages are left, each segment declares the sites it uses
+	bool isEverySiteDeclared = true;
+	std::vector<uint32_t> messages;
+	ForEachBinaryLogMessage(directory.GetPath(), [&](std::string_view format, std::span<const std::byte> arguments)
+		{
+			isEverySiteDeclared &= !format.empty();
+			if (format == cFormat && arguments.size() >= sizeof(uint32_t))
+			{
+				uint32_t message = 0;
+				std::memcpy(&message, arguments.data(), sizeof(message));
+				messages.push_back(message);
+			}
+		});
+	std::ranges::sort(messages);
+
+	GOJO_CHECK(isEverySiteDeclared);
+	GOJO_CHECK(!messages.empty() && messages.size() < cMessageCount);
+	GOJO_CHECK(!messages.empty() && messages.back() == cMessageCount - 1);
+	GOJO_CHECK(std::ranges::adjacent_find(messages, [](uint32_t lhs, uint32_t rhs) { return rhs != lhs + 1; }) == messages.end());
+}
+
+GOJO_TEST(LogArgumentHashesTellValuesApart)
+{
+	GOJO_CHECK(HashLogArgs(1, "a") == HashLogArgs(1, std::string("a")));
+	GOJO_CHECK(HashLogArgs(1, "a") != HashLogArgs(2, "a"));
+
+	// Types without a binary form or a std::hash (durations) are compared by their text
+	GOJO_CHECK(HashLogArgs(std::chrono::milliseconds(16)) == HashLogArgs(std::chrono::milliseconds(16)));
+	GOJO_CHECK(HashLogArgs(std::chrono::milliseconds(16)) != HashLogArgs(std::chrono::milliseconds(17)));
+}
+
+GOJO_TEST(RateLimiterLetsTheConfiguredCountThroughPerWindow)
+{
+	constexpr uint32_t cMessageCount = 100;
+	constexpr uint32_t cMaxPerSecond = 5;
+
+	LogRateLimiter limiter(cMaxPerSecond);
+	uint32_t acquiredCount = 0;
+	uint64_t suppressedCount = 0;
+	for (uint32_t message = 0; message < cMessageCount; ++message)
+	{
+		acquiredCount += limiter.TryAcquire(suppressedCount) ? 1 : 0;
+	}
+
+	// A single window (the loop takes far less than a second)
+	GOJO_CHECK(acquiredCount == cMaxPerSecond);
+	GOJO_CHECK(suppressedCount == 0);
+}
+
+GOJO_TEST(RepeatsAtTheEndOfABurstAreReportedOnShutDown)
+{
+	constexpr uint32_t cRepeatCount = 50;
+
+	ScopedLogDirectory directory("GojoTests_LogDedup");
+	ScopedLogManager logManager(MakeBinarySettings(directory.GetPath()));
+
+	// One message let through, the rest are repeats with nothing logged after them
+	for (uint32_t repeat = 0; repeat < cRepeatCount; ++repeat)
+	{
+		GOJO_LOG_INFO_DEDUP("Tests", "Deduplicated frame time {}", std::chrono::milliseconds(16));
+	}
+	GOJO_CHECK(CountBinaryLogMessages(directory.GetPath(), "Deduplicated frame time {}") == 1);
+
+	logManager.ShutDown();
+
+	uint64_t reportedRepeats = 0;
+	ForEachBinaryLogMessage(directory.GetPath(), [&reportedRepeats](std::string_view format, std::span<const std::byte> arguments)
+		{
+			// Arguments: category (length + text), then the repeat count
+			uint32_t categoryLength = 0;
+			if (format.find("repeated") == std::string_view::npos || arguments.size() < sizeof(categoryLength))
+				return;
+
+			std::memcpy(&categoryLength, arguments.data(), sizeof(categoryLength));
+			if (arguments.size() >= sizeof(categoryLength) + categoryLength + sizeof(uint64_t))
+			{
+				std::memcpy(&reportedRepeats, arguments.data() + sizeof(categoryLength) + categoryLength, sizeof(reportedRepeats));
+			}
+		});
+	GOJO_CHECK(reportedRepeats == cRepeatCount - 1);
+}
+
+GOJO_TEST(CapturedLogArgumentsFormatLikeStdFormat)
+{
+	const std::string text = "owned";
+	const char* nullText = nullptr;
+	const int value = 42;
+
+	GOJO_CHECK(FormatThroughCapture("{} {} {} {}", -7, 7u, int64_t{ -1 } << 40, uint64_t{ 1 } << 63) == std::format("{} {} {} {}", -7, 7u, int64_t{ -1 } << 40, uint64_t{ 1 } << 63));
+	GOJO_CHECK(FormatThroughCapture("{:.2f} {} {:>6}", 3.14159, 2.5f, 'x') == std::format("{:.2f} {} {:>6}", 3.14159, 2.5f, 'x'));
+	GOJO_CHECK(FormatThroughCapture("{} {} [{}] {}", true, "literal", std::string_view("view"), text) == "true literal [view] owned");
+	GOJO_CHECK(FormatThroughCapture("[{}]", nullText) == "[]");
+	GOJO_CHECK(FormatThroughCapture("{}", static_cast<const void*>(&value)) == std::format("{}", static_cast<const void*>(&value)));
+
+	// Types without a binary representation are captured as their formatted text
+	GOJO_CHECK(FormatThroughCapture("{}", std::chrono::milliseconds(16)) == "16ms");
+}
+
+// ====================================================================================================
+// Benchmarks
+// ====================================================================================================
+
+GOJO_BENCHMARK(LogCallLatency)
+{
+	constexpr uint32_t cMessageCount = 200'000;
+
+	for (LogMode mode : { LogMode::Synchronous, LogMode::Asynchronous })
+	{
+		// Console output off: measures the cost on the calling thread, not the terminal
+		LogSettings settings;
+		settings.Mode = mode;
+		settings.QueueCapacity = cMessageCount;
+		settings.ConsoleLevel = LogLevel::Off;
+		ScopedLogManager logManager(settings);
+
+		const double seconds = GojoTests::MeasureSeconds([]()
+			{
+				for (uint32_t message = 0; message < cMessageCount; ++message)
+				{
+					GOJO_LOG("Tests", Info, "Frame {} took {} ms on {}", message, 16.6, "MainThread");
+				}
+			});
+
+		GojoTests::ReportMeasurement(mode == LogMode::Synchronous ? "Synchronous" : "Asynchronous", seconds * 1e9 / cMessageCount, "ns/call");
+	}
+}
+
+GOJO_BENCHMARK(LogArgumentCaptureVersusFormat)
+{
+	constexpr uint32_t cIterationCount = 1'000'000;
+	const std::string_view window = "MainWindow";
+
+	// What the calling thread pays with deferred formatting: capture into a preallocated record
+	std::vector<std::byte> record(256);
+	const double captureSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			for (uint32_t iteration = 0; iteration < cIterationCount; ++iteration)
+			{
+				const std::tuple captured{ CaptureLogArg(iteration), CaptureLogArg(16.6), CaptureLogArg(window) };
+				std::apply([destination = record.data()](const auto&... values) mutable { ((destination = WriteCapturedLogArg(destination, values)), ...); }, captured);
+			}
+		});
+
+	// What it paid before: formatting into a string
+	size_t formattedSize = 0;
+	const double formatSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			for (uint32_t iteration = 0; iteration < cIterationCount; ++iteration)
+			{
+				formattedSize += std::format("Frame {} took {} ms on {}", iteration, 16.6, window).size();
+			}
+		});
+
+	GojoTests::ReportMeasurement("Capture arguments", captureSeconds * 1e9 / cIterationCount, "ns/call");
+	GojoTests::ReportMeasurement("std::format", formatSeconds * 1e9 / cIterationCount, "ns/call");
+	// Reads both results, so neither loop is optimized away
+	GOJO_CHECK(formattedSize > 0 && record[0] != std::byte{ 0xFF });
+}
@@ -0,0 +1,271 @@
+#include "TestFramework.h"
+
+#include <Core/Memory/FixedSizePool.h>
+#include <Core/Memory/MemoryTracker.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	// Tests account to a tag no engine system uses while they run
+	constexpr MemoryTag cTestTag = MemoryTag::General;
+
+	bool IsAligned(const void* memory, size_t alignment)
+	{
+		return reinterpret_cast<uintptr_t>(memory) % alignment == 0;
+	}
+
+	bool IsSiteLive(const MemorySite& site)
+	{
+		const std::vector<MemorySiteStats> sites = MemoryTracker::GetLiveSites(SIZE_MAX);
+		return std::ranges::any_of(sites, [&site](const MemorySiteStats& stats) { return stats.File == site.File && stats.Line == site.Line; });
+	}
+
+	struct TrackedBase
+	{
+		virtual ~TrackedBase() = default;
+		uint64_t BaseValue{ 1 };
+	};
+
+	struct TrackedExtra
+	{
+		virtual ~TrackedExtra() = default;
+		uint64_t ExtraValue{ 2 };
+	};
+
+	// The TrackedExtra subobject does not start where the block starts
+	struct TrackedDerived final : TrackedBase, TrackedExtra
+	{
+		explicit TrackedDerived(bool& isDestroyed) : IsDestroyed(isDestroyed) {}
+		~TrackedDerived() override { IsDestroyed = true; }
+		bool& IsDestroyed;
+	};
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(TrackedAllocationsAreAccountedToTheirTagAndSite)
+{
+	static MemorySite sSite{ cTestTag, "MemoryTests", 1 };
+	const MemoryTagStats before = MemoryTracker::GetTagStats(cTestTag);
+
+	void* memory = MemoryTracker::Allocate(100, 64, sSite);
+	GOJO_CHECK(IsAligned(memory, 64));
+	std::memset(memory, 0xCD, 100);
+
+	const MemoryTagStats during = MemoryTracker::GetTagStats(cTestTag);
+	GOJO_CHECK(during.CurrentBytes == before.CurrentBytes + 100);
+	GOJO_CHECK(during.CurrentCount == before.CurrentCount + 1);
+	GOJO_CHECK(during.TotalCount == before.TotalCount + 1);
+	GOJO_CHECK(during.PeakBytes >= during.CurrentBytes);
+	GOJO_CHECK(sSite.LiveBytes.load() == 100);
+	GOJO_CHECK(IsSiteLive(sSite));
+
+	MemoryTracker::Free(memory);
+	const MemoryTagStats after = MemoryTracker::GetTagStats(cTestTag);
+	GOJO_CHECK(after.CurrentBytes == before.CurrentBytes);
+	GOJO_CHECK(after.CurrentCount == before.CurrentCount);
+	GOJO_CHECK(!IsSiteLive(sSite));
+	GOJO_CHECK(MemoryTracker::GetTagName(MemoryTag::Vulkan) == "Vulkan");
+}
+
+GOJO_TEST(ReallocateFollowsReallocSemantics)
+{
+	static MemorySite sSite{ cTestTag, "MemoryTests", 2 };
+
+	auto* memory = static_cast<uint8_t*>(MemoryTracker::Reallocate(nullptr, 16, 16, sSite));
+	for (uint8_t index = 0; index < 16; ++index)
+	{
+		memory[index] = index;
+	}
+
+	memory = static_cast<uint8_t*>(MemoryTracker::Reallocate(memory, 4096, 256, sSite));
+	GOJO_CHECK(IsAligned(memory, 256));
+	GOJO_CHECK(memory[0] == 0 && memory[15] == 15);
+	GOJO_CHECK(sSite.LiveBytes.load() == 4096 && sSite.LiveCount.load() == 1);
+
+#if !defined(__SANITIZE_ADDRESS__)
+	// A failed reallocation throws and leaves the block intact (the Vulkan callbacks turn it into nullptr)
+	bool hasThrown = false;
+	try
+	{
+		(void)MemoryTracker::Reallocate(memory, SIZE_MAX / 2, 16, sSite);
+	}
+	catch (const std::bad_alloc&)
+	{
+		hasThrown = true;
+	}
+	GOJO_CHECK(hasThrown);
+	GOJO_CHECK(memory[15] == 15 && sSite.LiveBytes.load() == 4096);
+#endif
+
+	GOJO_CHECK(MemoryTracker::Reallocate(memory, 0, 16, sSite) == nullptr);
+	GOJO_CHECK(sSite.LiveBytes.load() == 0 && sSite.LiveCount.load() == 0);
+}
+
+GOJO_TEST(TrackedDeleteFreesThroughAnyBase)
+{
+	static MemorySite sSite{ cTestTag, "MemoryTests", 3 };
+
+	bool isDestroyed = false;
+	TrackedExtra* object = TrackedNew<TrackedDerived>(sSite, isDestroyed);
+	GOJO_CHECK(sSite.LiveCount.load() == 1);
+
+	TrackedDelete(object);
+	GOJO_CHECK(isDestroyed);
+	GOJO_CHECK(sSite.LiveCount.load() == 0 && sSite.LiveBytes.load() == 0);
+
+	// Tagged containers account to their tag
+	const MemoryTagStats before = MemoryTracker::GetTagStats(MemoryTag::ECS);
+	{
+		TaggedVector<uint64_t, MemoryTag::ECS> values(1000, 7);
+		GOJO_CHECK(MemoryTracker::GetTagStats(MemoryTag::ECS).CurrentBytes >= before.CurrentBytes + 1000 * sizeof(uint64_t));
+	}
+	GOJO_CHECK(MemoryTracker::GetTagStats(MemoryTag::ECS).CurrentBytes == before.CurrentBytes);
+}
+
+GOJO_TEST(FixedSizePoolReusesItsChunks)
+{
+	static MemorySite sSite{ cTestTag, "MemoryTests", 4 };
+	FixedSizePool pool(24, 16, sSite);
+	GOJO_CHECK(pool.GetBlockSize() % alignof(std::max_align_t) == 0);
+
+	std::set<void*> blocks;
+	for (uint32_t index = 0; index < 40; ++index)
+	{
+		void* block = pool.Allocate();
+		GOJO_CHECK(IsAligned(block, alignof(std::max_align_t)));
+		blocks.insert(block);
+	}
+	GOJO_CHECK(blocks.size() == 40);
+	GOJO_CHECK(pool.GetChunkCount() == 3);
+	GOJO_CHECK(pool.GetLiveBlockCount() == 40);
+
+	// Freed blocks come back without new chunks
+	for (void* block : blocks)
+	{
+		pool.Free(block);
+	}
+	for (uint32_t index = 0; index < 40; ++index)
+	{
+		GOJO_CHECK(blocks.contains(pool.Allocate()));
+	}
+	GOJO_CHECK(pool.GetChunkCount() == 3);
+
+	// Trim only gives the chunks back once nothing is in use
+	pool.Trim();
+	GOJO_CHECK(pool.GetChunkCount() == 3);
+	for (void* block : blocks)
+	{
+		pool.Free(block);
+	}
+	pool.Trim();
+	GOJO_CHECK(pool.GetChunkCount() == 0);
+	GOJO_CHECK(sSite.LiveCount.load() == 0);
+}
+
+GOJO_TEST(FixedSizePoolIsThreadSafe)
+{
+	static MemorySite sSite{ cTestTag, "MemoryTests", 5 };
+	FixedSizePool pool(64, 32, sSite);
+
+	std::atomic<bool> isExclusive{ true };
+	std::vector<std::thread> threads;
+	for (uint32_t thread = 0; thread < 4; ++thread)
+	{
+		threads.emplace_back([&pool, &isExclusive, thread]()
+			{
+				std::vector<uint32_t*> held;
+				for (uint32_t iteration = 0; iteration < 20000; ++iteration)
+				{
+					auto* block = static_cast<uint32_t*>(pool.Allocate());
+					*block = thread;
+					held.push_back(block);
+
+					if (held.size() == 8)
+					{
+						// A block handed to two threads at once would have been overwritten
+						for (uint32_t* heldBlock : held)
+						{
+							if (*heldBlock != thread)
+							{
+								isExclusive.store(false, std::memory_order_relaxed);
+							}
+							pool.Free(heldBlock);
+						}
+						held.clear();
+					}
+				}
+				for (uint32_t* heldBlock : held)
+				{
+					pool.Free(heldBlock);
+				}
+			});
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	GOJO_CHECK(isExclusive.load());
+	GOJO_CHECK(pool.GetLiveBlockCount() == 0);
+}
+
+// ====================================================================================================
+// Benchmarks
+// ====================================================================================================
+
+GOJO_BENCHMARK(FixedSizePoolVersusHeap)
+{
+	static MemorySite sSite{ cTestTag, "MemoryTests", 6 };
+	FixedSizePool pool(48, 1024, sSite);
+
+	constexpr uint32_t cRoundCount = 1000;
+	constexpr uint32_t cBlockCount = 1000;
+	std::vector<void*> blocks(cBlockCount);
+
+	const double poolSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			for (uint32_t round = 0; round < cRoundCount; ++round)
+			{
+				for (void*& block : blocks)
+				{
+					block = pool.Allocate();
+				}
+				for (void* block : blocks)
+				{
+					pool.Free(block);
+				}
+			}
+		});
+
+	const double trackedSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			for (uint32_t round = 0; round < cRoundCount; ++round)
+			{
+				for (void*& block : blocks)
+				{
+					block = MemoryTracker::Allocate(48, alignof(std::max_align_t), sSite);
+				}
+				for (void* block : blocks)
+				{
+					MemoryTracker::Free(block);
+				}
+			}
+		});
+
+	constexpr double cOperationCount = double(cRoundCount) * cBlockCount;
+	GojoTests::ReportMeasurement("PoolAllocateFree", poolSeconds * 1e9 / cOperationCount, "ns/block");
+	GojoTests::ReportMeasurement("TrackedHeapAllocateFree", trackedSeconds * 1e9 / cOperationCount, "ns/block");
+}
@@ -0,0 +1,230 @@
+#include "TestFramework.h"
+
+#include <Core/Metrics/Metrics.h>
+#include <Managers/MetricsExporter/MetricsExporter.h>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	constexpr uint32_t cThreadCount = 8;
+
+	std::string ReadText(const std::filesystem::path& path)
+	{
+		std::ifstream file(path);
+		return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+
+	template<typename FunctionT>
+	void RunOnThreads(uint32_t threadCount, FunctionT&& function)
+	{
+		std::vector<std::thread> threads;
+		for (uint32_t thread = 0; thread < threadCount; ++thread)
+		{
+			threads.emplace_back(function);
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(CountersStayExactAcrossThreads)
+{
+	Counter& counter = MetricsRegistry::GetCounter("gojo_tests_exact_total", "Test counter.", "thread=\"any\"");
+	GOJO_CHECK(&counter == &MetricsRegistry::GetCounter("gojo_tests_exact_total", "Test counter.", "thread=\"any\""));
+	GOJO_CHECK(&counter != &MetricsRegistry::GetCounter("gojo_tests_exact_total", "Test counter.", "thread=\"other\""));
+
+	const uint64_t before = counter.GetValue();
+	RunOnThreads(cThreadCount, [&counter]()
+		{
+			for (uint32_t index = 0; index < 100000; ++index)
+			{
+				counter.Add();
+			}
+		});
+	GOJO_CHECK(counter.GetValue() == before + cThreadCount * 100000);
+}
+
+GOJO_TEST(HistogramBucketsBoundEveryValueWithinASixteenth)
+{
+	bool isBounded = true;
+	bool isMonotonic = true;
+	size_t previousIndex = 0;
+
+	const auto check = [&](uint64_t value)
+		{
+			const size_t index = Histogram::GetBucketIndex(value);
+			const uint64_t upperBound = Histogram::GetBucketUpperBound(index);
+
+			// The value lies in (upper bound of the previous bucket, upper bound]
+			isBounded &= value <= upperBound && (index == 0 || Histogram::GetBucketUpperBound(index - 1) < value);
+			isBounded &= upperBound - value <= value / Histogram::cSubBucketCount;
+			isMonotonic &= index >= previousIndex;
+			previousIndex = index;
+		};
+
+	for (uint64_t value = 0; value < 100000; ++value)
+	{
+		check(value);
+	}
+	for (uint32_t bit = 17; bit < Histogram::cMaxValueBits; ++bit)
+	{
+		check((uint64_t{ 1 } << bit) - 1);
+		check(uint64_t{ 1 } << bit);
+		check((uint64_t{ 1 } << bit) + 1);
+	}
+	GOJO_CHECK(isBounded);
+	GOJO_CHECK(isMonotonic);
+
+	GOJO_CHECK(Histogram::GetBucketIndex(Histogram::cMaxValue) == Histogram::cBucketCount - 1);
+	GOJO_CHECK(Histogram::GetBucketIndex(Histogram::cMaxValue + 1) == Histogram::cBucketCount - 1);
+	GOJO_CHECK(Histogram::GetBucketIndex(UINT64_MAX) == Histogram::cBucketCount - 1);
+}
+
+GOJO_TEST(HistogramQuantilesAreWithinTheBucketPrecision)
+{
+	Histogram& histogram = MetricsRegistry::GetHistogram("gojo_tests_quantile_microseconds", "Test histogram.");
+	GOJO_CHECK(histogram.GetSnapshot().GetValueAtQuantile(0.5) == 0);
+
+	RunOnThreads(4, [&histogram]()
+		{
+			for (uint64_t value = 1; value <= 1000; ++value)
+			{
+				histogram.Record(value);
+			}
+		});
+
+	const HistogramSnapshot snapshot = histogram.GetSnapshot();
+	GOJO_CHECK(snapshot.Count == 4000);
+	GOJO_CHECK(snapshot.Sum == 4 * 500500);
+
+	const auto isNear = [](uint64_t value, uint64_t expected) { return value >= expected && value - expected <= expected / 16; };
+	GOJO_CHECK(snapshot.GetValueAtQuantile(0.0) == 1);
+	GOJO_CHECK(isNear(snapshot.GetValueAtQuantile(0.5), 500));
+	GOJO_CHECK(isNear(snapshot.GetValueAtQuantile(0.99), 990));
+	GOJO_CHECK(isNear(snapshot.GetValueAtQuantile(1.0), 1000));
+}
+
+GOJO_TEST(SnapshotUsesThePrometheusTextFormat)
+{
+	MetricsRegistry::GetCounter("gojo_tests_snapshot_total", "Test \"counter\".", "type=\"A\"").Add(3);
+	MetricsRegistry::GetGauge("gojo_tests_snapshot_gauge", "Test gauge.", std::format("name=\"{}\"", MetricsRegistry::EscapeLabelValue("a\"b\\c\n"))).Set(1.5);
+
+	Histogram& histogram = MetricsRegistry::GetHistogram("gojo_tests_snapshot_microseconds", "Test histogram.");
+	histogram.Record(3);
+	histogram.Record(100);
+
+	const std::string snapshot = MetricsRegistry::GetSnapshot();
+	GOJO_CHECK(snapshot.find("# TYPE gojo_tests_snapshot_total counter\ngojo_tests_snapshot_total{type=\"A\"} 3\n") != std::string::npos);
+	GOJO_CHECK(snapshot.find("# HELP gojo_tests_snapshot_total Test \"counter\".\n") != std::string::npos);
+	GOJO_CHECK(snapshot.find("gojo_tests_snapshot_gauge{name=\"a\\\"b\\\\c\\n\"} 1.5\n") != std::string::npos);
+
+	// Cumulative buckets, only the ones in use
+	const uint64_t upperBound = Histogram::GetBucketUpperBound(Histogram::GetBucketIndex(100));
+	GOJO_CHECK(snapshot.find("# TYPE gojo_tests_snapshot_microseconds histogram\n") != std::string::npos);
+	GOJO_CHECK(snapshot.find("gojo_tests_snapshot_microseconds_bucket{le=\"3\"} 1\n") != std::string::npos);
+	GOJO_CHECK(snapshot.find(std::format("gojo_tests_snapshot_microseconds_bucket{{le=\"{}\"}} 2\n", upperBound)) != std::string::npos);
+	GOJO_CHECK(snapshot.find("gojo_tests_snapshot_microseconds_bucket{le=\"+Inf\"} 2\n") != std::string::npos);
+	GOJO_CHECK(snapshot.find("gojo_tests_snapshot_microseconds_sum 103\n") != std::string::npos);
+	GOJO_CHECK(snapshot.find("gojo_tests_snapshot_microseconds_count 2\n") != std::string::npos);
+	GOJO_CHECK(snapshot.find("gojo_tests_snapshot_microseconds_bucket{le=\"4\"}") == std::string::npos);
+}
+
+GOJO_TEST(MetricsExporterRewritesTheSnapshotFile)
+{
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "GojoTests_Metrics.prom";
+	std::filesystem::remove(path);
+
+	Counter& counter = MetricsRegistry::GetCounter("gojo_tests_exported_total", "Test counter.");
+	counter.Add();
+
+	MetricsExporterSettings settings;
+	settings.SnapshotPath = path;
+	settings.SnapshotInterval = std::chrono::milliseconds(10);
+	MetricsExporter::StartUp(settings);
+
+	for (uint32_t attempt = 0; attempt < 500 && !std::filesystem::exists(path); ++attempt)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	}
+	GOJO_CHECK(ReadText(path).find("gojo_tests_exported_total ") != std::string::npos);
+
+	// The final snapshot is written on shutdown
+	counter.Add(41);
+	const std::string expected = std::format("gojo_tests_exported_total {}\n", counter.GetValue());
+	MetricsExporter::ShutDown();
+	GOJO_CHECK(ReadText(path).find(expected) != std::string::npos);
+
+	std::filesystem::remove(path);
+}
+
+// ====================================================================================================
+// Benchmarks
+// ====================================================================================================
+
+GOJO_BENCHMARK(MetricsRecordingOverhead)
+{
+	constexpr uint32_t cOperationCount = 1000000;
+
+	Counter& counter = MetricsRegistry::GetCounter("gojo_tests_benchmark_total", "Benchmark counter.");
+	Histogram& histogram = MetricsRegistry::GetHistogram("gojo_tests_benchmark_microseconds", "Benchmark histogram.");
+	std::atomic<uint64_t> sharedCounter{ 0 };
+
+	// Contended: every thread records cOperationCount values
+	const double shardedSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			RunOnThreads(cThreadCount, [&counter]()
+				{
+					for (uint32_t index = 0; index < cOperationCount; ++index)
+					{
+						counter.Add();
+					}
+				});
+		});
+
+	const double sharedSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			RunOnThreads(cThreadCount, [&sharedCounter]()
+				{
+					for (uint32_t index = 0; index < cOperationCount; ++index)
+					{
+						sharedCounter.fetch_add(1, std::memory_order_relaxed);
+					}
+				});
+		});
+
+	const double histogramSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			RunOnThreads(cThreadCount, [&histogram]()
+				{
+					for (uint32_t index = 0; index < cOperationCount; ++index)
+					{
+						histogram.Record(index & 0xFFFF);
+					}
+				});
+		});
+
+	const double snapshotSeconds = GojoTests::MeasureSeconds([]() { (void)MetricsRegistry::GetSnapshot(); });
+
+	constexpr double cTotalCount = double(cThreadCount) * cOperationCount;
+	GojoTests::ReportMeasurement("CounterAddSharded", shardedSeconds * 1e9 / cTotalCount, "ns/op");
+	GojoTests::ReportMeasurement("CounterAddSingleAtomic", sharedSeconds * 1e9 / cTotalCount, "ns/op");
+	GojoTests::ReportMeasurement("HistogramRecord", histogramSeconds * 1e9 / cTotalCount, "ns/op");
+	GojoTests::ReportMeasurement("RegistrySnapshot", snapshotSeconds * 1e6, "us");
+}
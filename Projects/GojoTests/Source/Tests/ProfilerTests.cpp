@@ -0,0 +1,135 @@
+#include "TestFramework.h"
+
+#include <Core/Profiler/Profiler.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <thread>
+
+using namespace GojoEngine;
+
+namespace
+{
+	std::string ExportTrace()
+	{
+		const std::filesystem::path path = std::filesystem::temp_directory_path() / "GojoTests_Trace.json";
+		GOJO_CHECK(Profiler::ExportChromeTrace(path));
+
+		std::ifstream file(path);
+		std::string trace(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>{});
+		file.close();
+		std::filesystem::remove(path);
+		return trace;
+	}
+
+	size_t CountOccurrences(std::string_view text, std::string_view pattern)
+	{
+		size_t count = 0;
+		for (size_t position = text.find(pattern); position != std::string_view::npos; position = text.find(pattern, position + 1))
+		{
+			++count;
+		}
+		return count;
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(ProfilerRecordsNothingWithoutACapture)
+{
+	GOJO_CHECK(!Profiler::IsCapturing());
+	GOJO_CHECK(Profiler::BeginZone() == 0);
+}
+
+GOJO_TEST(CaptureExportsZonesFramesCountersAndThreads)
+{
+	Profiler::StartCapture();
+	GOJO_CHECK(Profiler::IsCapturing());
+	{
+		GOJO_PROFILE_SCOPE("TestOuterZone");
+		{
+			GOJO_PROFILE_SCOPE("TestInnerZone");
+		}
+		GOJO_PROFILE_FRAME(7);
+		GOJO_PROFILE_COUNTER("TestCounter", 3);
+	}
+	std::thread([]()
+		{
+			Profiler::SetThreadName("Tests \"Worker\"");
+			GOJO_PROFILE_SCOPE("TestWorkerZone");
+		}).join();
+	Profiler::StopCapture();
+
+	// Zones that start after the capture stopped are not recorded
+	{
+		GOJO_PROFILE_SCOPE("TestLateZone");
+	}
+
+	const std::string trace = ExportTrace();
+	GOJO_CHECK(trace.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+	GOJO_CHECK(CountOccurrences(trace, "{\"name\":\"TestOuterZone\",\"ph\":\"X\"") == 1);
+	GOJO_CHECK(CountOccurrences(trace, "{\"name\":\"TestInnerZone\",\"ph\":\"X\"") == 1);
+	GOJO_CHECK(CountOccurrences(trace, "{\"name\":\"TestWorkerZone\",\"ph\":\"X\"") == 1);
+	GOJO_CHECK(trace.find("{\"name\":\"Frame 7\",\"ph\":\"i\"") != std::string::npos);
+	GOJO_CHECK(trace.find("{\"name\":\"TestCounter\",\"ph\":\"C\"") != std::string::npos);
+	GOJO_CHECK(trace.find("\"args\":{\"value\":3}") != std::string::npos);
+	GOJO_CHECK(trace.find("\"args\":{\"name\":\"Tests \\\"Worker\\\"\"}") != std::string::npos);
+	GOJO_CHECK(trace.find("TestLateZone") == std::string::npos);
+}
+
+GOJO_TEST(StartingACaptureDiscardsThePreviousOne)
+{
+	Profiler::StartCapture();
+	{
+		GOJO_PROFILE_SCOPE("TestDiscardedZone");
+	}
+
+	Profiler::StartCapture();
+	{
+		GOJO_PROFILE_SCOPE("TestKeptZone");
+	}
+	Profiler::StopCapture();
+
+	const std::string trace = ExportTrace();
+	GOJO_CHECK(trace.find("TestDiscardedZone") == std::string::npos);
+	GOJO_CHECK(CountOccurrences(trace, "TestKeptZone") == 1);
+}
+
+// ====================================================================================================
+// Benchmarks
+// ====================================================================================================
+
+GOJO_BENCHMARK(ProfileScopeCost)
+{
+	constexpr uint32_t cZoneCount = 1000000;
+
+	const double idleSeconds = GojoTests::MeasureSeconds([]()
+		{
+			for (uint32_t index = 0; index < cZoneCount; ++index)
+			{
+				GOJO_PROFILE_SCOPE("BenchmarkZone");
+			}
+		});
+
+	Profiler::StartCapture();
+	const double capturingSeconds = GojoTests::MeasureSeconds([]()
+		{
+			for (uint32_t index = 0; index < cZoneCount; ++index)
+			{
+				GOJO_PROFILE_SCOPE("BenchmarkZone");
+			}
+		});
+	Profiler::StopCapture();
+
+	// Drops the records of this capture
+	Profiler::StartCapture();
+	Profiler::StopCapture();
+
+	GojoTests::ReportMeasurement("ProfileScopeIdle", idleSeconds * 1e9 / cZoneCount, "ns/zone");
+	GojoTests::ReportMeasurement("ProfileScopeCapturing", capturingSeconds * 1e9 / cZoneCount, "ns/zone");
+}
@@ -0,0 +1,177 @@
+#include "TestFramework.h"
+
+#include <Core/Containers/SlotMap.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	struct TestSlotValue
+	{
+		SlotHandle<TestSlotValue> Self;
+		uint32_t Value{ 0 };
+	};
+
+	using TestSlotMap = SlotMap<TestSlotValue>;
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(StaleSlotHandlesNeverResolve)
+{
+	TestSlotMap map;
+	GOJO_CHECK(!TestSlotMap::Handle{}.IsValid());
+	GOJO_CHECK(map.Get(TestSlotMap::Handle{}) == nullptr);
+
+	const TestSlotMap::Handle first = map.Emplace(TestSlotMap::Handle{}, 1u);
+	const TestSlotMap::Handle second = map.Emplace(TestSlotMap::Handle{}, 2u);
+	const TestSlotMap::Handle third = map.Emplace(TestSlotMap::Handle{}, 3u);
+
+	// Removing the first moves the last value into its place, the handles follow
+	GOJO_CHECK(map.Remove(first));
+	GOJO_CHECK(!map.Remove(first));
+	GOJO_CHECK(map.Get(second)->Value == 2 && map.Get(third)->Value == 3);
+	GOJO_CHECK(map.GetSize() == 2);
+
+	// The freed slot is reused with a new generation
+	const TestSlotMap::Handle reused = map.Emplace(TestSlotMap::Handle{}, 4u);
+	GOJO_CHECK(reused.Index == first.Index && reused.Generation != first.Generation);
+	GOJO_CHECK(map.Get(first) == nullptr);
+	GOJO_CHECK(map.Get(reused)->Value == 4);
+
+	// Values that need their own handle
+	const TestSlotMap::Handle self = map.EmplaceWithHandle([](TestSlotMap::Handle handle) { return TestSlotValue{ handle, 5 }; });
+	GOJO_CHECK(map.Get(self)->Self == self);
+
+	for (size_t denseIndex = 0; denseIndex < map.GetSize(); ++denseIndex)
+	{
+		GOJO_CHECK(map.Get(map.GetHandle(denseIndex)) == &map.GetValues()[denseIndex]);
+	}
+}
+
+GOJO_TEST(SlotMapRemoveIfVisitsValuesMovedIntoTheHole)
+{
+	SlotMap<std::unique_ptr<uint32_t>> map;
+	std::vector<SlotMap<std::unique_ptr<uint32_t>>::Handle> handles;
+	for (uint32_t value = 0; value < 100; ++value)
+	{
+		handles.push_back(map.Emplace(std::make_unique<uint32_t>(value)));
+	}
+
+	const size_t removedCount = map.RemoveIf([](auto, const std::unique_ptr<uint32_t>& value) { return *value % 2 == 0; });
+	GOJO_CHECK(removedCount == 50);
+	GOJO_CHECK(map.GetSize() == 50);
+	for (uint32_t value = 0; value < 100; ++value)
+	{
+		const auto* stored = map.Get(handles[value]);
+		GOJO_CHECK((stored != nullptr) == (value % 2 == 1));
+		GOJO_CHECK(!stored || **stored == value);
+	}
+
+	map.Clear();
+	GOJO_CHECK(map.IsEmpty());
+	GOJO_CHECK(map.Get(handles[1]) == nullptr);
+}
+
+GOJO_TEST(SlotMapMatchesAReferenceMapUnderRandomOperations)
+{
+	using Handle = SlotMap<uint64_t>::Handle;
+
+	SlotMap<uint64_t> map;
+	std::unordered_map<Handle, uint64_t> reference;
+	std::vector<Handle> everIssued;
+	std::mt19937 random(1234);
+
+	bool isConsistent = true;
+	for (uint32_t operation = 0; operation < 20000; ++operation)
+	{
+		const uint32_t choice = random() % 3;
+		if (choice < 2 || everIssued.empty())
+		{
+			const uint64_t value = random();
+			const Handle handle = map.Emplace(value);
+			isConsistent &= reference.emplace(handle, value).second;
+			everIssued.push_back(handle);
+		}
+		else
+		{
+			// Removes live and stale handles alike
+			const Handle handle = everIssued[random() % everIssued.size()];
+			isConsistent &= map.Remove(handle) == (reference.erase(handle) == 1);
+		}
+	}
+
+	isConsistent &= map.GetSize() == reference.size();
+	for (const Handle handle : everIssued)
+	{
+		const auto it = reference.find(handle);
+		const uint64_t* value = map.Get(handle);
+		isConsistent &= it == reference.end() ? value == nullptr : value && *value == it->second;
+	}
+
+	// Every live handle is issued once
+	std::unordered_set<Handle> denseHandles;
+	for (size_t denseIndex = 0; denseIndex < map.GetSize(); ++denseIndex)
+	{
+		isConsistent &= denseHandles.insert(map.GetHandle(denseIndex)).second;
+	}
+	GOJO_CHECK(isConsistent);
+}
+
+// ====================================================================================================
+// Benchmarks
+// ====================================================================================================
+
+GOJO_BENCHMARK(SlotMapLookupVersusHashMap)
+{
+	using Handle = SlotMap<uint64_t>::Handle;
+	constexpr uint32_t cElementCount = 100000;
+	constexpr uint32_t cLookupCount = 1000000;
+
+	SlotMap<uint64_t> map;
+	std::unordered_map<Handle, uint64_t> hashMap;
+	std::vector<Handle> handles;
+	for (uint32_t index = 0; index < cElementCount; ++index)
+	{
+		handles.push_back(map.Emplace(index));
+		hashMap.emplace(handles.back(), index);
+	}
+
+	std::mt19937 random(42);
+	std::vector<Handle> lookups(cLookupCount);
+	for (Handle& lookup : lookups)
+	{
+		lookup = handles[random() % cElementCount];
+	}
+
+	uint64_t slotMapSum = 0;
+	const double slotMapSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			for (const Handle lookup : lookups)
+			{
+				slotMapSum += *map.Get(lookup);
+			}
+		});
+
+	uint64_t hashMapSum = 0;
+	const double hashMapSeconds = GojoTests::MeasureSeconds([&]()
+		{
+			for (const Handle lookup : lookups)
+			{
+				hashMapSum += hashMap.find(lookup)->second;
+			}
+		});
+
+	GOJO_CHECK(slotMapSum == hashMapSum);
+	GojoTests::ReportMeasurement("SlotMapGet", slotMapSeconds * 1e9 / cLookupCount, "ns/lookup");
+	GojoTests::ReportMeasurement("UnorderedMapFind", hashMapSeconds * 1e9 / cLookupCount, "ns/lookup");
+}
@@ -0,0 +1,170 @@
+#include "TestFramework.h"
+
+#include <Core/Coroutines/TaskScheduler.h>
+#include <Core/Memory/FrameAllocator.h>
+#include <Core/StartupGraph.h>
+#include <Managers/JobSystem/JobSystem.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	// @brief Thread-safe log of stage start and shut down calls.
+	struct StageTrace
+	{
+		std::mutex Mutex;
+		std::vector<std::string> Entries;
+
+		void Add(std::string entry)
+		{
+			std::lock_guard lock(Mutex);
+			Entries.push_back(std::move(entry));
+		}
+
+		size_t IndexOf(std::string_view entry)
+		{
+			std::lock_guard lock(Mutex);
+			for (size_t index = 0; index < Entries.size(); ++index)
+			{
+				if (Entries[index] == entry)
+					return index;
+			}
+			return SIZE_MAX;
+		}
+	};
+
+	StartupStage MakeTracedStage(StageTrace& trace, const char* name, std::vector<const char*> dependencies, StartupThread thread = StartupThread::Any)
+	{
+		return { name, std::move(dependencies), thread,
+			[&trace, name]() { trace.Add(std::string("+") + name); },
+			[&trace, name]() { trace.Add(std::string("-") + name); } };
+	}
+
+	const StartupTiming* FindTiming(const StartupGraph& graph, const char* name)
+	{
+		for (const StartupTiming& timing : graph.GetTimings())
+		{
+			if (timing.Name && std::strcmp(timing.Name, name) == 0)
+				return &timing;
+		}
+		return nullptr;
+	}
+
+	void SleepMilliseconds(uint32_t milliseconds)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(InvalidStartupGraphsRunNothing)
+{
+	StageTrace trace;
+
+	StartupGraph duplicate;
+	duplicate.Add(MakeTracedStage(trace, "TestA", {}));
+	duplicate.Add(MakeTracedStage(trace, "TestA", {}));
+	GOJO_CHECK(duplicate.StartUp().error() == StartupError::DuplicateStage);
+
+	StartupGraph unknown;
+	unknown.Add(MakeTracedStage(trace, "TestA", { "TestMissing" }));
+	GOJO_CHECK(unknown.StartUp().error() == StartupError::UnknownDependency);
+
+	StartupGraph cycle;
+	cycle.Add(MakeTracedStage(trace, "TestFree", {}));
+	cycle.Add(MakeTracedStage(trace, "TestA", { "TestB" }));
+	cycle.Add(MakeTracedStage(trace, "TestB", { "TestA" }));
+	GOJO_CHECK(cycle.StartUp().error() == StartupError::DependencyCycle);
+
+	GOJO_CHECK(trace.Entries.empty());
+}
+
+GOJO_TEST(StagesStartAfterTheirDependenciesAndStopBeforeThem)
+{
+	StageTrace trace;
+	const std::thread::id mainThreadId = std::this_thread::get_id();
+	std::thread::id mainStageThreadId;
+
+	StartupGraph graph;
+	graph.Add({ "TestJobSystem", {}, StartupThread::Main,
+		[]() { JobSystem::StartUp(JobSystemSettings{ .WorkerCount = 2 }); },
+		[]() { JobSystem::ShutDown(); } });
+	graph.Add(MakeTracedStage(trace, "TestLeft", { "TestJobSystem" }));
+	graph.Add(MakeTracedStage(trace, "TestRight", { "TestJobSystem" }));
+	graph.Add(MakeTracedStage(trace, "TestJoin", { "TestLeft", "TestRight" }));
+	graph.Add({ "TestMainAffine", { "TestJoin" }, StartupThread::Main,
+		[&]() { mainStageThreadId = std::this_thread::get_id(); trace.Add("+TestMainAffine"); },
+		{} });
+
+	GOJO_CHECK(graph.StartUp().has_value());
+	GOJO_CHECK(trace.IndexOf("+TestLeft") < trace.IndexOf("+TestJoin"));
+	GOJO_CHECK(trace.IndexOf("+TestRight") < trace.IndexOf("+TestJoin"));
+	GOJO_CHECK(trace.IndexOf("+TestJoin") < trace.IndexOf("+TestMainAffine"));
+	GOJO_CHECK(mainStageThreadId == mainThreadId);
+
+	// Any stages run on workers once the JobSystem stage started
+	const StartupTiming* left = FindTiming(graph, "TestLeft");
+	const StartupTiming* mainAffine = FindTiming(graph, "TestMainAffine");
+	GOJO_CHECK(left && left->ThreadIndex != 0);
+	GOJO_CHECK(mainAffine && mainAffine->ThreadIndex == 0);
+	GOJO_CHECK(graph.GetTimings().size() == 5);
+
+	// Stages without a shut down callback are skipped, the JobSystem outlives the stages run on it
+	graph.ShutDown();
+	GOJO_CHECK(trace.IndexOf("-TestJoin") < trace.IndexOf("-TestLeft"));
+	GOJO_CHECK(trace.IndexOf("-TestJoin") < trace.IndexOf("-TestRight"));
+	GOJO_CHECK(!JobSystem::IsInitialized());
+}
+
+// ====================================================================================================
+// Benchmarks
+// ====================================================================================================
+
+/**
+ * Cold start of the engine graph without a GPU or a display: the managers that run anywhere are started
+ * for real, GLFW (main thread) and the Vulkan instance (worker) are stood in for by sleeps of their
+ * typical duration. Reports the startup time against the sum of the stage durations it overlapped.
+ */
+GOJO_BENCHMARK(EngineStartupGraphColdStart)
+{
+	StartupGraph graph;
+	graph.Add({ "JobSystem", {}, StartupThread::Main,
+		[]() { JobSystem::StartUp(); },
+		[]() { JobSystem::ShutDown(); } });
+	graph.Add({ "FrameAllocator", {}, StartupThread::Any,
+		[]() { FrameAllocator::StartUp(); },
+		[]() { FrameAllocator::ShutDown(); } });
+	graph.Add({ "TaskScheduler", { "JobSystem", "FrameAllocator" }, StartupThread::Main,
+		[]() { TaskScheduler::StartUp(); },
+		[]() { TaskScheduler::ShutDown(); } });
+	graph.Add({ "WindowManager", {}, StartupThread::Main,
+		[]() { SleepMilliseconds(40); } });
+	graph.Add({ "EventManager", { "WindowManager" }, StartupThread::Any,
+		[]() { SleepMilliseconds(1); } });
+	graph.Add({ "VulkanGraphicsContext", { "JobSystem" }, StartupThread::Any,
+		[]() { SleepMilliseconds(60); } });
+
+	GOJO_CHECK(graph.StartUp().has_value());
+	graph.ShutDown();
+
+	double workMs = 0.0;
+	for (const StartupTiming& timing : graph.GetTimings())
+	{
+		workMs += timing.DurationMs;
+	}
+
+	GojoTests::ReportMeasurement("ColdStartParallel", graph.GetTotalMs(), "ms");
+	GojoTests::ReportMeasurement("ColdStartSerialWork", workMs, "ms");
+}
@@ -0,0 +1,198 @@
+#include "TestFramework.h"
+
+#include <Core/Coroutines/TaskScheduler.h>
+#include <Core/Memory/FrameAllocator.h>
+#include <Managers/JobSystem/JobSystem.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace GojoEngine;
+
+namespace
+{
+	// @brief The managers the scheduler runs on, started and shut down in engine order.
+	class TaskSchedulerScope final
+	{
+	public:
+		TaskSchedulerScope()
+		{
+			JobSystem::StartUp(JobSystemSettings{ .WorkerCount = 2 });
+			FrameAllocator::StartUp();
+			TaskScheduler::StartUp();
+		}
+
+		~TaskSchedulerScope()
+		{
+			TaskScheduler::ShutDown();
+			FrameAllocator::ShutDown();
+			JobSystem::ShutDown();
+		}
+	};
+
+	// @brief Runs frame boundaries like the engine loop until "isDone" or "maxFrames".
+	template<typename PredicateT>
+	uint32_t RunFramesUntil(PredicateT&& isDone, uint32_t maxFrames = 1000)
+	{
+		uint32_t frameCount = 0;
+		while (!isDone() && frameCount < maxFrames)
+		{
+			FrameAllocator::GetInstance().BeginFrame();
+			TaskScheduler::GetInstance().ResumeFrameTasks();
+			++frameCount;
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return frameCount;
+	}
+
+	Task<uint64_t> SumTo(uint64_t value)
+	{
+		if (value == 0)
+			co_return 0;
+
+		co_return value + co_await SumTo(value - 1);
+	}
+
+	Task<void> StoreSum(uint64_t value, uint64_t& result)
+	{
+		result = co_await SumTo(value);
+	}
+
+	// Coroutine lambdas would read their captures from a destroyed closure once suspended, state goes through parameters
+	Task<void> HopBetweenThreads(std::atomic<bool>& ranOnWorker, std::atomic<bool>& cameBackToMainThread, std::atomic<bool>& isDone)
+	{
+		co_await ResumeOnWorker();
+		ranOnWorker = JobSystem::GetCurrentThreadIndex() != 0;
+
+		co_await ResumeOnMainThread();
+		cameBackToMainThread = TaskScheduler::GetInstance().IsMainThread();
+
+		// Already on the main thread: continues without waiting for a frame
+		co_await ResumeOnMainThread();
+		isDone = true;
+	}
+
+	Task<void> WaitForFramesAndCondition(uint32_t& nextFrameCount, uint32_t& pollCount, bool& isDone)
+	{
+		co_await NextFrame();
+		++nextFrameCount;
+		co_await NextFrame();
+		++nextFrameCount;
+
+		co_await WaitUntil([&pollCount]() { return ++pollCount == 3; });
+		isDone = true;
+	}
+
+	struct DestructionFlag
+	{
+		~DestructionFlag() { IsDestroyed = true; }
+		bool& IsDestroyed;
+	};
+
+	Task<void> WaitForever(bool& isDestroyed)
+	{
+		DestructionFlag flag{ isDestroyed };
+		co_await WaitUntil([]() { return false; });
+	}
+
+	Task<void> ReadFiles(std::filesystem::path path, bool& isContentRead, bool& isMissingFileReported, std::atomic<bool>& isDone)
+	{
+		const auto content = co_await ReadFileAsync(path);
+		isContentRead = content && content->size() == 4 && (*content)[0] == std::byte{ 'G' };
+
+		const auto missing = co_await ReadFileAsync(path.parent_path() / "GojoTests_MissingFile.bin");
+		isMissingFileReported = !missing && missing.error() == FileReadError::OpenFailed;
+		isDone = true;
+	}
+}
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(AwaitedTaskChainsCompleteWithoutGrowingTheStack)
+{
+	TaskSchedulerScope scope;
+
+	// Synchronous chains finish inside Spawn, symmetric transfer keeps the stack flat
+	uint64_t result = 0;
+	TaskScheduler::GetInstance().Spawn(StoreSum(10000, result));
+	GOJO_CHECK(result == 10000ull * 10001ull / 2);
+	GOJO_CHECK(TaskScheduler::GetInstance().GetPendingTaskCount() == 0);
+}
+
+GOJO_TEST(TasksHopBetweenWorkersAndTheMainThread)
+{
+	TaskSchedulerScope scope;
+
+	std::atomic<bool> isDone{ false };
+	std::atomic<bool> ranOnWorker{ false };
+	std::atomic<bool> cameBackToMainThread{ false };
+	TaskScheduler::GetInstance().Spawn(HopBetweenThreads(ranOnWorker, cameBackToMainThread, isDone));
+
+	RunFramesUntil([&isDone]() { return isDone.load(); });
+	GOJO_CHECK(isDone.load());
+	GOJO_CHECK(ranOnWorker.load());
+	GOJO_CHECK(cameBackToMainThread.load());
+	GOJO_CHECK(TaskScheduler::GetInstance().GetPendingTaskCount() == 0);
+}
+
+GOJO_TEST(WaitUntilPollsOncePerFrame)
+{
+	TaskSchedulerScope scope;
+
+	uint32_t pollCount = 0;
+	uint32_t nextFrameCount = 0;
+	bool isDone = false;
+	TaskScheduler::GetInstance().Spawn(WaitForFramesAndCondition(nextFrameCount, pollCount, isDone));
+
+	GOJO_CHECK(nextFrameCount == 0);
+	const uint32_t frameCount = RunFramesUntil([&isDone]() { return isDone; });
+	GOJO_CHECK(isDone);
+	GOJO_CHECK(nextFrameCount == 2);
+	GOJO_CHECK(pollCount == 3);
+
+	// One frame per NextFrame, the condition is first polled in the frame after the second one
+	GOJO_CHECK(frameCount == 5);
+}
+
+GOJO_TEST(UnfinishedTasksAreDestroyedOnShutDown)
+{
+	bool isDestroyed = false;
+	{
+		TaskSchedulerScope scope;
+		TaskScheduler::GetInstance().Spawn(WaitForever(isDestroyed));
+
+		RunFramesUntil([]() { return false; }, 3);
+		GOJO_CHECK(!isDestroyed);
+		GOJO_CHECK(TaskScheduler::GetInstance().GetPendingTaskCount() == 1);
+	}
+	GOJO_CHECK(isDestroyed);
+}
+
+GOJO_TEST(ReadFileAsyncReturnsTheFileOrAnError)
+{
+	TaskSchedulerScope scope;
+
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "GojoTests_ReadFileAsync.bin";
+	{
+		std::ofstream file(path, std::ios::binary);
+		file << "Gojo";
+	}
+
+	std::atomic<bool> isDone{ false };
+	bool isContentRead = false;
+	bool isMissingFileReported = false;
+	TaskScheduler::GetInstance().Spawn(ReadFiles(path, isContentRead, isMissingFileReported, isDone));
+
+	RunFramesUntil([&isDone]() { return isDone.load(); });
+	GOJO_CHECK(isContentRead);
+	GOJO_CHECK(isMissingFileReported);
+
+	std::filesystem::remove(path);
+}
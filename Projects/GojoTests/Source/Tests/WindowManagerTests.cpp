@@ -0,0 +1,47 @@
+#include "TestFramework.h"
+
+#include <Managers/EventManager/EventManager.h>
+#include <Managers/WindowManager/WindowManager.h>
+
+using namespace GojoEngine;
+
+// ====================================================================================================
+// Tests
+// ====================================================================================================
+
+GOJO_TEST(HeadlessWindowsAreCreatedPolledAndClosed)
+{
+	// The GLFW null platform needs no display, the same path the build farm runs the engine on
+	EventManager::StartUp();
+	WindowManager::StartUp(WindowManagerSettings{ .Headless = true });
+
+	WindowManager& windowManager = WindowManager::GetInstance();
+	GOJO_CHECK(windowManager.IsHeadless());
+	GOJO_CHECK(windowManager.AreAllWindowsClosed());
+
+	const auto windowResult = windowManager.CreateWindow(WindowSettings{ .Width = 320, .Height = 240, .Title = "HeadlessWindow" });
+	GOJO_CHECK(windowResult.has_value());
+	if (windowResult)
+	{
+		const WindowId windowId = windowResult.value();
+		const Window* window = windowManager.GetWindowById(windowId);
+		GOJO_CHECK(window && window->IsValid());
+		GOJO_CHECK(window && window->GetTitle() == "HeadlessWindow");
+		GOJO_CHECK(!windowManager.AreAllWindowsClosed());
+
+		// Polling keeps an open window alive, closing it erases it on the next cleanup
+		windowManager.PollEvents();
+		windowManager.CleanupClosedWindows();
+		GOJO_CHECK(!windowManager.AreAllWindowsClosed());
+
+		windowManager.CloseAllWindows();
+		windowManager.PollEvents();
+		EventManager::GetInstance().DispatchEventsInQueue();
+		windowManager.CleanupClosedWindows();
+		GOJO_CHECK(windowManager.AreAllWindowsClosed());
+		GOJO_CHECK(windowManager.GetWindowById(windowId) == nullptr);
+	}
+
+	WindowManager::ShutDown();
+	EventManager::ShutDown();
+}
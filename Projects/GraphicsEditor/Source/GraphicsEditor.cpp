@@ -2,9 +2,24 @@
 
 using namespace GojoEngine;
 
+struct Transform
+{
+	float X{ 0.0f };
+	float Y{ 0.0f };
+};
+
+struct Velocity
+{
+	float X{ 0.0f };
+	float Y{ 0.0f };
+};
+
 int main()
 {
-	Engine::StartUp();
+	if (!Engine::StartUp())
+	{
+		return 1;
+	}
 
 	auto& windowManager = GojoEngine::WindowManager::GetInstance();
 	const auto window1Result = windowManager.CreateWindow(GojoEngine::WindowSettings{ 50,50,800,600,"GojoWindow1" });
@@ -19,14 +34,15 @@ int main()
 	auto window3Id = window3Result.value();
 
 	// Local listeners for window with Id = 1
+	// Dragging the border fires a resize per frame, only a few per second are logged
 	AddWindowListener<WindowResizeEvent>(window1Id, [](const WindowResizeEvent& event)
 		{
-			GOJO_LOG_INFO("Engine", "{}", event.ToString());
+			GOJO_LOG_INFO_RATE_LIMITED("Engine", 5, "WindowResize: Size[{} - {}]", event.GetWidth(), event.GetHeight());
 		});
 
 	AddWindowListener<KeyReleasedEvent>(window1Id, [](const KeyReleasedEvent& event)
 		{
-			GOJO_LOG_INFO("Engine", "{}", event.ToString());
+			GOJO_LOG_INFO_DEDUP("Engine", "KeyReleased: Key[{}]", event.GetKeyCode());
 		});
 
 	// Global listener (for all windows)
@@ -35,7 +51,37 @@ int main()
 			GOJO_LOG_INFO("Engine", "{}", event.ToString());
 		});
 
-	Engine::Run();
+	{
+		// Scene: entities moved by one system every fixed step
+		World scene;
+		for (uint32_t index = 0; index < 10000; ++index)
+		{
+			scene.CreateEntity(Transform{}, Velocity{ static_cast<float>(index % 100), static_cast<float>(index / 100) });
+		}
+
+		Query<Transform, const Velocity> movables(scene);
+		float fixedDeltaSeconds = 0.0f;
+
+		SystemScheduler scheduler;
+		scheduler.AddSystem("Movement", SystemAccess::Of<Transform, const Velocity>(), [&movables, &fixedDeltaSeconds](World&, ThreadCommandBuffers&)
+			{
+				movables.ParallelForEach([deltaSeconds = fixedDeltaSeconds](Transform& transform, const Velocity& velocity)
+					{
+						transform.X += velocity.X * deltaSeconds;
+						transform.Y += velocity.Y * deltaSeconds;
+					});
+			});
+
+		const PhaseCallbackId sceneCallback = Engine::AddPhaseCallback(EnginePhase::FixedUpdate, [&scene, &scheduler, &fixedDeltaSeconds](const FrameTime& time)
+			{
+				fixedDeltaSeconds = static_cast<float>(time.FixedDeltaSeconds);
+				scheduler.Run(scene);
+			});
+
+		Engine::Run();
+
+		Engine::RemovePhaseCallback(sceneCallback);
+	}
 
 	Engine::ShutDown();
 
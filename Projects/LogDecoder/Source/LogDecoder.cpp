@@ -0,0 +1,323 @@
+#include <Core/MappedFile.h>
+#include <Managers/LogManager/BinaryLogFormat.h>
+#include <Managers/LogManager/LogCategory.h>
+#include <Managers/LogManager/LogManager.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+using namespace GojoEngine;
+
+// ====================================================================================================
+// Decoder
+// ====================================================================================================
+
+/**
+ * Offline decoder of the segment files written by the binary log sink (LogSettings::BinaryLogDirectory).
+ *
+ *     LogDecoder [--category <name>]... [--level <level>] [--from <time>] [--to <time>] <file or directory>...
+ *
+ * Directories are scanned for *.gjlog segments, all segments are decoded in rotation order.
+ * Times are milliseconds since the Unix epoch or "YYYY-MM-DDTHH:MM:SS" (UTC).
+ */
+namespace
+{
+	struct DecodedSite
+	{
+		std::string_view Category;
+		std::string_view File;
+		std::string_view Format;
+		const LogArgType* Types{ nullptr };
+		uint32_t ArgCount{ 0 };
+		uint32_t Line{ 0 };
+		LogLevel Level{ LogLevel::Trace };
+	};
+
+	struct DecoderFilter
+	{
+		std::vector<std::string> Categories;
+		LogLevel MinLevel{ LogLevel::Trace };
+		int64_t From{ INT64_MIN };
+		int64_t To{ INT64_MAX };
+	};
+
+	struct Segment
+	{
+		std::filesystem::path Path;
+		uint64_t Index{ 0 };
+	};
+
+	constexpr std::string_view cRuntimeFormatPrefix = "[{}] ";
+
+	// @brief Parses milliseconds since the epoch or "YYYY-MM-DDTHH:MM:SS" (UTC) into nanoseconds since the epoch.
+	bool ParseTime(std::string_view text, int64_t& time)
+	{
+		int64_t milliseconds = 0;
+		if (const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), milliseconds);
+			error == std::errc() && end == text.data() + text.size())
+		{
+			time = milliseconds * 1'000'000;
+			return true;
+		}
+
+		int year = 0;
+		unsigned month = 0, day = 0, hours = 0, minutes = 0, seconds = 0;
+		const std::string terminated(text);
+		if (std::sscanf(terminated.c_str(), "%d-%u-%uT%u:%u:%u", &year, &month, &day, &hours, &minutes, &seconds) != 6)
+			return false;
+
+		const std::chrono::year_month_day date{ std::chrono::year(year), std::chrono::month(month), std::chrono::day(day) };
+		if (!date.ok() || hours > 23 || minutes > 59 || seconds > 60)
+			return false;
+
+		const auto timePoint = std::chrono::sys_days(date) + std::chrono::hours(hours) + std::chrono::minutes(minutes) + std::chrono::seconds(seconds);
+		time = std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint.time_since_epoch()).count();
+		return true;
+	}
+
+	void AppendTime(std::string& output, int64_t time)
+	{
+		using namespace std::chrono;
+
+		const sys_time<milliseconds> timePoint{ duration_cast<milliseconds>(nanoseconds(time)) };
+		const sys_days days = floor<std::chrono::days>(timePoint);
+		const year_month_day date{ days };
+		const hh_mm_ss clock{ timePoint - days };
+
+		std::format_to(std::back_inserter(output), "[{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:03}]",
+			static_cast<int>(date.year()), static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()),
+			clock.hours().count(), clock.minutes().count(), clock.seconds().count(), clock.subseconds().count());
+	}
+
+	bool CollectSegments(const std::filesystem::path& path, std::vector<Segment>& segments)
+	{
+		auto addSegment = [&](const std::filesystem::path& segmentPath)
+			{
+				MappedFile file;
+				if (!file.Open(segmentPath, MappedFile::Access::ReadOnly) || file.GetSize() < sizeof(BinaryLogSegmentHeader))
+				{
+					std::fprintf(stderr, "Skipping '%s': cannot be mapped\n", segmentPath.string().c_str());
+					return;
+				}
+
+				BinaryLogSegmentHeader header{};
+				std::memcpy(&header, file.GetData(), sizeof(header));
+				if (std::memcmp(header.Magic, cBinaryLogMagic, sizeof(cBinaryLogMagic)) != 0 || header.Version != cBinaryLogVersion)
+				{
+					std::fprintf(stderr, "Skipping '%s': not a version %u log segment\n", segmentPath.string().c_str(), cBinaryLogVersion);
+					return;
+				}
+
+				segments.push_back(Segment{ segmentPath, header.SegmentIndex });
+			};
+
+		std::error_code error;
+		if (std::filesystem::is_directory(path, error))
+		{
+			for (const auto& entry : std::filesystem::directory_iterator(path, error))
+			{
+				if (entry.is_regular_file(error) && entry.path().extension() == cBinaryLogExtension)
+				{
+					addSegment(entry.path());
+				}
+			}
+			return true;
+		}
+
+		if (!std::filesystem::exists(path, error))
+		{
+			std::fprintf(stderr, "'%s' does not exist\n", path.string().c_str());
+			return false;
+		}
+
+		addSegment(path);
+		return true;
+	}
+
+	bool IsAccepted(const DecoderFilter& filter, LogLevel level, std::string_view category, int64_t time)
+	{
+		if (level < filter.MinLevel || time < filter.From || time > filter.To)
+			return false;
+
+		return filter.Categories.empty() || std::ranges::find(filter.Categories, category) != filter.Categories.end();
+	}
+
+	// @return The number of printed messages.
+	size_t DecodeSegment(const Segment& segment, const DecoderFilter& filter)
+	{
+		MappedFile file;
+		if (!file.Open(segment.Path, MappedFile::Access::ReadOnly))
+			return 0;
+
+		const std::byte* data = file.GetData();
+		const size_t size = file.GetSize();
+
+		std::unordered_map<uint32_t, DecodedSite> sites;		// Site ids are only meaningful inside a segment
+		std::vector<DecodedLogArg> arguments;
+		std::string line;
+		size_t printedCount = 0;
+
+		size_t offset = AlignBinaryLogRecord(sizeof(BinaryLogSegmentHeader));
+		while (offset + sizeof(BinaryLogRecordHeader) <= size)
+		{
+			BinaryLogRecordHeader header{};
+			std::memcpy(&header, data + offset, sizeof(header));
+			if (header.Type == BinaryLogRecordType::End || header.Size < sizeof(header) || header.Size > size - offset)
+				break;
+
+			const std::byte* body = data + offset + sizeof(header);
+			const size_t bodySize = header.Size - sizeof(header);
+
+			if (header.Type == BinaryLogRecordType::Site && bodySize >= sizeof(BinaryLogSiteRecord))
+			{
+				BinaryLogSiteRecord record{};
+				std::memcpy(&record, body, sizeof(record));
+
+				const size_t typesSize = record.ArgCount * sizeof(LogArgType);
+				if (sizeof(record) + typesSize + record.CategoryLength + record.FileLength + record.FormatLength <= bodySize)
+				{
+					const char* text = reinterpret_cast<const char*>(body + sizeof(record) + typesSize);
+
+					DecodedSite& site = sites[record.SiteId];
+					site.Types = reinterpret_cast<const LogArgType*>(body + sizeof(record));
+					site.ArgCount = record.ArgCount;
+					site.Line = record.Line;
+					site.Level = static_cast<LogLevel>(record.Level);
+					site.Category = std::string_view(text, record.CategoryLength);
+					site.File = std::string_view(text + record.CategoryLength, record.FileLength);
+					site.Format = std::string_view(text + record.CategoryLength + record.FileLength, record.FormatLength);
+				}
+			}
+			else if (header.Type == BinaryLogRecordType::Message && bodySize >= sizeof(BinaryLogMessageRecord))
+			{
+				BinaryLogMessageRecord record{};
+				std::memcpy(&record, body, sizeof(record));
+
+				const auto siteIt = sites.find(record.SiteId);
+				const bool isValid = siteIt != sites.end()
+					&& record.ArgumentsSize <= bodySize - sizeof(record)
+					&& DecodeLogArgs(std::span(siteIt->second.Types, siteIt->second.ArgCount), std::span(body + sizeof(record), record.ArgumentsSize), arguments);
+
+				if (isValid)
+				{
+					const DecodedSite& site = siteIt->second;
+
+					// Runtime categories (LogMessage) travel as the first argument
+					std::string_view category = site.Category;
+					std::string_view format = site.Format;
+					size_t firstArgument = 0;
+					if (category.empty() && !arguments.empty() && std::holds_alternative<std::string_view>(arguments[0]))
+					{
+						category = std::get<std::string_view>(arguments[0]);
+						if (format.starts_with(cRuntimeFormatPrefix))
+						{
+							format.remove_prefix(cRuntimeFormatPrefix.size());
+							firstArgument = 1;
+						}
+					}
+
+					if (IsAccepted(filter, site.Level, category, record.Time))
+					{
+						line.clear();
+						AppendTime(line, record.Time);
+						std::format_to(std::back_inserter(line), " [{}] [{}] ", GetLogLevelName(site.Level), category);
+						FormatDecodedLogArgs(line, format, arguments, firstArgument);
+						line.push_back('\n');
+
+						std::fwrite(line.data(), 1, line.size(), stdout);
+						++printedCount;
+					}
+				}
+			}
+
+			offset += header.Size;
+		}
+
+		return printedCount;
+	}
+
+	void PrintUsage()
+	{
+		std::fputs("Usage: LogDecoder [--category <name>]... [--level <level>] [--from <time>] [--to <time>] <file or directory>...\n"
+			"  --category  Only print messages of this category (repeatable)\n"
+			"  --level     Minimum level: trace, info, debug, warning, error, fatal\n"
+			"  --from/--to Time range, milliseconds since the Unix epoch or YYYY-MM-DDTHH:MM:SS (UTC)\n", stderr);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	DecoderFilter filter;
+	std::vector<std::filesystem::path> inputs;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view argument = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if (argument == "--category" && hasValue)
+		{
+			filter.Categories.emplace_back(argv[++i]);
+		}
+		else if (argument == "--level" && hasValue)
+		{
+			if (!LogCategory::ParseLevel(argv[++i], filter.MinLevel))
+			{
+				std::fprintf(stderr, "Unknown level '%s'\n", argv[i]);
+				return 1;
+			}
+		}
+		else if ((argument == "--from" || argument == "--to") && hasValue)
+		{
+			if (!ParseTime(argv[++i], argument == "--from" ? filter.From : filter.To))
+			{
+				std::fprintf(stderr, "Invalid time '%s'\n", argv[i]);
+				return 1;
+			}
+		}
+		else if (argument.starts_with("--"))
+		{
+			PrintUsage();
+			return 1;
+		}
+		else
+		{
+			inputs.emplace_back(argument);
+		}
+	}
+
+	if (inputs.empty())
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::vector<Segment> segments;
+	for (const auto& input : inputs)
+	{
+		if (!CollectSegments(input, segments))
+			return 1;
+	}
+
+	// Oldest segment first, the index keeps increasing across rotations and runs
+	std::ranges::stable_sort(segments, {}, &Segment::Index);
+
+	size_t printedCount = 0;
+	for (const auto& segment : segments)
+	{
+		printedCount += DecodeSegment(segment, filter);
+	}
+
+	std::fprintf(stderr, "%zu messages decoded from %zu segments\n", printedCount, segments.size());
+	return 0;
+}